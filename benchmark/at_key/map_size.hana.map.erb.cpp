@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    constexpr auto map = hana::make_map(
+        hana::make_pair(hana::int_c<0>, hana::int_c<0>)
+        <% (1..input_size).each do |n| %>
+            , hana::make_pair(hana::int_c<<%= n %>>, hana::int_c<<%= n %>>)
+        <% end %>
+    );
+    (void)hana::at_key(map, hana::int_c<<%= input_size %>>);
+}
@@ -0,0 +1,21 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+namespace mpl = boost::mpl;
+
+
+using map = <%= mpl_map((0..input_size).map { |n|
+    ["mpl::int_<#{n}>", "mpl::int_<#{n}>"]
+}) %>;
+
+static_assert(mpl::at<map, mpl::int_<<%= input_size %>>>::type::value
+                    == <%= input_size %>, "");
+
+
+int main() { }
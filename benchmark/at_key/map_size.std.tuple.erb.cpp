@@ -0,0 +1,17 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <tuple>
+#include <type_traits>
+
+
+int main() {
+    constexpr std::tuple<
+        std::integral_constant<int, 0>
+        <% (1..input_size).each do |n| %>
+            , std::integral_constant<int, <%= n %>>
+        <% end %>
+    > tuple{};
+    (void)std::get<std::integral_constant<int, <%= input_size %>>>(tuple);
+}
@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+namespace mpl = boost::mpl;
+
+
+using map = <%= mpl_map((1..env[:size]).map { |n|
+    ["mpl::int_<#{n}>", "mpl::int_<#{n}>"]
+}) %>;
+
+<% (1..input_size).each do |i| %>
+    static_assert(mpl::at<map, mpl::int_<<%= i % env[:size] + 1 %>>>::type::value
+                        == <%= i % env[:size] + 1 %>, "");
+<% end %>
+
+
+int main() { }
@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/define_struct.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+
+<% types = %w(int int double char short int) %>
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        <%= (0...input_size).map { |i| "(#{types[i % types.size]}, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+char* encode(Record const& record, char* out) {
+    boost::hana::for_each(boost::hana::accessors<Record>(), [&](auto const& accessor) {
+        auto const& member = boost::hana::second(accessor)(record);
+        std::memcpy(out, &member, sizeof(member));
+        out += sizeof(member);
+    });
+    return out;
+}
+
+int main () {
+    std::vector<Record> records(1024);
+    for (std::size_t i = 0; i != records.size(); ++i)
+        records[i].m0 = static_cast<int>(i);
+    std::vector<char> buffer(records.size() * sizeof(Record));
+
+    boost::hana::benchmark::measure([&] {
+        char* out = buffer.data();
+        for (Record const& record : records)
+            out = encode(record, out);
+        boost::hana::benchmark::do_not_optimize(buffer);
+    });
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/binary.hpp>
+#include <boost/hana/define_struct.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+
+<% types = %w(int int double char short int) %>
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        <%= (0...input_size).map { |i| "(#{types[i % types.size]}, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+char const* decode(char const* in, Record& record) {
+    return boost::hana::experimental::binary_decode(in, record);
+}
+
+int main () {
+    std::vector<Record> records(1024);
+    std::vector<char> buffer(records.size() * sizeof(Record));
+    for (std::size_t i = 0; i != buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i);
+
+    boost::hana::benchmark::measure([&] {
+        char const* in = buffer.data();
+        for (Record& record : records)
+            in = decode(in, record);
+        boost::hana::benchmark::do_not_optimize(records);
+    });
+}
@@ -0,0 +1,67 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+<% if env[:disable_concept_checks] %>
+#define BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+<% end %>
+
+#include <boost/hana/all_of.hpp>
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/count_if.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/members.hpp>
+#include <boost/hana/none_of.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/unpack.hpp>
+namespace hana = boost::hana;
+
+
+// Each Struct is its own tag, so every concept queried by the algorithms
+// below is evaluated once for each of these types.
+<% (1..input_size).each do |n| %>
+struct s<%= n %> {
+    BOOST_HANA_DEFINE_STRUCT(s<%= n %>,
+        (int, a),
+        (char, b),
+        (long, c)
+    );
+};
+<% end %>
+
+struct f {
+    template <typename ...T>
+    constexpr int operator()(T const& ...) const { return 0; }
+};
+
+struct p {
+    template <typename T>
+    constexpr hana::false_ operator()(T const&) const { return {}; }
+};
+
+int main() {
+    <% (1..input_size).each do |n| %>
+    {
+        constexpr s<%= n %> xs{};
+        (void)hana::length(xs);
+        (void)hana::keys(xs);
+        (void)hana::members(xs);
+        (void)hana::unpack(xs, f{});
+        (void)hana::fold_left(xs, 0, f{});
+        hana::for_each(xs, f{});
+        (void)hana::any_of(xs, p{});
+        (void)hana::all_of(xs, p{});
+        (void)hana::none_of(xs, p{});
+        (void)hana::count_if(xs, p{});
+        (void)hana::find_if(xs, p{});
+        (void)hana::contains(xs, BOOST_HANA_STRING("a"));
+    }
+    <% end %>
+}
@@ -17,16 +17,15 @@ namespace hana = boost::hana;
 
 
 int main () {
-    hana::benchmark::measure([] {
-        long double result = 0;
-        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
-            auto values = fusion::make_vector(
-                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
-            );
+    auto values = fusion::make_vector(
+        <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+    );
 
-            result += fusion::fold(values, 0, [](auto state, auto t) {
-                return state + t;
-            });
-        }
+    hana::benchmark::measure([&] {
+        hana::benchmark::do_not_optimize(values);
+        long double result = fusion::fold(values, 0, [](auto state, auto t) {
+            return state + t;
+        });
+        hana::benchmark::do_not_optimize(result);
     });
 }
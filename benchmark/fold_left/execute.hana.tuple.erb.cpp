@@ -11,16 +11,15 @@
 
 
 int main () {
-    boost::hana::benchmark::measure([] {
-        long double result = 0;
-        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
-            auto values = boost::hana::make_tuple(
-                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
-            );
+    auto values = boost::hana::make_tuple(
+        <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+    );
 
-            result += boost::hana::fold_left(values, 0, [](auto state, auto t) {
-                return state + t;
-            });
-        }
+    boost::hana::benchmark::measure([&] {
+        boost::hana::benchmark::do_not_optimize(values);
+        long double result = boost::hana::fold_left(values, 0, [](auto state, auto t) {
+            return state + t;
+        });
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
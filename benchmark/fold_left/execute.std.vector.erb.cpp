@@ -9,14 +9,14 @@
 
 
 int main () {
-    boost::hana::benchmark::measure([] {
-        long long result = 0;
-        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
-            std::vector<int> values = {
-                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
-            };
+    std::vector<int> values = {
+        <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+    };
 
-            result += std::accumulate(values.begin(), values.end(), 0);
-        }
+    boost::hana::benchmark::measure([&] {
+        boost::hana::benchmark::do_not_optimize(values);
+        boost::hana::benchmark::clobber();
+        long long result = std::accumulate(values.begin(), values.end(), 0);
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
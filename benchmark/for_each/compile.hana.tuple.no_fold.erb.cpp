@@ -0,0 +1,26 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+// Measure the C++14 implementation, even if the compiler supports fold
+// expressions.
+#define BOOST_HANA_CONFIG_DISABLE_FOLD_EXPRESSIONS
+
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+struct f {
+    template <typename X>
+    constexpr void operator()(X) const { }
+};
+
+template <int i>
+struct x { };
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    boost::hana::for_each(tuple, f{});
+}
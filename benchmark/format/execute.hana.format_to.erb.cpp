@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/format.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+
+struct record {
+    <%= (0...input_size).map { |i| i.even? ? "int field#{i};" : "double field#{i};" }.join("\n    ") %>
+};
+
+std::vector<record> make_records() {
+    std::vector<record> records(1000);
+    for (record& r : records) {
+        <%= (0...input_size).map { |i|
+              i.even? ? "r.field#{i} = std::rand() - RAND_MAX / 2;"
+                      : "r.field#{i} = std::rand() / 1000.0;"
+            }.join("\n        ") %>
+    }
+    return records;
+}
+
+int main () {
+    std::vector<record> records = make_records();
+    <%= (0...input_size).map { |i| "auto key#{i} = BOOST_HANA_STRING(\"#{i == 0 ? '' : ' '}field#{i}=\");" }.join("\n    ") %>
+
+    boost::hana::benchmark::measure([&] {
+        char buffer[boost::hana::experimental::max_formatted_size<
+            <%= (0...input_size).map { |i| "decltype(key#{i}), decltype(record::field#{i})" }.join(",\n            ") %>
+        >];
+        std::size_t size = 0;
+        for (record const& r : records) {
+            char* end = boost::hana::experimental::format_to(buffer,
+                <%= (0...input_size).map { |i| "key#{i}, r.field#{i}" }.join(",\n                ") %>
+            );
+            size += static_cast<std::size_t>(end - buffer);
+        }
+        boost::hana::benchmark::do_not_optimize(size);
+    });
+}
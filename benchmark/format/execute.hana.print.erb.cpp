@@ -0,0 +1,39 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/printable.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+struct record {
+    <%= (0...input_size).map { |i| i.even? ? "int field#{i};" : "double field#{i};" }.join("\n    ") %>
+};
+
+std::vector<record> make_records() {
+    std::vector<record> records(1000);
+    for (record& r : records) {
+        <%= (0...input_size).map { |i|
+              i.even? ? "r.field#{i} = std::rand() - RAND_MAX / 2;"
+                      : "r.field#{i} = std::rand() / 1000.0;"
+            }.join("\n        ") %>
+    }
+    return records;
+}
+
+int main () {
+    std::vector<record> records = make_records();
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t size = 0;
+        for (record const& r : records) {
+            std::string result;
+            <%= (0...input_size).map { |i| "result += \"#{i == 0 ? '' : ' '}field#{i}=\"; result += boost::hana::experimental::print(r.field#{i});" }.join("\n            ") %>
+            size += result.size();
+        }
+        boost::hana::benchmark::do_not_optimize(size);
+    });
+}
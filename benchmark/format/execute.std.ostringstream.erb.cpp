@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <ios>
+#include <sstream>
+#include <vector>
+
+struct record {
+    <%= (0...input_size).map { |i| i.even? ? "int field#{i};" : "double field#{i};" }.join("\n    ") %>
+};
+
+std::vector<record> make_records() {
+    std::vector<record> records(1000);
+    for (record& r : records) {
+        <%= (0...input_size).map { |i|
+              i.even? ? "r.field#{i} = std::rand() - RAND_MAX / 2;"
+                      : "r.field#{i} = std::rand() / 1000.0;"
+            }.join("\n        ") %>
+    }
+    return records;
+}
+
+int main () {
+    std::vector<record> records = make_records();
+
+    boost::hana::benchmark::measure([&] {
+        std::ostringstream os;
+        os << std::fixed;
+        std::size_t size = 0;
+        for (record const& r : records) {
+            os.str("");
+            os <%= (0...input_size).map { |i| "<< \"#{i == 0 ? '' : ' '}field#{i}=\" << r.field#{i}" }.join("\n               ") %>;
+            size += static_cast<std::size_t>(os.tellp());
+        }
+        boost::hana::benchmark::do_not_optimize(size);
+    });
+}
@@ -0,0 +1,40 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+struct record {
+    <%= (0...input_size).map { |i| i.even? ? "int field#{i};" : "double field#{i};" }.join("\n    ") %>
+};
+
+std::vector<record> make_records() {
+    std::vector<record> records(1000);
+    for (record& r : records) {
+        <%= (0...input_size).map { |i|
+              i.even? ? "r.field#{i} = std::rand() - RAND_MAX / 2;"
+                      : "r.field#{i} = std::rand() / 1000.0;"
+            }.join("\n        ") %>
+    }
+    return records;
+}
+
+int main () {
+    std::vector<record> records = make_records();
+
+    boost::hana::benchmark::measure([&] {
+        char buffer[<%= 24 * input_size + 16 * input_size %>];
+        std::size_t size = 0;
+        for (record const& r : records) {
+            int n = std::snprintf(buffer, sizeof(buffer),
+                "<%= (0...input_size).map { |i| "#{i == 0 ? '' : ' '}field#{i}=#{i.even? ? '%d' : '%f'}" }.join %>",
+                <%= (0...input_size).map { |i| "r.field#{i}" }.join(", ") %>
+            );
+            size += static_cast<std::size_t>(n);
+        }
+        boost::hana::benchmark::do_not_optimize(size);
+    });
+}
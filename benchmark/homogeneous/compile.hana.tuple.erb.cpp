@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+<% types = (0...input_size).map { |i| env[:heterogeneous] && i.odd? ? 'long' : 'int' } %>
+
+int main() {
+    hana::tuple<<%= types.join(', ') %>> xs{};
+
+    long sum = hana::fold_left(xs, 0l, [](long s, auto x) { return s + x; });
+    auto ys = hana::transform(xs, [](auto x) { return x * 2; });
+    hana::for_each(ys, [&](auto x) { sum += x; });
+    bool eq = xs == ys;
+    return static_cast<int>(sum) + eq;
+}
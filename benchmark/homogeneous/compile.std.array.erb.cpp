@@ -0,0 +1,21 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include <array>
+namespace hana = boost::hana;
+
+
+int main() {
+    std::array<int, <%= input_size %>> xs{};
+
+    long sum = hana::fold_left(xs, 0l, [](long s, auto x) { return s + x; });
+    hana::for_each(xs, [&](auto x) { sum += x; });
+    bool eq = xs == xs;
+    return static_cast<int>(sum) + eq;
+}
@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+namespace hana = boost::hana;
+
+
+<% types = (0...input_size).map { |i| env[:heterogeneous] && i.odd? ? 'long' : 'int' } %>
+
+int main () {
+    hana::tuple<<%= types.join(', ') %>> values{
+        <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+    };
+
+    hana::benchmark::measure([&] {
+        hana::benchmark::do_not_optimize(values);
+        long sum = hana::fold_left(values, 0l, [](long s, auto x) { return s + x; });
+        auto doubled = hana::transform(values, [](auto x) { return x * 2; });
+        hana::for_each(doubled, [&](auto x) { sum ^= x; });
+        bool eq = values == doubled;
+        hana::benchmark::do_not_optimize(sum);
+        hana::benchmark::do_not_optimize(eq);
+    });
+}
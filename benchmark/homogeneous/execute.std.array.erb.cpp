@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include "measure.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+namespace hana = boost::hana;
+
+
+int main () {
+    std::array<int, <%= input_size %>> values = {{
+        <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+    }};
+
+    hana::benchmark::measure([&] {
+        hana::benchmark::do_not_optimize(values);
+        long sum = hana::fold_left(values, 0l, [](long s, auto x) { return s + x; });
+        std::array<int, <%= input_size %>> doubled;
+        for (std::size_t i = 0; i != values.size(); ++i)
+            doubled[i] = values[i] * 2;
+        hana::for_each(doubled, [&](auto x) { sum ^= x; });
+        bool eq = values == doubled;
+        hana::benchmark::do_not_optimize(sum);
+        hana::benchmark::do_not_optimize(eq);
+    });
+}
@@ -0,0 +1,9 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+// The precompiled header is included by the compiler before this line.
+#include <boost/hana.hpp>
+
+
+int main() { }
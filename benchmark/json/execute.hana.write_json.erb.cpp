@@ -0,0 +1,48 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/second.hpp>
+
+#include "measure.hpp"
+#include <string>
+#include <vector>
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model),
+        (int, year)
+    );
+};
+
+struct Garage {
+    BOOST_HANA_DEFINE_STRUCT(Garage,
+        <%= (0...input_size).map { |i| "(Car, car#{i})" }.join(",\n        ") %>
+    );
+};
+
+void write(std::string& out, Garage const& garage) {
+    out.clear();
+    boost::hana::experimental::write_json(out, garage);
+}
+
+int main () {
+    std::vector<Garage> garages(100);
+    boost::hana::for_each(boost::hana::accessors<Garage>(), [&](auto const& accessor) {
+        for (Garage& garage : garages)
+            boost::hana::second(accessor)(garage) = Car{"Audi", "A4", 2016};
+    });
+
+    std::string out;
+    boost::hana::benchmark::measure([&] {
+        for (Garage const& garage : garages)
+            write(out, garage);
+        boost::hana::benchmark::do_not_optimize(out);
+    });
+}
@@ -0,0 +1,73 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana.hpp>
+
+#include "measure.hpp"
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+namespace hana = boost::hana;
+
+
+// The implementation from example/tutorial/introspection.json.cpp
+template <typename Xs>
+std::string join(Xs&& xs, std::string sep) {
+    return hana::fold(hana::intersperse(std::forward<Xs>(xs), sep), "", hana::_ + hana::_);
+}
+
+std::string quote(std::string s) { return "\"" + s + "\""; }
+
+template <typename T>
+auto to_json(T const& x) -> decltype(std::to_string(x)) {
+    return std::to_string(x);
+}
+
+std::string to_json(char c) { return quote({c}); }
+std::string to_json(std::string s) { return quote(s); }
+
+template <typename T>
+    std::enable_if_t<hana::Struct<T>::value,
+std::string> to_json(T const& x) {
+    auto json = hana::transform(hana::keys(x), [&](auto name) {
+        auto const& member = hana::at_key(x, name);
+        return quote(hana::to<char const*>(name)) + " : " + to_json(member);
+    });
+
+    return "{" + join(std::move(json), ", ") + "}";
+}
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model),
+        (int, year)
+    );
+};
+
+struct Garage {
+    BOOST_HANA_DEFINE_STRUCT(Garage,
+        <%= (0...input_size).map { |i| "(Car, car#{i})" }.join(",\n        ") %>
+    );
+};
+
+void write(std::string& out, Garage const& garage) {
+    out = to_json(garage);
+}
+
+int main () {
+    std::vector<Garage> garages(100);
+    boost::hana::for_each(boost::hana::accessors<Garage>(), [&](auto const& accessor) {
+        for (Garage& garage : garages)
+            boost::hana::second(accessor)(garage) = Car{"Audi", "A4", 2016};
+    });
+
+    std::string out;
+    boost::hana::benchmark::measure([&] {
+        for (Garage const& garage : garages)
+            write(out, garage);
+        boost::hana::benchmark::do_not_optimize(out);
+    });
+}
@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto map = hana::make_map(
+        <%= (1..input_size).map { |n|
+            "hana::make_pair(hana::int_c<#{n}>, std::rand())"
+        }.join(', ') %>
+    );
+    hana::benchmark::do_not_optimize(map);
+
+    int result = hana::fold_left(hana::keys(map), 0, [&](int acc, auto key) {
+        return acc + map[key];
+    });
+    hana::benchmark::do_not_optimize(result);
+}
@@ -0,0 +1,35 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/integral_constant.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <tuple>
+#include <utility>
+namespace hana = boost::hana;
+
+
+// The pairs are stored in a tuple and each value is retrieved by its index,
+// which is the least we can expect from a map in terms of executable size.
+template <typename Tuple, std::size_t ...i>
+int sum(Tuple const& tuple, std::index_sequence<i...>) {
+    int result = 0;
+    int expand[] = {0, (result += std::get<i>(tuple).second, 0)...};
+    (void)expand;
+    return result;
+}
+
+int main() {
+    auto tuple = std::make_tuple(
+        <%= (1..input_size).map { |n|
+            "std::make_pair(hana::int_c<#{n}>, std::rand())"
+        }.join(', ') %>
+    );
+    hana::benchmark::do_not_optimize(tuple);
+
+    int result = sum(tuple, std::make_index_sequence<std::tuple_size<decltype(tuple)>::value>{});
+    hana::benchmark::do_not_optimize(result);
+}
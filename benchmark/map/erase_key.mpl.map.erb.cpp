@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/erase_key.hpp>
+#include <boost/mpl/has_key.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+namespace mpl = boost::mpl;
+
+
+using map = <%= mpl_map((0..input_size).map { |n|
+    ["mpl::int_<#{n}>", "mpl::int_<#{n}>"]
+}) %>;
+
+// Erase a key in the middle of the map, and perform a lookup to force
+// the resulting map to be computed.
+using result = mpl::erase_key<map, mpl::int_<<%= input_size / 2 %>>>::type;
+static_assert(!mpl::has_key<result, mpl::int_<<%= input_size / 2 %>>>::type::value, "");
+
+
+int main() { }
@@ -0,0 +1,23 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // Every key appears twice, so half of the insertions must be discarded.
+    constexpr auto pairs = hana::make_tuple(
+        <%= ((1..input_size).to_a * 2).map { |n|
+            "hana::make_pair(hana::int_c<#{n}>, hana::int_c<#{n}>)"
+        }.join(', ') %>
+    );
+    constexpr auto result = hana::fold_left(pairs, hana::make_map(), hana::insert);
+    (void)result;
+}
@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/vector.hpp>
+namespace mpl = boost::mpl;
+
+
+// Every key appears twice, so half of the insertions must be discarded.
+using pairs = <%= mpl_vector(((1..input_size).to_a * 2).map { |n|
+    "mpl::pair<mpl::int_<#{n}>, mpl::int_<#{n}>>"
+}) %>;
+
+using result = mpl::fold<pairs, mpl::map0<>, mpl::insert<mpl::_1, mpl::_2>>::type;
+
+
+int main() { }
@@ -0,0 +1,21 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/has_key.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+namespace mpl = boost::mpl;
+
+
+using map = <%= mpl_map((1..input_size).map { |n|
+    ["mpl::int_<#{n}>", "mpl::int_<#{n}>"]
+}) %>;
+
+// Perform a single lookup to force the map to be computed.
+static_assert(!mpl::has_key<map, mpl::int_<0>>::type::value, "");
+
+
+int main() { }
@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // The two maps have half of their keys in common.
+    constexpr auto xs = hana::make_map(
+        <%= (0...input_size).map { |n| "hana::make_pair(hana::int_c<#{n}>, hana::int_c<#{n}>)" }.join(', ') %>
+    );
+    constexpr auto ys = hana::make_map(
+        <%= (input_size/2...input_size/2 + input_size).map { |n| "hana::make_pair(hana::int_c<#{n}>, hana::int_c<#{-n}>)" }.join(', ') %>
+    );
+
+    // Merge the maps one element at a time, like union_ and difference
+    // used to be implemented for sets.
+<% if env[:operation] == 'union' %>
+    constexpr auto result = hana::fold_left(xs, ys, hana::insert);
+<% else %>
+    constexpr auto result = hana::fold_left(hana::keys(ys), xs, hana::erase_key);
+<% end %>
+    (void)result;
+}
@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+<% function = env[:operation] == 'union' ? 'union_' : env[:operation] %>
+
+#include <boost/hana/<%= env[:operation] %>.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // The two maps have half of their keys in common.
+    constexpr auto xs = hana::make_map(
+        <%= (0...input_size).map { |n| "hana::make_pair(hana::int_c<#{n}>, hana::int_c<#{n}>)" }.join(', ') %>
+    );
+    constexpr auto ys = hana::make_map(
+        <%= (input_size/2...input_size/2 + input_size).map { |n| "hana::make_pair(hana::int_c<#{n}>, hana::int_c<#{-n}>)" }.join(', ') %>
+    );
+    constexpr auto result = hana::<%= function %>(xs, ys);
+    (void)result;
+}
@@ -5,24 +5,208 @@
 #ifndef BOOST_HANA_BENCHMARK_MEASURE_HPP
 #define BOOST_HANA_BENCHMARK_MEASURE_HPP
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <vector>
+
+#if defined(__linux__)
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#   define BOOST_HANA_BENCHMARK_HAS_PERF_EVENTS
+#endif
 
 
 namespace boost { namespace hana { namespace benchmark {
-    auto measure = [](auto f) {
-        constexpr auto repetitions = 500ull;
-        auto start = std::chrono::steady_clock::now();
-        for (auto i = repetitions; i > 0; --i) {
-            f();
+    //////////////////////////////////////////////////////////////////////////
+    // Optimization barriers
+    //////////////////////////////////////////////////////////////////////////
+    // `do_not_optimize(x)` forces `x` to be materialized, and makes the
+    // compiler assume that `x` may have been read and modified. `clobber()`
+    // makes the compiler assume that all the memory which has escaped (e.g.
+    // through `do_not_optimize`) may have been read and modified.
+#if defined(__GNUC__) || defined(__clang__)
+    template <typename T>
+    inline void do_not_optimize(T& value)
+    { asm volatile("" : "+m"(value) : : "memory"); }
+
+    template <typename T>
+    inline void do_not_optimize(T const& value)
+    { asm volatile("" : : "r,m"(value) : "memory"); }
+
+    inline void clobber()
+    { asm volatile("" : : : "memory"); }
+#else
+    namespace detail {
+        inline void escape(void const volatile*) { }
+        static void (* volatile escape_ptr)(void const volatile*) = &escape;
+    }
+
+    template <typename T>
+    inline void do_not_optimize(T const& value)
+    { detail::escape_ptr(&value); }
+
+    inline void clobber()
+    { detail::escape_ptr(nullptr); }
+#endif
+
+    //////////////////////////////////////////////////////////////////////////
+    // Hardware counters
+    //////////////////////////////////////////////////////////////////////////
+    // Counts the CPU cycles and the instructions retired in user space by
+    // the current thread, when the platform and its permissions allow it.
+#if defined(BOOST_HANA_BENCHMARK_HAS_PERF_EVENTS)
+    struct hardware_counters {
+        hardware_counters() {
+            cycles_ = open(PERF_COUNT_HW_CPU_CYCLES, -1);
+            if (cycles_ != -1)
+                instructions_ = open(PERF_COUNT_HW_INSTRUCTIONS, cycles_);
+        }
+
+        hardware_counters(hardware_counters const&) = delete;
+        hardware_counters& operator=(hardware_counters const&) = delete;
+
+        ~hardware_counters() {
+            if (instructions_ != -1) ::close(instructions_);
+            if (cycles_ != -1) ::close(cycles_);
+        }
+
+        bool available() const
+        { return cycles_ != -1 && instructions_ != -1; }
+
+        void start() {
+            ::ioctl(cycles_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ::ioctl(cycles_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+
+        void stop() {
+            ::ioctl(cycles_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            struct { std::uint64_t nr, values[2]; } group{};
+            if (::read(cycles_, &group, sizeof(group)) == sizeof(group)) {
+                cycles = group.values[0];
+                instructions = group.values[1];
+            }
         }
-        auto stop = std::chrono::steady_clock::now();
 
-        auto time = std::chrono::duration_cast<std::chrono::duration<float>>(
-            (stop - start) / repetitions
-        );
-        std::cout << std::fixed;
-        std::cout << "[execution time: " << time.count() << "]" << std::endl;
+        std::uint64_t cycles = 0;
+        std::uint64_t instructions = 0;
+
+    private:
+        static int open(std::uint64_t config, int group_leader) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = config;
+            attr.disabled = group_leader == -1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            return static_cast<int>(::syscall(__NR_perf_event_open, &attr,
+                                              0, -1, group_leader, 0));
+        }
+
+        int cycles_ = -1;
+        int instructions_ = -1;
+    };
+#else
+    struct hardware_counters {
+        bool available() const { return false; }
+        void start() { }
+        void stop() { }
+        std::uint64_t cycles = 0;
+        std::uint64_t instructions = 0;
+    };
+#endif
+
+    //////////////////////////////////////////////////////////////////////////
+    // Statistics
+    //////////////////////////////////////////////////////////////////////////
+    // Returns the `p`-th percentile of the sorted samples `xs`, with a linear
+    // interpolation between the closest ranks.
+    inline double percentile(std::vector<double> const& xs, double p) {
+        double rank = p / 100 * (xs.size() - 1);
+        std::size_t below = static_cast<std::size_t>(std::floor(rank));
+        std::size_t above = static_cast<std::size_t>(std::ceil(rank));
+        return xs[below] + (rank - below) * (xs[above] - xs[below]);
+    }
+
+    // Returns the median absolute deviation of the samples `xs` around
+    // their median.
+    inline double median_absolute_deviation(std::vector<double> const& xs,
+                                            double median)
+    {
+        std::vector<double> deviations;
+        for (double x : xs)
+            deviations.push_back(std::abs(x - median));
+        std::sort(deviations.begin(), deviations.end());
+        return percentile(deviations, 50);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // measure
+    //////////////////////////////////////////////////////////////////////////
+    // Measures the time taken by a single call to `f` and prints statistics
+    // about it in the format expected by `measure.rb`.
+    //
+    // `f` is first called repeatedly for a warmup period. Then, the number
+    // of calls per sample is doubled until a sample takes long enough to be
+    // measured accurately with the steady clock, and the time of a single
+    // call is computed for each of a fixed number of samples. The median
+    // is reported as the execution time, and it is accompanied by the
+    // median absolute deviation and some percentiles, all in seconds.
+    //
+    // `f` must use `do_not_optimize` and `clobber` to make sure that the
+    // work being measured is not optimized away.
+    auto measure = [](auto f) {
+        using clock = std::chrono::steady_clock;
+        using seconds = std::chrono::duration<double>;
+        constexpr auto warmup_time = std::chrono::milliseconds{50};
+        constexpr auto min_sample_time = std::chrono::milliseconds{1};
+        constexpr std::size_t samples = 50;
+        constexpr std::uint64_t max_iterations = 1ull << 30;
+
+        auto run = [&](std::uint64_t iterations) {
+            auto start = clock::now();
+            for (auto i = iterations; i > 0; --i)
+                f();
+            return clock::now() - start;
+        };
+
+        for (auto start = clock::now(); clock::now() - start < warmup_time; )
+            run(1);
+
+        std::uint64_t iterations = 1;
+        while (run(iterations) < min_sample_time && iterations < max_iterations)
+            iterations *= 2;
+
+        hardware_counters counters;
+        std::vector<double> times;
+        if (counters.available())
+            counters.start();
+        for (std::size_t i = 0; i != samples; ++i)
+            times.push_back(seconds{run(iterations)}.count() / iterations);
+        if (counters.available())
+            counters.stop();
+
+        std::sort(times.begin(), times.end());
+        double median = percentile(times, 50);
+
+        std::cout << std::scientific;
+        std::cout << "[execution time: " << median << "]" << std::endl;
+        std::cout << "[execution time mad: "
+                  << median_absolute_deviation(times, median) << "]" << std::endl;
+        std::cout << "[execution time p5: " << percentile(times, 5) << "]" << std::endl;
+        std::cout << "[execution time p95: " << percentile(times, 95) << "]" << std::endl;
+        if (counters.available()) {
+            double calls = static_cast<double>(samples * iterations);
+            std::cout << "[cycles: " << counters.cycles / calls << "]" << std::endl;
+            std::cout << "[instructions: " << counters.instructions / calls << "]" << std::endl;
+        }
     };
 }}}
 
@@ -7,7 +7,10 @@
 #
 # When called as a program, this script runs the command line given in
 # arguments and returns the total time. This is similar to the `time`
-# command from Bash.
+# command from Bash. It also reports the peak memory used by the command,
+# the size of the object file it produced and, when the compiler was asked
+# for a `-ftime-trace` profile, a breakdown of the time spent in the
+# compiler.
 #
 # This file can also be required as a Ruby module to gain access to the
 # methods defined below.
@@ -16,6 +19,7 @@
 # This file must not be used as-is. It must be processed by CMake first.
 
 require 'benchmark'
+require 'json'
 require 'open3'
 require 'pathname'
 require 'ruby-progressbar'
@@ -50,6 +54,29 @@ def mpl_list(types)
   }
 end
 
+# pairs : A sequence of [key, value] string pairs to put in the mpl::map.
+# Using this method requires including
+#   - <boost/mpl/map.hpp>
+#   - <boost/mpl/insert.hpp>
+#   - <boost/mpl/pair.hpp>
+def mpl_map(pairs)
+  fast, rest = split_at(20, pairs.map { |k, v| "boost::mpl::pair<#{k}, #{v}>" })
+  rest.inject("boost::mpl::map#{fast.length}<#{fast.join(', ')}>") { |m, p|
+    "boost::mpl::insert<#{m}, #{p}>::type"
+  }
+end
+
+# types : A sequence of strings to put in the mpl::set.
+# Using this method requires including
+#   - <boost/mpl/set.hpp>
+#   - <boost/mpl/insert.hpp>
+def mpl_set(types)
+  fast, rest = split_at(20, types)
+  rest.inject("boost::mpl::set#{fast.length}<#{fast.join(', ')}>") { |s, t|
+    "boost::mpl::insert<#{s}, #{t}>::type"
+  }
+end
+
 # values : A sequence of strings representing values to put in the fusion::vector.
 # Using this method requires including
 #   - <boost/fusion/include/make_vector.hpp>
@@ -79,11 +106,48 @@ def cmake_bool(b)
   return false # otherwise
 end
 
+# The secondary metrics reported alongside the compilation time of each
+# datapoint, along with the regular expression used to extract them from
+# the output of this script when it is used as a compiler launcher.
+COMPILATION_METRICS = {
+  peak_memory:        /\[peak memory: (.+)\]/i,
+  object_size:        /\[object size: (.+)\]/i,
+  debug_info_size:    /\[debug info size: (.+)\]/i,
+  instantiation_time: /\[template instantiation time: (.+)\]/i,
+  constexpr_time:     /\[constexpr evaluation time: (.+)\]/i,
+  frontend_time:      /\[frontend time: (.+)\]/i
+}
+
+# The secondary metrics reported alongside the execution time of each
+# datapoint by the `measure` function of the `measure.hpp` header.
+EXECUTION_METRICS = {
+  execution_mad:  /\[execution time mad: (.+)\]/i,
+  execution_p5:   /\[execution time p5: (.+)\]/i,
+  execution_p95:  /\[execution time p95: (.+)\]/i,
+  cycles:         /\[cycles: (.+)\]/i,
+  instructions:   /\[instructions: (.+)\]/i
+}
+
+# A sequence of datapoints, which renders as a JSON array of Highcharts
+# point objects when it is interpolated into an ERB template. The `y`
+# coordinate of each point is the measured aspect, and the other metrics
+# are stored alongside so that the chart can plot them instead.
+class Dataset < Array
+  def to_s
+    to_json
+  end
+end
+
 # aspect must be one of :compilation_time, :bloat, :execution_time
+#
+# When the environment contains a `prebuilt` key, which must be either
+# 'pch' or 'module', the template is compiled with the flags making the
+# corresponding prebuilt version of <boost/hana.hpp> available.
 def measure(aspect, template_relative, range, env = {})
   measure_file = Pathname.new("#{MEASURE_FILE}")
   template = Pathname.new(template_relative).expand_path
   range = range.to_a
+  measure_target = env[:prebuilt] ? "#{MEASURE_TARGET}.#{env[:prebuilt]}" : MEASURE_TARGET
 
   if ENV["BOOST_HANA_JUST_CHECK_BENCHMARKS"] && range.length >= 2
     range = [range[0], range[-1]]
@@ -98,7 +162,7 @@ def measure(aspect, template_relative, range, env = {})
                                 title: template_relative,
                                 total: range.size,
                                 output: STDERR)
-  range.map do |n|
+  Dataset.new(range.map do |n|
     # Evaluate the ERB template with the given environment, and save
     # the result in the `measure.cpp` file.
     code = Tilt::ERBTemplate.new(template).render(nil, input_size: n, env: env)
@@ -107,25 +171,29 @@ def measure(aspect, template_relative, range, env = {})
     # Compile the file and get timing statistics. The timing statistics
     # are output to stdout when we compile the file because of the way
     # the `compile.benchmark.measure` CMake target is setup.
-    stdout, stderr, status = make["#{MEASURE_TARGET}"]
+    stdout, stderr, status = make[measure_target]
     raise "compilation error: #{stdout}\n\n#{stderr}\n\n#{code}" if not status.success?
     ctime = stdout.match(/\[compilation time: (.+)\]/i)
     # Size of the generated executable in KB
-    size = File.size("@CMAKE_CURRENT_BINARY_DIR@/#{MEASURE_TARGET}").to_f / 1000
+    size = File.size("@CMAKE_CURRENT_BINARY_DIR@/#{measure_target}").to_f / 1000
 
     # If we didn't match anything, that's because we went too fast, CMake
     # did not have the time to see the changes to the measure file and
     # the target was not rebuilt. So we sleep for a bit and then retry
     # this iteration.
     (sleep 0.2; redo) if ctime.nil?
-    stat = ctime.captures[0].to_f if aspect == :compilation_time
-    stat = size if aspect == :bloat
+    metrics = { compilation_time: ctime.captures[0].to_f, bloat: size }
+    COMPILATION_METRICS.each do |metric, regex|
+      match = stdout.match(regex)
+      metrics[metric] = match.captures[0].to_f unless match.nil?
+    end
+    stat = metrics[aspect]
 
     # Run the resulting program and get timing statistics. The statistics
     # should be written to stdout by the `measure` function of the
     # `measure.hpp` header.
     if aspect == :execution_time
-      stdout, stderr, status = make["#{MEASURE_TARGET}.run"]
+      stdout, stderr, status = make["#{measure_target}.run"]
       raise "runtime error: #{stderr}\n\n#{code}" if not status.success?
       match = stdout.match(/\[execution time: (.+)\]/i)
       if match.nil?
@@ -134,11 +202,16 @@ def measure(aspect, template_relative, range, env = {})
                "stdout follows:\n#{stdout}")
       end
       stat = match.captures[0].to_f
+      metrics[:execution_time] = stat
+      EXECUTION_METRICS.each do |metric, regex|
+        match = stdout.match(regex)
+        metrics[metric] = match.captures[0].to_f unless match.nil?
+      end
     end
 
     progress.increment
-    [n, stat]
-  end
+    metrics.merge(x: n, y: stat)
+  end)
 ensure
   measure_file.write("")
   progress.finish if progress
@@ -152,10 +225,73 @@ def time_compilation(erb_file, range, env = {})
   measure(:compilation_time, erb_file, range, env)
 end
 
+# Returns the peak resident set size of the terminated children of this
+# process in KB, or nil if it can't be determined on this platform.
+def peak_children_memory
+  require 'fiddle'
+  getrusage = Fiddle::Function.new(Fiddle::Handle::DEFAULT['getrusage'],
+                                   [Fiddle::TYPE_INT, Fiddle::TYPE_VOIDP],
+                                   Fiddle::TYPE_INT)
+  rusage = Fiddle::Pointer.malloc(256) # larger than any struct rusage
+  rusage_children = -1
+  return nil if getrusage.call(rusage_children, rusage) != 0
+
+  # ru_maxrss follows the ru_utime and ru_stime timevals.
+  maxrss = rusage[2 * 2 * Fiddle::SIZEOF_LONG, Fiddle::SIZEOF_LONG].unpack('l!').first
+  RUBY_PLATFORM =~ /darwin/ ? maxrss / 1024 : maxrss # bytes on OS X
+rescue LoadError, Fiddle::DLError
+  nil
+end
+
+# Returns the total size in KB of the debug information sections of the
+# given object file, or nil if the `size` tool is not available.
+def debug_info_size(object)
+  stdout, status = Open3.capture2('size', '-A', object)
+  return nil if not status.success?
+  bytes = stdout.lines.map(&:split)
+                .select { |section, _| section =~ /^[._]+z?debug/ }
+                .map { |_, size| size.to_i }
+  bytes.inject(0, :+).to_f / 1000
+rescue SystemCallError
+  nil
+end
+
+# Returns the time in seconds spent in the given phases, according to a
+# `-ftime-trace` profile produced by Clang.
+def time_trace_total(events, *phases)
+  phases.map { |phase|
+    events.select { |e| e['name'] == "Total #{phase}" }
+          .map { |e| e['dur'] }.inject(0, :+)
+  }.inject(0, :+).to_f / 1e6
+end
+
 if __FILE__ == $0
   command = ARGV.join(' ')
   time = Benchmark.realtime { `#{command}` }
 
   puts "[command line: #{command}]"
   puts "[compilation time: #{time}]"
+
+  memory = peak_children_memory
+  puts "[peak memory: #{memory}]" unless memory.nil?
+
+  output = ARGV[ARGV.index('-o') + 1] if ARGV.include?('-o')
+  if output && File.exist?(output)
+    puts "[object size: #{File.size(output).to_f / 1000}]"
+    debug_info = debug_info_size(output)
+    puts "[debug info size: #{debug_info}]" unless debug_info.nil?
+
+    # Clang writes the -ftime-trace profile next to the object file.
+    trace = output.sub(/\.[^.\/]*\z/, '') + '.json'
+    if ARGV.include?('-ftime-trace') && File.exist?(trace)
+      events = JSON.parse(File.read(trace))['traceEvents']
+      instantiation = time_trace_total(events, 'InstantiateClass', 'InstantiateFunction')
+      constexpr = time_trace_total(events, 'EvaluateAsRValue', 'EvaluateAsBooleanCondition',
+                                           'EvaluateAsConstantExpr', 'EvaluateAsInitializer',
+                                           'EvaluateForOverflow')
+      puts "[template instantiation time: #{instantiation}]"
+      puts "[constexpr evaluation time: #{constexpr}]"
+      puts "[frontend time: #{time_trace_total(events, 'Frontend')}]"
+    end
+  end
 end
@@ -0,0 +1,22 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/for_each_permutation.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+template <int i>
+struct x { };
+
+struct f {
+    template <typename Permutation>
+    constexpr void operator()(Permutation const&) const { }
+};
+
+int main() {
+    auto xs = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    boost::hana::for_each_permutation(xs, f{});
+}
@@ -0,0 +1,21 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+// This emulates a set implemented as a tuple searched linearly, which
+// is how `hana::set` used to be implemented.
+int main() {
+    constexpr auto set = hana::make_tuple(
+        <%= (1..input_size).map { |n| "hana::int_c<#{n}>" }.join(', ') %>
+    );
+
+    <% (1..input_size).each do |n| %>
+        static_assert(decltype(hana::contains(set, hana::int_c<<%= n %>>))::value, "");
+    <% end %>
+}
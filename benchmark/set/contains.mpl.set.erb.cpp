@@ -0,0 +1,19 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpl/has_key.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/set.hpp>
+namespace mpl = boost::mpl;
+
+
+using set = <%= mpl_set((1..input_size).map { |n| "mpl::int_<#{n}>" }) %>;
+
+<% (1..input_size).each do |n| %>
+    static_assert(mpl::has_key<set, mpl::int_<<%= n %>>>::type::value, "");
+<% end %>
+
+
+int main() { }
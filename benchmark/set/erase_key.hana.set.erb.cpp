@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/set.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    constexpr auto set = hana::make_set(
+        <%= (0..input_size).map { |n| "hana::int_c<#{n}>" }.join(', ') %>
+    );
+    // Erase an element in the middle of the set, and perform a lookup to
+    // force the resulting set to be computed.
+    constexpr auto result = hana::erase_key(set, hana::int_c<<%= input_size / 2 %>>);
+    static_assert(!decltype(hana::contains(result, hana::int_c<<%= input_size / 2 %>>))::value, "");
+}
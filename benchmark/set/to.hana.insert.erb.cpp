@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    // Every element appears twice, so half of them must be discarded.
+    constexpr auto tuple = hana::make_tuple(
+        <%= ((1..input_size).to_a * 2).map { |n| "hana::int_c<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = hana::fold_left(tuple, hana::make_set(), hana::insert);
+    (void)result;
+}
@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+// This emulates a set implemented as a tuple searched linearly, which
+// is how `hana::set` used to be implemented.
+struct insert_if_absent {
+    template <typename Xs, typename X>
+    constexpr auto operator()(Xs xs, X x) const {
+        return hana::if_(hana::contains(xs, x), xs, hana::append(xs, x));
+    }
+};
+
+int main() {
+    // Every element appears twice, so half of them must be discarded.
+    constexpr auto tuple = hana::make_tuple(
+        <%= ((1..input_size).to_a * 2).map { |n| "hana::int_c<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = hana::fold_left(tuple, hana::make_tuple(), insert_if_absent{});
+    (void)result;
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/string.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <vector>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        <%= (0...input_size).map { |i| "(double, m#{i})" }.join(",\n        ") %>
+    );
+};
+
+int main () {
+    std::vector<Record> records;
+    records.reserve(65536);
+    for (std::size_t i = 0; i != 65536; ++i) {
+        Record record{};
+        record.m0 = static_cast<double>(i);
+        records.push_back(record);
+    }
+
+    boost::hana::benchmark::measure([&] {
+        double sum = 0;
+        for (Record const& record : records)
+            sum += record.m0;
+        boost::hana::benchmark::do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,22 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ordering.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { char data[i]; };
+
+int main() {
+    constexpr auto types = hana::make_tuple(
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size))
+                           .map { |n| "hana::type_c<x<#{n}>>" }.join(', ') %>
+    );
+    constexpr auto result = hana::sort(types, hana::ordering(hana::sizeof_));
+    (void)result;
+}
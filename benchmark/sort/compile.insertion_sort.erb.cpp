@@ -0,0 +1,24 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "insertion_sort.hpp"
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+<%
+  xs = (1..input_size).to_a
+  xs = xs.shuffle(random: Random.new(input_size)) if env[:order] == :random
+  xs = xs.reverse if env[:order] == :reversed
+%>
+
+int main() {
+    constexpr auto tuple = hana::make_tuple(
+        <%= xs.map { |n| "hana::int_c<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = insertion_sort(tuple, hana::less);
+    (void)result;
+}
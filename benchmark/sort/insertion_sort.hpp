@@ -0,0 +1,124 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_BENCHMARK_SORT_INSERTION_SORT_HPP
+#define BOOST_HANA_BENCHMARK_SORT_INSERTION_SORT_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+// This is the insertion sort that was used to implement `hana::sort`
+// before it was replaced by a merge sort. It is kept here so that both
+// implementations can be compared.
+namespace insertion_sort_detail {
+    namespace hana = boost::hana;
+
+    template <typename Xs, typename Pred>
+    struct sort_predicate {
+        template <std::size_t I, std::size_t J>
+        using apply = decltype(std::declval<Pred>()(
+            hana::at_c<I>(std::declval<Xs>()),
+            hana::at_c<J>(std::declval<Xs>())
+        ));
+    };
+
+    template <typename Pred, std::size_t Insert, bool IsInsertionPoint,
+              typename Left,
+              std::size_t ...Right>
+    struct insert;
+
+    // We did not find the insertion point; continue processing elements
+    // recursively.
+    template <
+        typename Pred, std::size_t Insert,
+        std::size_t ...Left,
+        std::size_t Right1, std::size_t Right2, std::size_t ...Right
+    >
+    struct insert<Pred, Insert, false,
+                  std::index_sequence<Left...>,
+                  Right1, Right2, Right...
+    > {
+        using type = typename insert<
+            Pred, Insert, (bool)Pred::template apply<Insert, Right2>::value,
+            std::index_sequence<Left..., Right1>,
+            Right2, Right...
+        >::type;
+    };
+
+    // We did not find the insertion point, but there is only one element
+    // left. We insert at the end of the list, and we're done.
+    template <typename Pred, std::size_t Insert, std::size_t ...Left, std::size_t Last>
+    struct insert<Pred, Insert, false, std::index_sequence<Left...>, Last> {
+        using type = std::index_sequence<Left..., Last, Insert>;
+    };
+
+    // We found the insertion point, we're done.
+    template <typename Pred, std::size_t Insert, std::size_t ...Left, std::size_t ...Right>
+    struct insert<Pred, Insert, true, std::index_sequence<Left...>, Right...> {
+        using type = std::index_sequence<Left..., Insert, Right...>;
+    };
+
+    template <typename Pred, typename Result, std::size_t ...T>
+    struct insertion_sort_impl;
+
+    template <typename Pred,
+              std::size_t Result1, std::size_t ...Result,
+              std::size_t T, std::size_t ...Ts>
+    struct insertion_sort_impl<Pred, std::index_sequence<Result1, Result...>, T, Ts...> {
+        using type = typename insertion_sort_impl<
+            Pred,
+            typename insert<
+                Pred, T, (bool)Pred::template apply<T, Result1>::value,
+                std::index_sequence<>,
+                Result1, Result...
+            >::type,
+            Ts...
+        >::type;
+    };
+
+    template <typename Pred, std::size_t T, std::size_t ...Ts>
+    struct insertion_sort_impl<Pred, std::index_sequence<>, T, Ts...> {
+        using type = typename insertion_sort_impl<
+            Pred, std::index_sequence<T>, Ts...
+        >::type;
+    };
+
+    template <typename Pred, typename Result>
+    struct insertion_sort_impl<Pred, Result> {
+        using type = Result;
+    };
+
+    template <typename Pred, typename Indices>
+    struct sort_helper;
+
+    template <typename Pred, std::size_t ...i>
+    struct sort_helper<Pred, std::index_sequence<i...>> {
+        using type = typename insertion_sort_impl<
+            Pred, std::index_sequence<>, i...
+        >::type;
+    };
+
+    template <typename Xs, std::size_t ...i>
+    constexpr auto apply_impl(Xs&& xs, std::index_sequence<i...>) {
+        return hana::make_tuple(hana::at_c<i>(static_cast<Xs&&>(xs))...);
+    }
+} // end namespace insertion_sort_detail
+
+template <typename Xs, typename Pred>
+constexpr auto insertion_sort(Xs&& xs, Pred const&) {
+    constexpr std::size_t Len = decltype(boost::hana::length(xs))::value;
+    using Indices = typename insertion_sort_detail::sort_helper<
+        insertion_sort_detail::sort_predicate<Xs&&, Pred>,
+        std::make_index_sequence<Len>
+    >::type;
+
+    return insertion_sort_detail::apply_impl(static_cast<Xs&&>(xs), Indices{});
+}
+
+#endif // !BOOST_HANA_BENCHMARK_SORT_INSERTION_SORT_HPP
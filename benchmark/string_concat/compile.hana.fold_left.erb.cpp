@@ -0,0 +1,19 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+int main() {
+    constexpr auto strings = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n|
+              "boost::hana::string_c<#{("%08d" % n).chars.map { |c| "'#{c}'" }.join(', ')}>"
+            }.join(",\n        ") %>
+    );
+    constexpr auto result = boost::hana::fold_left(strings, boost::hana::string_c<>, boost::hana::plus);
+    (void)result;
+}
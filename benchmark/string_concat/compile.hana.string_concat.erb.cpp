@@ -0,0 +1,15 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/string.hpp>
+
+
+int main() {
+    constexpr auto result = boost::hana::string_concat(
+        <%= (1..input_size).map { |n|
+              "boost::hana::string_c<#{("%08d" % n).chars.map { |c| "'#{c}'" }.join(', ')}>"
+            }.join(",\n        ") %>
+    );
+    (void)result;
+}
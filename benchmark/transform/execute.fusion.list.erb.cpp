@@ -17,17 +17,16 @@ namespace hana = boost::hana;
 
 
 int main () {
-    hana::benchmark::measure([] {
-        long long result = 0;
-        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
-            auto values = fusion::make_list(
-                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
-            );
+    auto values = fusion::make_list(
+        <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+    );
 
-            auto transformed = fusion::as_list(fusion::transform(values, [&](auto t) {
-                return result += t;
-            }));
-            (void)transformed;
-        }
+    hana::benchmark::measure([&] {
+        hana::benchmark::do_not_optimize(values);
+        long long result = 0;
+        auto transformed = fusion::as_list(fusion::transform(values, [&](auto t) {
+            return result += t;
+        }));
+        hana::benchmark::do_not_optimize(transformed);
     });
 }
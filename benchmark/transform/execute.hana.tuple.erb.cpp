@@ -10,17 +10,16 @@
 
 
 int main () {
-    boost::hana::benchmark::measure([] {
-        long long result = 0;
-        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
-            auto values = boost::hana::make_tuple(
-                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
-            );
+    auto values = boost::hana::make_tuple(
+        <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+    );
 
-            auto transformed = boost::hana::transform(values, [&](auto t) {
-                return result += t;
-            });
-            (void)transformed;
-        }
+    boost::hana::benchmark::measure([&] {
+        boost::hana::benchmark::do_not_optimize(values);
+        long long result = 0;
+        auto transformed = boost::hana::transform(values, [&](auto t) {
+            return result += t;
+        });
+        boost::hana::benchmark::do_not_optimize(transformed);
     });
 }
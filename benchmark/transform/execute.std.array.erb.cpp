@@ -9,18 +9,17 @@
 
 
 int main () {
-    boost::hana::benchmark::measure([] {
-        long long result = 0;
-        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
-            std::array<int, <%= input_size %>> values = {{
-                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
-            }};
-
-            std::array<long long, <%= input_size %>> results{};
+    std::array<int, <%= input_size %>> values = {{
+        <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+    }};
 
-            std::transform(values.begin(), values.end(), results.begin(), [&](auto t) {
-                return result += t;
-            });
-        }
+    boost::hana::benchmark::measure([&] {
+        boost::hana::benchmark::do_not_optimize(values);
+        long long result = 0;
+        std::array<long long, <%= input_size %>> results;
+        std::transform(values.begin(), values.end(), results.begin(), [&](auto t) {
+            return result += t;
+        });
+        boost::hana::benchmark::do_not_optimize(results);
     });
 }
@@ -9,19 +9,19 @@
 
 
 int main () {
-    boost::hana::benchmark::measure([] {
-        long long result = 0;
-        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
-            std::vector<int> values = {
-                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
-            };
-
-            std::vector<long long> results;
-            results.reserve(<%= input_size %>);
+    std::vector<int> values = {
+        <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+    };
+    std::vector<long long> results(values.size());
 
-            std::transform(values.begin(), values.end(), results.begin(), [&](auto t) {
-                return result += t;
-            });
-        }
+    boost::hana::benchmark::measure([&] {
+        boost::hana::benchmark::do_not_optimize(values);
+        boost::hana::benchmark::clobber();
+        long long result = 0;
+        std::transform(values.begin(), values.end(), results.begin(), [&](auto t) {
+            return result += t;
+        });
+        boost::hana::benchmark::do_not_optimize(results);
+        boost::hana::benchmark::clobber();
     });
 }
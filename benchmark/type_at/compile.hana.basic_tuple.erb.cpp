@@ -0,0 +1,22 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/integral_constant.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+    constexpr hana::basic_tuple<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    > tuple{};
+
+    <% (0...input_size).each do |n| %>
+        (void)hana::at_c<<%= n %>>(tuple);
+    <% end %>
+}
@@ -0,0 +1,21 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/integral_constant.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+    using Types = hana::experimental::types<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >;
+
+    <% (0...input_size).each do |n| %>
+        (void)hana::at(Types{}, hana::size_c<<%= n %>>);
+    <% end %>
+}
@@ -0,0 +1,18 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include "measure.hpp"
+#include <cstdlib>
+
+
+int main () {
+    long x = std::rand();
+
+    boost::hana::benchmark::measure([&] {
+        for (int i = 0; i != <%= input_size %>; ++i) {
+            x ^= i;
+            boost::hana::benchmark::do_not_optimize(x);
+        }
+    });
+}
@@ -0,0 +1,28 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+<% if env[:budget] %>
+#define BOOST_HANA_CONFIG_UNROLL_BUDGET <%= env[:budget] %>
+<% end %>
+
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+namespace hana = boost::hana;
+
+
+int main () {
+    long x = std::rand();
+
+    hana::benchmark::measure([&] {
+        auto range = hana::make_range(hana::int_c<0>, hana::int_c<<%= input_size %>>);
+        hana::for_each(range, [&](int i) {
+            x ^= i;
+            hana::benchmark::do_not_optimize(x);
+        });
+    });
+}
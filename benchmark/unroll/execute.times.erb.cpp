@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+<% if env[:budget] %>
+#define BOOST_HANA_CONFIG_UNROLL_BUDGET <%= env[:budget] %>
+<% end %>
+
+#include <boost/hana/integral_constant.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+namespace hana = boost::hana;
+
+
+int main () {
+    long x = std::rand();
+
+    hana::benchmark::measure([&] {
+        hana::int_c<<%= input_size %>>.times([&] {
+            x = x * 31 + 7;
+            hana::benchmark::do_not_optimize(x);
+        });
+
+        hana::int_c<<%= input_size %>>.times.with_index([&](int i) {
+            x ^= i;
+            hana::benchmark::do_not_optimize(x);
+        });
+    });
+}
@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/value_hash.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+
+
+struct Key {
+    BOOST_HANA_DEFINE_STRUCT(Key,
+        <%= (0...input_size).map { |i| "(int, member#{i})" }.join(", ") %>
+    );
+};
+
+using Hash = boost::hana::experimental::value_hash;
+
+int main () {
+    std::vector<Key> keys(1024);
+    for (Key& key : keys) {
+        <%= (0...input_size).map { |i| "key.member#{i} = std::rand() % 4;" }.join(" ") %>
+    }
+
+    boost::hana::benchmark::measure([&] {
+        std::unordered_map<Key, int, Hash, boost::hana::experimental::value_equal> map;
+        for (Key const& key : keys)
+            ++map[key];
+        int result = 0;
+        for (Key const& key : keys)
+            result += map.find(key)->second;
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/filter.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+template <int i>
+struct x { };
+
+struct f {
+    template <int i>
+    constexpr x<i> operator()(x<i>) const { return {}; }
+};
+
+struct is_even {
+    template <int i>
+    constexpr auto operator()(x<i>) const { return boost::hana::bool_c<i % 2 == 0>; }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    constexpr auto result = boost::hana::transform(
+        boost::hana::filter(boost::hana::transform(tuple, f{}), is_even{}),
+        f{}
+    );
+    (void)result;
+}
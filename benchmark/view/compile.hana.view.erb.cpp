@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+template <int i>
+struct x { };
+
+struct f {
+    template <int i>
+    constexpr x<i> operator()(x<i>) const { return {}; }
+};
+
+struct is_even {
+    template <int i>
+    constexpr auto operator()(x<i>) const { return boost::hana::bool_c<i % 2 == 0>; }
+};
+
+int main() {
+    auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "x<#{n}>{}" }.join(', ') %>
+    );
+    auto transformed = boost::hana::experimental::transformed(tuple, f{});
+    auto filtered = boost::hana::experimental::filtered(transformed, is_even{});
+    auto pipeline = boost::hana::experimental::transformed(filtered, f{});
+    auto result = boost::hana::to<boost::hana::tuple_tag>(pipeline);
+    (void)result;
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <type_traits>
+
+
+struct is_integral {
+    template <typename X>
+    constexpr auto operator()(X const&) const
+    { return boost::hana::bool_c<std::is_integral<X>::value>; }
+};
+
+int main () {
+    auto values = boost::hana::make_tuple(
+        <%= input_size.times.map { |i|
+            i.even? ? 'std::rand()' : 'static_cast<double>(std::rand())'
+        }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        boost::hana::benchmark::do_not_optimize(values);
+        auto twice = [](auto x) { return x * 2; };
+        auto increment = [](auto x) { return x + 1; };
+        auto transformed = boost::hana::experimental::transformed(values, twice);
+        auto filtered = boost::hana::experimental::filtered(transformed, is_integral{});
+        auto pipeline = boost::hana::experimental::transformed(filtered, increment);
+        auto result = boost::hana::to<boost::hana::tuple_tag>(pipeline);
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+template <int i>
+struct handler {
+    int operator()(int x) const { return x * <%= input_size %> + i; }
+};
+
+template <typename Handlers>
+int dispatch(Handlers const& handlers, std::size_t i, int x) {
+    switch (i) {
+        <% input_size.times do |i| %>
+        case <%= i %>: return boost::hana::at_c<<%= i %>>(handlers)(x);
+        <% end %>
+        default: return -1;
+    }
+}
+
+int main () {
+    auto handlers = boost::hana::make_tuple(
+        <%= (0...input_size).map { |i| "handler<#{i}>{}" }.join(', ') %>
+    );
+
+    std::vector<std::size_t> indices(1024);
+    for (auto& i : indices)
+        i = static_cast<std::size_t>(std::rand()) % <%= input_size %>;
+
+    boost::hana::benchmark::measure([&] {
+        int result = 0;
+        for (std::size_t i : indices)
+            result += dispatch(handlers, i, result);
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
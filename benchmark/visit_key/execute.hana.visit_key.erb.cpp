@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/visit_key.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+
+template <int i>
+struct handler {
+    int operator()(int x) const { return x * <%= input_size %> + i; }
+};
+
+template <typename Handlers>
+int dispatch(Handlers const& handlers, std::string const& key, int x) {
+    return boost::hana::visit_key(handlers, key,
+        [x](auto const& handler) { return handler(x); },
+        [] { return -1; });
+}
+
+int main () {
+    auto handlers = boost::hana::make_map(
+        <%= (0...input_size).map { |i| "boost::hana::make_pair(BOOST_HANA_STRING(\"key#{i}\"), handler<#{i}>{})" }.join(",\n        ") %>
+    );
+
+    std::vector<std::string> queries(1024);
+    for (auto& query : queries)
+        query = "key" + std::to_string(std::rand() % <%= input_size + input_size / 10 %>);
+
+    boost::hana::benchmark::measure([&] {
+        int result = 0;
+        for (std::string const& query : queries)
+            result += dispatch(handlers, query, result);
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,48 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+template <int i>
+struct handler {
+    int operator()(int x) const { return x * <%= input_size %> + i; }
+};
+
+template <typename Handlers>
+int dispatch(Handlers const& handlers, std::string const& key, int x) {
+    static std::unordered_map<std::string, std::size_t> const indices{
+        <%= (0...input_size).map { |i| "{\"key#{i}\", #{i}}" }.join(', ') %>
+    };
+    auto it = indices.find(key);
+    if (it == indices.end())
+        return -1;
+    return boost::hana::visit_at_unchecked(handlers, it->second,
+        [x](auto const& handler) { return handler(x); });
+}
+
+int main () {
+    auto handlers = boost::hana::make_tuple(
+        <%= (0...input_size).map { |i| "handler<#{i}>{}" }.join(', ') %>
+    );
+
+    std::vector<std::string> queries(1024);
+    for (auto& query : queries)
+        query = "key" + std::to_string(std::rand() % <%= input_size + input_size / 10 %>);
+
+    boost::hana::benchmark::measure([&] {
+        int result = 0;
+        for (std::string const& query : queries)
+            result += dispatch(handlers, query, result);
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,138 @@
+# Copyright Louis Dionne 2013-2016
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+#
+#
+# This CMake module creates targets prebuilding the <boost/hana.hpp> header,
+# so that translation units can load the result of parsing the whole library
+# instead of parsing it again. The textual headers are left untouched; this
+# only provides an alternative way of consuming them.
+#
+# The header is prebuilt with the compiler, flags, definitions and include
+# directories of the current directory, which should hence be setup before
+# this module is included. A prebuilt header can only be used by translation
+# units compiled with the same compiler and compatible flags; GCC rejects a
+# precompiled header when the flags differ in a way that changes predefined
+# macros, like the optimization level.
+#
+#
+# This CMake module creates the following targets:
+#
+#   hana.pch
+#       Builds a precompiled header for <boost/hana.hpp>. This is supported
+#       with GCC and Clang.
+#
+#   hana.module
+#       Builds <boost/hana.hpp> as a C++20 header unit, which can then be
+#       imported with `import <boost/hana.hpp>;`. This is supported with
+#       GCC >= 11 and Clang >= 15. Hana itself is C++14, but it is valid
+#       C++20 too, so the header unit can be used by C++20 programs.
+#
+# and sets the following variables:
+#
+#   BOOST_HANA_PCH_FLAGS
+#       The compiler flags making a translation unit use the precompiled
+#       header. The header is included before the first line of the
+#       translation unit, which must not include anything before it. This
+#       is empty when the `hana.pch` target is not available.
+#
+#   BOOST_HANA_MODULE_FLAGS
+#       The compiler flags making the header unit available to a translation
+#       unit. This is empty when the `hana.module` target is not available.
+#
+#   BOOST_HANA_HAS_PCH
+#   BOOST_HANA_HAS_MODULE
+#       Whether the above targets are available.
+
+set(BOOST_HANA_PCH_FLAGS)
+set(BOOST_HANA_MODULE_FLAGS)
+set(BOOST_HANA_HAS_PCH FALSE)
+set(BOOST_HANA_HAS_MODULE FALSE)
+
+if (NOT (${CMAKE_CXX_COMPILER_ID} STREQUAL "GNU" OR
+         ${CMAKE_CXX_COMPILER_ID} MATCHES "Clang"))
+    message(STATUS "Prebuilding <boost/hana.hpp> is not supported with "
+                   "${CMAKE_CXX_COMPILER_ID}; the 'hana.pch' and 'hana.module' "
+                   "targets will be unavailable.")
+    return()
+endif()
+
+set(_hana_header "${Boost.Hana_SOURCE_DIR}/include/boost/hana.hpp")
+set(_hana_prebuilt_dir "${CMAKE_CURRENT_BINARY_DIR}/prebuilt")
+
+# Gather the flags used to compile the translation units of this directory.
+string(TOUPPER "${CMAKE_BUILD_TYPE}" _build_type)
+separate_arguments(_hana_flags UNIX_COMMAND
+    "${CMAKE_CXX_FLAGS} ${CMAKE_CXX_FLAGS_${_build_type}}")
+get_directory_property(_options COMPILE_OPTIONS)
+get_directory_property(_definitions COMPILE_DEFINITIONS)
+get_directory_property(_includes INCLUDE_DIRECTORIES)
+list(APPEND _hana_flags ${_options})
+foreach(_definition IN LISTS _definitions)
+    list(APPEND _hana_flags "-D${_definition}")
+endforeach()
+foreach(_include IN LISTS _includes)
+    list(APPEND _hana_flags "-I${_include}")
+endforeach()
+
+
+##############################################################################
+# hana.pch
+##############################################################################
+if (${CMAKE_CXX_COMPILER_ID} STREQUAL "GNU")
+    # GCC looks for `boost/hana.hpp.gch` when `boost/hana.hpp` is included.
+    set(_hana_pch "${_hana_prebuilt_dir}/boost/hana.hpp.gch")
+    set(BOOST_HANA_PCH_FLAGS -Winvalid-pch -include "${_hana_prebuilt_dir}/boost/hana.hpp")
+else()
+    set(_hana_pch "${_hana_prebuilt_dir}/boost/hana.hpp.pch")
+    set(BOOST_HANA_PCH_FLAGS -include-pch "${_hana_pch}")
+endif()
+
+add_custom_command(OUTPUT "${_hana_pch}"
+    COMMAND ${CMAKE_COMMAND} -E make_directory "${_hana_prebuilt_dir}/boost"
+    COMMAND ${CMAKE_CXX_COMPILER} ${_hana_flags} -x c++-header "${_hana_header}"
+                                  -o "${_hana_pch}"
+    IMPLICIT_DEPENDS CXX "${_hana_header}"
+    VERBATIM
+    COMMENT "Precompiling <boost/hana.hpp>")
+add_custom_target(hana.pch DEPENDS "${_hana_pch}")
+set(BOOST_HANA_HAS_PCH TRUE)
+
+
+##############################################################################
+# hana.module
+##############################################################################
+if (${CMAKE_CXX_COMPILER_ID} STREQUAL "GNU" AND
+    NOT ${CMAKE_CXX_COMPILER_VERSION} VERSION_LESS "11.0.0")
+    # GCC finds the compiled header unit through a module mapper, which maps
+    # the path of the header to the path of its compiled module interface.
+    set(_hana_module "${_hana_prebuilt_dir}/hana.gcm")
+    set(_hana_mapper "${_hana_prebuilt_dir}/hana.mapper")
+    file(WRITE "${_hana_mapper}" "${_hana_header} ${_hana_module}\n")
+    set(BOOST_HANA_MODULE_FLAGS -std=c++20 -fmodules-ts "-fmodule-mapper=${_hana_mapper}")
+    set(_hana_module_command ${CMAKE_CXX_COMPILER} ${_hana_flags} ${BOOST_HANA_MODULE_FLAGS}
+                             -x c++-header "${_hana_header}" -fmodule-only)
+elseif (${CMAKE_CXX_COMPILER_ID} MATCHES "Clang" AND
+        NOT ${CMAKE_CXX_COMPILER_VERSION} VERSION_LESS "15.0.0")
+    set(_hana_module "${_hana_prebuilt_dir}/hana.pcm")
+    set(BOOST_HANA_MODULE_FLAGS -std=c++20 "-fmodule-file=${_hana_module}")
+    set(_hana_module_command ${CMAKE_CXX_COMPILER} ${_hana_flags} -std=c++20
+                             -fmodule-header=user -x c++-header "${_hana_header}"
+                             -o "${_hana_module}")
+endif()
+
+if (_hana_module_command)
+    # <boost/hana/traits.hpp> wraps some type traits deprecated in C++20.
+    add_custom_command(OUTPUT "${_hana_module}"
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${_hana_prebuilt_dir}"
+        COMMAND ${_hana_module_command} -Wno-deprecated-declarations
+        IMPLICIT_DEPENDS CXX "${_hana_header}"
+        VERBATIM
+        COMMENT "Compiling <boost/hana.hpp> as a header unit")
+    add_custom_target(hana.module DEPENDS "${_hana_module}")
+    set(BOOST_HANA_HAS_MODULE TRUE)
+else()
+    message(STATUS "Header units are not supported with ${CMAKE_CXX_COMPILER_ID} "
+                   "${CMAKE_CXX_COMPILER_VERSION}; the 'hana.module' target will "
+                   "be unavailable.")
+endif()
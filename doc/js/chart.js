@@ -6,6 +6,46 @@
   'use strict';
 
   var Hana = {};
+
+  // The metrics recorded by the benchmark harness for each datapoint, along
+  // with the title of the y axis and the unit used to display them.
+  Hana.metrics = {
+      compilation_time:   { title: "Time (s)",                          suffix: 's'  }
+    , execution_time:     { title: "Time (s)",                          suffix: 's'  }
+    , execution_mad:      { title: "Median absolute deviation (s)",     suffix: 's'  }
+    , execution_p5:       { title: "5th percentile of the time (s)",    suffix: 's'  }
+    , execution_p95:      { title: "95th percentile of the time (s)",   suffix: 's'  }
+    , cycles:             { title: "CPU cycles",                        suffix: ''   }
+    , instructions:       { title: "Instructions retired",              suffix: ''   }
+    , peak_memory:        { title: "Peak compiler memory (KB)",         suffix: 'KB' }
+    , object_size:        { title: "Object file size (KB)",             suffix: 'KB' }
+    , debug_info_size:    { title: "Debug information size (KB)",       suffix: 'KB' }
+    , bloat:              { title: "Executable size (KB)",              suffix: 'KB' }
+    , instantiation_time: { title: "Template instantiation time (s)",   suffix: 's'  }
+    , constexpr_time:     { title: "Constexpr evaluation time (s)",     suffix: 's'  }
+    , frontend_time:      { title: "Frontend time (s)",                 suffix: 's'  }
+  };
+
+  // Plots the given metric instead of the measured aspect of each datapoint.
+  // Datapoints which did not record that metric are dropped.
+  Hana.selectMetric = function(options, metric) {
+    options.series.forEach(function(series) {
+      series.data = series.data.filter(function(point) {
+        return point[metric] !== undefined;
+      }).map(function(point) {
+        var copy = {};
+        for (var key in point)
+          copy[key] = point[key];
+        copy.y = point[metric];
+        return copy;
+      });
+    });
+
+    options.yAxis = { title: { text: Hana.metrics[metric].title }, floor: 0 };
+    options.tooltip = { valueSuffix: Hana.metrics[metric].suffix };
+    return options;
+  };
+
   Hana.initChart = function(div, options) {
     if (options.xAxis == undefined) {
       options.xAxis = {
@@ -1897,6 +1897,13 @@ the members of the user-defined type. Then, we `transform` that sequence into
 a sequence of `"name" : member` strings, which we then `join` and enclose with
 `{}`, which is used to denote objects in JSON notation. And that's it!
 
+This implementation is meant to be simple, not fast: it creates several
+`std::string`s for each member. Since the names of the members are known at
+compile-time, the text surrounding the values can be computed at compile-time
+too, and only the values need to be formatted at runtime. This is what
+`hana::experimental::write_json`, from `<boost/hana/experimental/json.hpp>`,
+does; it appends the JSON to an existing string without any other allocation.
+
 
 
 
@@ -2110,6 +2117,12 @@ a stupid idea, because Hana will actually compute all the permutations:
     // perms has 3 628 800 elements, and your compiler just crashed
 @endcode
 
+When only a few permutations are needed, or when each of them is only used
+once, `nth_permutation` and `for_each_permutation` compute the permutations
+one at a time instead, and `for_each_product` does the same for the elements
+of a `cartesian_product`. Still, visiting 3 628 800 permutations one by one
+is going to take a while.
+
 To contrast, algorithms in Boost.Fusion return views which hold the original
 sequence by reference and apply the algorithm on demand, as the elements of
 the sequence are accessed. This leads to subtle lifetime issues, like having
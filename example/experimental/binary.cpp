@@ -0,0 +1,43 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/binary.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (float, x),
+        (float, y)
+    );
+};
+
+struct Segment {
+    BOOST_HANA_DEFINE_STRUCT(Segment,
+        (Point, from),
+        (Point, to),
+        (char, color)
+    );
+};
+
+int main() {
+    // The representation is packed: there is no padding after the color.
+    static_assert(hana::experimental::binary_size<Segment> == 4 * sizeof(float) + 1, "");
+
+    Segment segment{{1.5f, 2.5f}, {3.5f, 4.5f}, 'r'};
+    auto polyline = hana::make_tuple(segment, segment, 42);
+
+    char buffer[hana::experimental::binary_size<decltype(polyline)>];
+    char* end = hana::experimental::binary_encode(polyline, buffer);
+    BOOST_HANA_RUNTIME_CHECK(end == buffer + sizeof(buffer));
+
+    decltype(polyline) copy{};
+    hana::experimental::binary_decode(buffer, copy);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(copy).to.y == 4.5f);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(copy).color == 'r');
+    BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(copy) == 42);
+}
@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/format.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstring>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto x_is = BOOST_HANA_STRING("x = ");
+    auto y_is = BOOST_HANA_STRING(", y = ");
+
+    // The buffer size is known at compile-time.
+    char buffer[hana::experimental::max_formatted_size<
+        decltype(x_is), int, decltype(y_is), double
+    >];
+    char* end = hana::experimental::format_to(buffer, x_is, 42, y_is, 1.5);
+    BOOST_HANA_RUNTIME_CHECK(std::string(buffer, end) == "x = 42, y = 1.500000");
+
+    // Strings are written as they are.
+    std::string name = "hana";
+    BOOST_HANA_RUNTIME_CHECK(
+        hana::experimental::format(BOOST_HANA_STRING("Hello, "), name, '!') == "Hello, hana!"
+    );
+}
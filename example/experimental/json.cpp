@@ -0,0 +1,42 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age),
+        (Car, car)
+    );
+};
+
+int main() {
+    Person john{"John", 30, {"BMW", "Z3"}};
+    BOOST_HANA_RUNTIME_CHECK(hana::experimental::to_json(john) ==
+        R"({"name":"John","age":30,"car":{"brand":"BMW","model":"Z3"}})");
+
+    // The same string can be reused to write many objects without allocating
+    std::string out;
+    for (int age = 30; age != 33; ++age) {
+        out.clear();
+        john.age = age;
+        hana::experimental::write_json(out, hana::make_tuple(john.name, age, true));
+    }
+    BOOST_HANA_RUNTIME_CHECK(out == R"(["John",32,true])");
+}
@@ -0,0 +1,44 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Particle {
+    BOOST_HANA_DEFINE_STRUCT(Particle,
+        (float, x),
+        (float, velocity),
+        (std::string, name)
+    );
+};
+
+int main() {
+    hana::experimental::soa_vector<Particle> particles;
+    particles.reserve(3);
+    particles.push_back({0.f, 1.f, "a"});
+    particles.push_back({10.f, -2.f, "b"});
+    particles.push_back({20.f, 0.5f, "c"});
+
+    // Scanning a few members only touches their columns
+    auto x = particles.column(BOOST_HANA_STRING("x"));
+    auto velocity = particles.column(BOOST_HANA_STRING("velocity"));
+    for (std::size_t i = 0; i != particles.size(); ++i)
+        x[i] += velocity[i];
+
+    // Rows are Structs whose members are references into the columns
+    for (auto particle : particles) {
+        if (hana::at_key(particle, BOOST_HANA_STRING("name")) == "b")
+            hana::at_key(particle, BOOST_HANA_STRING("velocity")) = 0.f;
+    }
+
+    BOOST_HANA_RUNTIME_CHECK(hana::at_key(particles[1], BOOST_HANA_STRING("x")) == 8.f);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_key(particles[1], BOOST_HANA_STRING("velocity")) == 0.f);
+}
@@ -0,0 +1,33 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/value_hash.hpp>
+
+#include <string>
+#include <unordered_map>
+namespace hana = boost::hana;
+
+
+struct Endpoint {
+    BOOST_HANA_DEFINE_STRUCT(Endpoint,
+        (unsigned, address),
+        (unsigned short, port),
+        (std::string, host)
+    );
+};
+
+int main() {
+    std::unordered_map<Endpoint, int,
+                       hana::experimental::value_hash,
+                       hana::experimental::value_equal> connections;
+
+    connections[Endpoint{0x7f000001, 80, "localhost"}] = 1;
+    connections[Endpoint{0x7f000001, 443, "localhost"}] = 2;
+    connections[Endpoint{0x7f000001, 80, "localhost"}] += 10;
+
+    BOOST_HANA_RUNTIME_CHECK(connections.size() == 2);
+    BOOST_HANA_RUNTIME_CHECK((connections[Endpoint{0x7f000001, 80, "localhost"}] == 11));
+}
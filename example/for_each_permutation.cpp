@@ -0,0 +1,25 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/for_each_permutation.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    int count = 0;
+    int first_smallest = 0;
+    hana::for_each_permutation(hana::make_tuple(1, 2, 3, 4), [&](auto perm) {
+        ++count;
+        hana::unpack(perm, [&](int x, auto ...) {
+            if (x == 1)
+                ++first_smallest;
+        });
+    });
+
+    BOOST_HANA_RUNTIME_CHECK(count == 24);
+    BOOST_HANA_RUNTIME_CHECK(first_smallest == 6);
+}
@@ -0,0 +1,28 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/for_each_product.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <sstream>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    std::ostringstream ss;
+    hana::for_each_product(hana::make_tuple(
+        hana::make_tuple(1, 2, 3),
+        hana::make_tuple('a', 'b'),
+        hana::make_tuple(std::string{"x"})
+    ), [&](auto xs) {
+        hana::unpack(xs, [&](int i, char c, std::string const& s) {
+            ss << i << c << s << ' ';
+        });
+    });
+
+    BOOST_HANA_RUNTIME_CHECK(ss.str() == "1ax 1bx 2ax 2bx 3ax 3bx ");
+}
@@ -81,6 +81,23 @@ hana::int_<3>::times.with_index([xs](auto index) {
 
 }{
 
+//! [times_unrolled_by]
+// Calls the function 1000 times from a loop whose body makes 8 calls.
+int n = 0;
+hana::int_c<1000>.times.unrolled_by<8>([&] { ++n; });
+BOOST_HANA_RUNTIME_CHECK(n == 1000);
+
+// The function takes an `int`, so it does not need the indices to be
+// known at compile-time and it is also called from a loop.
+std::vector<int> v;
+hana::int_c<100>.times.unrolled_by<8>.with_index([&](int index) {
+    v.push_back(index);
+});
+BOOST_HANA_RUNTIME_CHECK(v.size() == 100 && v.back() == 99);
+//! [times_unrolled_by]
+
+}{
+
 //! [literals]
 using namespace hana::literals; // contains the _c suffix
 
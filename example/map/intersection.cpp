@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/intersection.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+using namespace std::literals;
+
+
+int main() {
+    auto xs = hana::make_map(
+        hana::make_pair(hana::type_c<int>, "int"s),
+        hana::make_pair(hana::type_c<char>, "char"s)
+    );
+    auto ys = hana::make_map(
+        hana::make_pair(hana::type_c<char>, "CHAR"s),
+        hana::make_pair(hana::type_c<void>, "void"s)
+    );
+
+    BOOST_HANA_RUNTIME_CHECK(hana::intersection(xs, ys) == hana::make_map(
+        hana::make_pair(hana::type_c<char>, "char"s)
+    ));
+}
@@ -7,7 +7,6 @@
 #include <boost/hana/core/to.hpp>
 #include <boost/hana/core/is_a.hpp>
 #include <boost/hana/filter.hpp>
-#include <boost/hana/fold_left.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/map.hpp>
@@ -29,12 +28,6 @@ constexpr auto formats = hana::make_map(
     hana::make_pair(hana::type_c<char const*>, hana::string_c<'%', 's'>)
 );
 
-struct concat_strings {
-    template <char ...s1, char ...s2>
-    constexpr auto operator()(hana::string<s1...>, hana::string<s2...>) const
-    { return hana::string_c<s1..., s2...>; }
-};
-
 template <typename ...Tokens>
 constexpr auto format(Tokens ...tokens_) {
     auto tokens = hana::make_tuple(tokens_...);
@@ -50,7 +43,7 @@ constexpr auto format(Tokens ...tokens_) {
         hana::compose(hana::partial(hana::at_key, formats), hana::typeid_)
     );
 
-    auto format_string = hana::fold_left(format_string_tokens, hana::string_c<>, concat_strings{});
+    auto format_string = hana::unpack(format_string_tokens, hana::string_concat);
     auto variables = hana::filter(tokens, hana::compose(hana::not_, hana::is_a<hana::string_tag>));
     return hana::prepend(variables, format_string);
 }
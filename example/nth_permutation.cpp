@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/nth_permutation.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+constexpr auto xs = hana::make_tuple('1', 2, 3.0);
+
+static_assert(hana::nth_permutation<0>(xs) == hana::make_tuple('1', 2, 3.0), "");
+static_assert(hana::nth_permutation<1>(xs) == hana::make_tuple('1', 3.0, 2), "");
+static_assert(hana::nth_permutation<2>(xs) == hana::make_tuple(2, '1', 3.0), "");
+static_assert(hana::nth_permutation<3>(xs) == hana::make_tuple(2, 3.0, '1'), "");
+static_assert(hana::nth_permutation<4>(xs) == hana::make_tuple(3.0, '1', 2), "");
+static_assert(hana::nth_permutation<5>(xs) == hana::make_tuple(3.0, 2, '1'), "");
+
+int main() { }
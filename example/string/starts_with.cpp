@@ -0,0 +1,19 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+auto file = BOOST_HANA_STRING("string.hpp");
+
+BOOST_HANA_CONSTANT_CHECK(hana::starts_with(file, BOOST_HANA_STRING("str")));
+BOOST_HANA_CONSTANT_CHECK(!hana::starts_with(file, BOOST_HANA_STRING("tuple")));
+
+BOOST_HANA_CONSTANT_CHECK(hana::ends_with(file, BOOST_HANA_STRING(".hpp")));
+BOOST_HANA_CONSTANT_CHECK(!hana::ends_with(file, BOOST_HANA_STRING(".cpp")));
+
+int main() { }
@@ -0,0 +1,18 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+auto path = hana::string_concat(
+    BOOST_HANA_STRING("/usr"),
+    BOOST_HANA_STRING("/include"),
+    BOOST_HANA_STRING("/boost")
+);
+BOOST_HANA_CONSTANT_CHECK(path == BOOST_HANA_STRING("/usr/include/boost"));
+
+int main() { }
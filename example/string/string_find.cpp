@@ -0,0 +1,17 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+auto str = BOOST_HANA_STRING("abcabc");
+BOOST_HANA_CONSTANT_CHECK(hana::string_find(str, BOOST_HANA_STRING("ca")) == hana::just(hana::size_c<2>));
+BOOST_HANA_CONSTANT_CHECK(hana::string_find(str, BOOST_HANA_STRING("cb")) == hana::nothing);
+
+int main() { }
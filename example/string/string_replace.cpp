@@ -0,0 +1,18 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+auto str = hana::string_replace(
+    BOOST_HANA_STRING("std::vector<std::string>"),
+    BOOST_HANA_STRING("std::"),
+    BOOST_HANA_STRING("")
+);
+BOOST_HANA_CONSTANT_CHECK(str == BOOST_HANA_STRING("vector<string>"));
+
+int main() { }
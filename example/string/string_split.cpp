@@ -0,0 +1,20 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+auto parts = hana::string_split(BOOST_HANA_STRING("a::b::::c"), BOOST_HANA_STRING("::"));
+BOOST_HANA_CONSTANT_CHECK(parts == hana::make_tuple(
+    BOOST_HANA_STRING("a"),
+    BOOST_HANA_STRING("b"),
+    BOOST_HANA_STRING(""),
+    BOOST_HANA_STRING("c")
+));
+
+int main() { }
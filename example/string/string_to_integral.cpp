@@ -0,0 +1,18 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+auto answer = hana::string_to_integral<int>(BOOST_HANA_STRING("42"));
+BOOST_HANA_CONSTANT_CHECK(answer == hana::int_c<42>);
+
+auto minus_one = hana::string_to_integral<long>(BOOST_HANA_STRING("-1"));
+BOOST_HANA_CONSTANT_CHECK(minus_one == hana::long_c<-1>);
+
+int main() { }
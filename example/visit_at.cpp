@@ -0,0 +1,29 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include <cstddef>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct ping { std::string handle() const { return "pong"; } };
+struct echo { std::string handle() const { return "echo"; } };
+struct quit { std::string handle() const { return "bye"; } };
+
+int main() {
+    auto handlers = hana::make_tuple(ping{}, echo{}, quit{});
+    auto handle = [](auto const& handler) { return handler.handle(); };
+    auto unknown = [] { return std::string{"unknown message"}; };
+
+    std::size_t message = 2; // e.g. read from the network
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_at(handlers, message, handle, unknown) == "bye");
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_at(handlers, 3, handle, unknown) == "unknown message");
+
+    // When the index is known to be valid, the bounds check can be skipped
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_at_unchecked(handlers, 0, handle) == "pong");
+}
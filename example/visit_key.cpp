@@ -0,0 +1,55 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/visit_key.hpp>
+
+#include <cstddef>
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Config {
+    BOOST_HANA_DEFINE_STRUCT(Config,
+        (int, threads),
+        (int, port),
+        (std::string, host)
+    );
+};
+
+int main() {
+    // Setting the member of a struct from its runtime name
+    Config config{1, 80, "localhost"};
+    auto set_int = [](int value) {
+        return [value](auto& member) {
+            return hana::overload(
+                [&](int& m) { m = value; return true; },
+                [](auto&) { return false; }
+            )(member);
+        };
+    };
+    auto not_found = [] { return false; };
+
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_key(config, std::string{"port"}, set_int(8080), not_found));
+    BOOST_HANA_RUNTIME_CHECK(config.port == 8080);
+    BOOST_HANA_RUNTIME_CHECK(!hana::visit_key(config, "host", set_int(1), not_found));
+    BOOST_HANA_RUNTIME_CHECK(!hana::visit_key(config, "user", set_int(1), not_found));
+
+    // Looking up a value in a map whose keys are compile-time strings
+    auto sizes = hana::make_map(
+        hana::make_pair(BOOST_HANA_STRING("char"), sizeof(char)),
+        hana::make_pair(BOOST_HANA_STRING("int"), sizeof(int)),
+        hana::make_pair(BOOST_HANA_STRING("double"), sizeof(double))
+    );
+    auto identity = [](std::size_t size) { return size; };
+    auto unknown = [] { return std::size_t{0}; };
+
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_key(sizes, "double", identity, unknown) == sizeof(double));
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_key(sizes, "float", identity, unknown) == 0);
+}
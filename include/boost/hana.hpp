@@ -108,6 +108,8 @@ namespace boost {
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/fold_right.hpp>
 #include <boost/hana/for_each.hpp>
+#include <boost/hana/for_each_permutation.hpp>
+#include <boost/hana/for_each_product.hpp>
 #include <boost/hana/front.hpp>
 #include <boost/hana/functional.hpp>
 #include <boost/hana/fuse.hpp>
@@ -147,6 +149,7 @@ namespace boost {
 #include <boost/hana/none_of.hpp>
 #include <boost/hana/not.hpp>
 #include <boost/hana/not_equal.hpp>
+#include <boost/hana/nth_permutation.hpp>
 #include <boost/hana/one.hpp>
 #include <boost/hana/optional.hpp>
 #include <boost/hana/or.hpp>
@@ -198,6 +201,8 @@ namespace boost {
 #include <boost/hana/unpack.hpp>
 #include <boost/hana/value.hpp>
 #include <boost/hana/version.hpp>
+#include <boost/hana/visit_at.hpp>
+#include <boost/hana/visit_key.hpp>
 #include <boost/hana/while.hpp>
 #include <boost/hana/zero.hpp>
 #include <boost/hana/zip.hpp>
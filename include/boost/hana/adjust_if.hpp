@@ -26,11 +26,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto adjust_if_t::operator()(Xs&& xs, Pred const& pred, F const& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using AdjustIf = BOOST_HANA_DISPATCH_IF(adjust_if_impl<S>,
-            hana::Functor<S>::value
+            detail::capabilities<S>::Functor
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Functor<S>::value,
+        static_assert(detail::capabilities<S>::Functor,
         "hana::adjust_if(xs, pred, f) requires 'xs' to be a Functor");
     #endif
 
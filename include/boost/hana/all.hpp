@@ -25,11 +25,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto all_t::operator()(Xs&& xs) const {
         using S = typename hana::tag_of<Xs>::type;
         using All = BOOST_HANA_DISPATCH_IF(all_impl<S>,
-            hana::Searchable<S>::value
+            detail::capabilities<S>::Searchable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S>::value,
+        static_assert(detail::capabilities<S>::Searchable,
         "hana::all(xs) requires 'xs' to be a Searchable");
     #endif
 
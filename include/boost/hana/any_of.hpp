@@ -13,22 +13,28 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/any_of.hpp>
 
 #include <boost/hana/accessors.hpp>
-#include <boost/hana/at.hpp>
 #include <boost/hana/bool.hpp>
+#include <boost/hana/concept/constant.hpp>
 #include <boost/hana/concept/searchable.hpp>
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
 #include <boost/hana/drop_front.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/front.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/if.hpp>
 #include <boost/hana/is_empty.hpp>
-#include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
+#include <boost/hana/value.hpp>
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -37,11 +43,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto any_of_t::operator()(Xs&& xs, Pred&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using AnyOf = BOOST_HANA_DISPATCH_IF(any_of_impl<S>,
-            hana::Searchable<S>::value
+            detail::capabilities<S>::Searchable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S>::value,
+        static_assert(detail::capabilities<S>::Searchable,
         "hana::any_of(xs, pred) requires 'xs' to be a Searchable");
     #endif
 
@@ -55,50 +61,91 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto apply(Args&& ...) = delete;
     };
 
-    template <typename S>
-    struct any_of_impl<S, when<Sequence<S>::value>> {
-        //! @cond
-        template <std::size_t k, std::size_t Len>
-        struct any_of_helper {
-            template <typename Xs, typename Pred>
-            static constexpr auto apply(bool prev_cond, Xs&& xs, Pred&& pred) {
-                auto cond = hana::if_(pred(hana::at_c<k>(xs)), hana::true_c,
-                                                               hana::false_c);
-                return prev_cond ? hana::true_c
-                    : any_of_impl::any_of_helper<k + 1, Len>::apply(cond,
-                                        static_cast<Xs&&>(xs),
-                                        static_cast<Pred&&>(pred));
-            }
+    namespace any_of_detail {
+        template <typename R, bool = hana::Constant<
+            typename hana::tag_of<R>::type
+        >::value>
+        struct constant_true {
+            static constexpr bool value = false;
+        };
 
-            template <typename Xs, typename Pred>
-            static constexpr auto apply(hana::true_, Xs&&, Pred&&)
+        template <typename R>
+        struct constant_true<R, true> {
+            static constexpr bool value = static_cast<bool>(hana::value<R>());
+        };
+
+        template <typename Pred>
+        struct any_of_sequence {
+            Pred& pred;
+
+            // If the predicate returns a true-valued compile-time Logical for
+            // any element, the result is known at compile-time, and the
+            // predicate's other results do not matter.
+            template <typename AllConstant, typename ...X>
+            constexpr auto helper(hana::true_, AllConstant, X&& ...) const
             { return hana::true_c; }
 
-            template <typename Xs, typename Pred>
-            static constexpr auto apply(hana::false_, Xs&& xs, Pred&& pred) {
-                auto cond = hana::if_(pred(hana::at_c<k>(xs)), hana::true_c,
-                                                               hana::false_c);
-                return any_of_impl::any_of_helper<k + 1, Len>::apply(cond,
-                                        static_cast<Xs&&>(xs),
-                                        static_cast<Pred&&>(pred));
+            template <typename ...X>
+            constexpr auto helper(hana::false_, hana::true_, X&& ...) const
+            { return hana::false_c; }
+
+            // Otherwise, the predicate returns at least one runtime Logical,
+            // and it must not be called past the first element satisfying it.
+            template <typename ...X>
+            constexpr bool helper(hana::false_, hana::false_, X&& ...x) const {
+            #if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+                return (static_cast<bool>(hana::if_(
+                    pred(static_cast<X&&>(x)),
+                    hana::true_c, hana::false_c
+                )) || ...);
+            #else
+                return runtime_any_of(static_cast<X&&>(x)...);
+            #endif
             }
-        };
 
-        template <std::size_t Len>
-        struct any_of_helper<Len, Len> {
-            template <typename Cond, typename Xs, typename Pred>
-            static constexpr auto apply(Cond cond, Xs&&, Pred&&)
-            { return cond; }
+            constexpr bool runtime_any_of() const
+            { return false; }
+
+            template <typename X, typename ...Y>
+            constexpr bool runtime_any_of(X&& x, Y&& ...y) const {
+                return static_cast<bool>(hana::if_(
+                    pred(static_cast<X&&>(x)),
+                    hana::true_c, hana::false_c
+                )) || runtime_any_of(static_cast<Y&&>(y)...);
+            }
+
+            template <typename ...X>
+            constexpr auto operator()(X&& ...x) const {
+            #if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+                constexpr bool any_true = (constant_true<
+                    decltype(pred(static_cast<X&&>(x)))
+                >::value || ...);
+            #else
+                using Results = detail::predicate_results<
+                    constant_true<decltype(pred(static_cast<X&&>(x)))>::value...
+                >;
+                constexpr bool any_true = Results::first_satisfied != Results::size;
+            #endif
+                constexpr bool all_constant = detail::fast_and<
+                    hana::Constant<typename hana::tag_of<
+                        decltype(pred(static_cast<X&&>(x)))
+                    >::type>::value...
+                >::value;
+                return helper(hana::bool_c<any_true>,
+                              hana::bool_c<all_constant>,
+                              static_cast<X&&>(x)...);
+            }
         };
+    }
 
+    template <typename S>
+    struct any_of_impl<S, when<Sequence<S>::value>> {
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred&& pred) {
-            constexpr std::size_t len = decltype(hana::length(xs))::value;
-            return any_of_impl::any_of_helper<0, len>::apply(hana::false_c,
-                                            static_cast<Xs&&>(xs),
-                                            static_cast<Pred&&>(pred));
+            using RawPred = typename std::remove_reference<Pred>::type;
+            return hana::unpack(static_cast<Xs&&>(xs),
+                any_of_detail::any_of_sequence<RawPred>{pred});
         }
-        //! @endcond
     };
 
     template <typename It>
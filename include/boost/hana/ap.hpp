@@ -36,14 +36,14 @@ BOOST_HANA_NAMESPACE_BEGIN
         using Function = typename hana::tag_of<F>::type;
         using Value = typename hana::tag_of<X>::type;
         using Ap = BOOST_HANA_DISPATCH_IF(ap_impl<Function>,
-            hana::Applicative<Function>::value && hana::Applicative<Value>::value
+            detail::capabilities<Function>::Applicative && detail::capabilities<Value>::Applicative
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Applicative<Function>::value,
+        static_assert(detail::capabilities<Function>::Applicative,
         "hana::ap(f, x) requires 'f' to be an Applicative");
 
-        static_assert(hana::Applicative<Value>::value,
+        static_assert(detail::capabilities<Value>::Applicative,
         "hana::ap(f, x) requires 'x' to be an Applicative");
     #endif
 
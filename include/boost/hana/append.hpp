@@ -32,11 +32,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto append_t::operator()(Xs&& xs, X&& x) const {
         using M = typename hana::tag_of<Xs>::type;
         using Append = BOOST_HANA_DISPATCH_IF(append_impl<M>,
-            hana::MonadPlus<M>::value
+            detail::capabilities<M>::MonadPlus
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::MonadPlus<M>::value,
+        static_assert(detail::capabilities<M>::MonadPlus,
         "hana::append(xs, x) requires 'xs' to be a MonadPlus");
     #endif
 
@@ -14,22 +14,23 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/accessors.hpp>
 #include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/searchable.hpp>
+#include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
-#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/find.hpp>
 #include <boost/hana/find_if.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/functional/on.hpp>
-#include <boost/hana/length.hpp>
 #include <boost/hana/optional.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/unpack.hpp>
 
 #include <cstddef>
-#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -38,11 +39,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) at_key_t::operator()(Xs&& xs, Key const& key) const {
         using S = typename hana::tag_of<Xs>::type;
         using AtKey = BOOST_HANA_DISPATCH_IF(at_key_impl<S>,
-            hana::Searchable<S>::value
+            detail::capabilities<S>::Searchable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S>::value,
+        static_assert(detail::capabilities<S>::Searchable,
         "hana::at_key(xs, key) requires 'xs' to be Searchable");
     #endif
 
@@ -67,42 +68,25 @@ BOOST_HANA_NAMESPACE_BEGIN
                 return hana::equal(t, u);
             }
         };
-
-        //! @todo This causes an awful duplication of code with `find_if`.
-        template <typename Xs, typename Pred, std::size_t i, std::size_t N, bool Done>
-        struct advance_until;
-
-        template <typename Xs, typename Pred, std::size_t i, std::size_t N>
-        struct advance_until<Xs, Pred, i, N, false>
-            : advance_until<Xs, Pred, i + 1, N, static_cast<bool>(detail::decay<decltype(
-                std::declval<Pred>()(hana::at_c<i>(std::declval<Xs>()))
-            )>::type::value)>
-        { };
-
-        template <typename Xs, typename Pred, std::size_t N>
-        struct advance_until<Xs, Pred, N, N, false> {
-            template <typename Ys>
-            static constexpr auto apply(Ys&&) = delete;
-        };
-
-        template <typename Xs, typename Pred, std::size_t i, std::size_t N>
-        struct advance_until<Xs, Pred, i, N, true> {
-            template <typename Ys>
-            static constexpr decltype(auto) apply(Ys&& ys) {
-                return hana::at_c<i - 1>(static_cast<Ys&&>(ys));
-            }
-        };
     }
 
     template <typename S>
     struct at_key_impl<S, when<hana::Sequence<S>::value>> {
+        template <std::size_t index, typename Xs>
+        static constexpr decltype(auto) helper(Xs&&, hana::true_) = delete;
+
+        template <std::size_t index, typename Xs>
+        static constexpr decltype(auto) helper(Xs&& xs, hana::false_)
+        { return hana::at_c<index>(static_cast<Xs&&>(xs)); }
+
         template <typename Xs, typename Key>
         static constexpr decltype(auto) apply(Xs&& xs, Key const&) {
-            constexpr std::size_t N = decltype(hana::length(xs))::value;
             using Pred = at_key_detail::equal_to<Key>;
-            return at_key_detail::advance_until<Xs&&, Pred, 0, N, false>::apply(
-                static_cast<Xs&&>(xs)
-            );
+            using Results = decltype(hana::unpack(static_cast<Xs&&>(xs),
+                                     detail::make_predicate_results<Pred>{}));
+            constexpr std::size_t index = Results::first_satisfied;
+            return helper<index>(static_cast<Xs&&>(xs),
+                                 hana::bool_c<index == Results::size>);
         }
     };
 
@@ -27,11 +27,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) back_t::operator()(Xs&& xs) const {
         using It = typename hana::tag_of<Xs>::type;
         using Back = BOOST_HANA_DISPATCH_IF(back_impl<It>,
-            hana::Iterable<It>::value
+            detail::capabilities<It>::Iterable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Iterable<It>::value,
+        static_assert(detail::capabilities<It>::Iterable,
         "hana::back(xs) requires 'xs' to be an Iterable");
     #endif
 
@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/intrinsics.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/bool.hpp>
 #include <boost/hana/fwd/concept/sequence.hpp>
@@ -142,9 +143,9 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
     template <typename ...Xn>
     struct basic_tuple final
-        : detail::basic_tuple_impl<std::make_index_sequence<sizeof...(Xn)>, Xn...>
+        : detail::basic_tuple_impl<detail::make_index_sequence<sizeof...(Xn)>, Xn...>
     {
-        using Base = detail::basic_tuple_impl<std::make_index_sequence<sizeof...(Xn)>, Xn...>;
+        using Base = detail::basic_tuple_impl<detail::make_index_sequence<sizeof...(Xn)>, Xn...>;
 
         constexpr basic_tuple() = default;
 
@@ -250,7 +251,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename Xs, typename N>
         static constexpr auto apply(Xs&& xs, N const&) {
             constexpr std::size_t len = detail::decay<Xs>::type::size_;
-            return drop_front_helper<N::value>(static_cast<Xs&&>(xs), std::make_index_sequence<
+            return drop_front_helper<N::value>(static_cast<Xs&&>(xs), detail::make_index_sequence<
                 N::value < len ? len - N::value : 0
             >{});
         }
@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/logical.hpp>
 #include <boost/hana/detail/operators/orderable.hpp>
+#include <boost/hana/detail/unroll.hpp>
 #include <boost/hana/eval.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/eval_if.hpp>
@@ -37,35 +38,29 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     //! @cond
     namespace ic_detail {
-        template <typename T, T N, typename = std::make_integer_sequence<T, N>>
-        struct go;
-
-        template <typename T, T N, T ...i>
-        struct go<T, N, std::integer_sequence<T, i...>> {
-            using swallow = T[];
-
-            template <typename F>
-            static constexpr void with_index(F&& f)
-            { (void)swallow{T{}, ((void)f(integral_constant<T, i>{}), i)...}; }
-
-            template <typename F>
-            static constexpr void without_index(F&& f)
-            { (void)swallow{T{}, ((void)f(), i)...}; }
-        };
-
-        template <typename T, T v>
+        template <typename T, T v, std::size_t budget>
         template <typename F>
-        constexpr void with_index_t<T, v>::operator()(F&& f) const
-        { go<T, ((void)sizeof(&f), v)>::with_index(static_cast<F&&>(f)); }
+        constexpr void with_index_t<T, v, budget>::operator()(F&& f) const {
+            static_assert(v == 0 || v > 0, "n.times.with_index(f) requires 'n' to be non-negative");
+            detail::unroll<T, T{}, ((void)sizeof(&f), static_cast<std::size_t>(v)),
+                           budget>::with_index(f);
+        }
 
-        template <typename T, T v>
+        template <typename T, T v, std::size_t budget>
         template <typename F>
-        constexpr void times_t<T, v>::operator()(F&& f) const
-        { go<T, ((void)sizeof(&f), v)>::without_index(static_cast<F&&>(f)); }
+        constexpr void times_t<T, v, budget>::operator()(F&& f) const {
+            static_assert(v == 0 || v > 0, "n.times(f) requires 'n' to be non-negative");
+            detail::unroll<T, T{}, ((void)sizeof(&f), static_cast<std::size_t>(v)),
+                           budget>::without_index(f);
+        }
 
         // avoid link-time error
-        template <typename T, T v>
-        constexpr with_index_t<T, v> times_t<T, v>::with_index;
+        template <typename T, T v, std::size_t budget>
+        constexpr with_index_t<T, v, budget> times_t<T, v, budget>::with_index;
+
+        template <typename T, T v, std::size_t budget>
+        template <std::size_t k>
+        constexpr times_t<T, v, k> times_t<T, v, budget>::unrolled_by;
     }
 
     // avoid link-time error
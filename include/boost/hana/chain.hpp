@@ -25,11 +25,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) chain_t::operator()(Xs&& xs, F&& f) const {
         using M = typename hana::tag_of<Xs>::type;
         using Chain = BOOST_HANA_DISPATCH_IF(chain_impl<M>,
-            hana::Monad<M>::value
+            detail::capabilities<M>::Monad
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Monad<M>::value,
+        static_assert(detail::capabilities<M>::Monad,
         "hana::chain(xs, f) requires 'xs' to be a Monad");
     #endif
 
@@ -150,6 +150,15 @@ Distributed under the Boost Software License, Version 1.0.
 #   define BOOST_HANA_CONFIG_LIBCPP_HAS_BUG_22806
 #endif
 
+// BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS is defined when the compiler
+// supports C++17 fold expressions, unless the user asked us not to use
+// them. Some variadic algorithms are then implemented with a single fold
+// expression instead of recursion or manual unrolling.
+#if defined(__cpp_fold_expressions) &&                                      \
+    !defined(BOOST_HANA_CONFIG_DISABLE_FOLD_EXPRESSIONS)
+#   define BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 // Namespace macros
 //////////////////////////////////////////////////////////////////////////////
@@ -182,13 +191,49 @@ Distributed under the Boost Software License, Version 1.0.
     //! When this macro is not defined (the default), tag-dispatched methods
     //! will make sure the arguments they are passed are models of the proper
     //! concept(s). This can be very helpful in catching programming errors,
-    //! but it is also slightly less compile-time efficient. You should
-    //! probably always leave the checks enabled (and hence never define this
-    //! macro), except perhaps in translation units that are compiled very
-    //! often but whose code using Hana is modified very rarely.
+    //! but it is also slightly less compile-time efficient. The concepts
+    //! modeled by a tag are read from a record shared by all the methods,
+    //! in which each concept is computed once per tag when it is first
+    //! needed, so the overhead grows with the number of tags rather than
+    //! with the number of calls (see the `concept_checks` benchmark). You
+    //! should probably always leave the checks enabled (and hence never
+    //! define this macro), except perhaps in translation units that are
+    //! compiled very often but whose code using Hana is modified very
+    //! rarely.
 #   define BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
 #endif
 
+#if defined(BOOST_HANA_DOXYGEN_INVOKED)
+    //! @ingroup group-config
+    //! Disables the use of C++17 fold expressions inside the library.
+    //!
+    //! When the compiler supports fold expressions, some variadic algorithms
+    //! like `fold_left`, `for_each` or `any_of` are implemented with them,
+    //! which is usually faster to compile than the C++14 implementation.
+    //! Defining this macro forces the C++14 implementation to be used
+    //! instead, which can be useful to compare both.
+#   define BOOST_HANA_CONFIG_DISABLE_FOLD_EXPRESSIONS
+#endif
+
+#if defined(BOOST_HANA_DOXYGEN_INVOKED) || \
+    !defined(BOOST_HANA_CONFIG_UNROLL_BUDGET)
+    //! @ingroup group-config
+    //! Maximum number of calls that are unrolled by `integral_constant::%times`,
+    //! `hana::repeat` and `hana::for_each` on a `hana::range`.
+    //!
+    //! Up to that number of calls, the calls are completely unrolled. Past
+    //! it, the calls are made by a loop whose body is unrolled that many
+    //! times whenever the function does not need to know the index of the
+    //! call at compile-time, and they are expanded in chunks of that size
+    //! otherwise. This bounds the size of the generated code when calling
+    //! a function thousands of times.
+    //!
+    //! This macro defaults to `64`, and it can be defined by users before
+    //! including any Hana header or on the command line. The budget can
+    //! also be set for a single call with `times.unrolled_by<k>`.
+#   define BOOST_HANA_CONFIG_UNROLL_BUDGET 64
+#endif
+
 #if defined(BOOST_HANA_DOXYGEN_INVOKED)
     //! @ingroup group-config
     //! Enables usage of the "string literal operator template" GNU extension.
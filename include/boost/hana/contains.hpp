@@ -25,11 +25,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto contains_t::operator()(Xs&& xs, Key&& key) const {
         using S = typename hana::tag_of<Xs>::type;
         using Contains = BOOST_HANA_DISPATCH_IF(contains_impl<S>,
-            hana::Searchable<S>::value
+            detail::capabilities<S>::Searchable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S>::value,
+        static_assert(detail::capabilities<S>::Searchable,
         "hana::contains(xs, key) requires 'xs' to be a Searchable");
     #endif
 
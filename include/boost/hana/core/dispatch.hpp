@@ -11,6 +11,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_CORE_DISPATCH_HPP
 
 #include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/capabilities.hpp>
 #include <boost/hana/detail/dispatch_if.hpp>
 #include <boost/hana/core/default.hpp>
 #include <boost/hana/core/when.hpp>
@@ -31,11 +31,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto count_if_t::operator()(Xs&& xs, Pred&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using CountIf = BOOST_HANA_DISPATCH_IF(count_if_impl<S>,
-            hana::Foldable<S>::value
+            detail::capabilities<S>::Foldable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Foldable<S>::value,
+        static_assert(detail::capabilities<S>::Foldable,
         "hana::count_if(xs, pred) requires 'xs' to be Foldable");
     #endif
 
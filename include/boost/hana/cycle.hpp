@@ -34,14 +34,14 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto cycle_t::operator()(Xs&& xs, N const& n) const {
         using M = typename hana::tag_of<Xs>::type;
         using Cycle = BOOST_HANA_DISPATCH_IF(cycle_impl<M>,
-            hana::MonadPlus<M>::value
+            detail::capabilities<M>::MonadPlus
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::MonadPlus<M>::value,
+        static_assert(detail::capabilities<M>::MonadPlus,
         "hana::cycle(xs, n) requires 'xs' to be a MonadPlus");
 
-        static_assert(hana::IntegralConstant<N>::value,
+        static_assert(detail::capabilities_of<N>::IntegralConstant,
         "hana::cycle(xs, n) requires 'n' to be an IntegralConstant");
     #endif
 
@@ -0,0 +1,111 @@
+/*!
+@file
+Defines `boost::hana::detail::array_storage`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_ARRAY_STORAGE_HPP
+#define BOOST_HANA_DETAIL_ARRAY_STORAGE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/intrinsics.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace detail {
+        //////////////////////////////////////////////////////////////////////
+        // array_storage<T, N>
+        //
+        // Storage for `N >= 2` elements of the same type `T`, which is used
+        // instead of a `basic_tuple` by homogeneous tuples. Storing the
+        // elements in an array lets algorithms iterate over them with a
+        // runtime loop; see `detail::contiguous_elements`.
+        //
+        // Only plain object types which are trivially copyable and not empty
+        // are stored this way. Empty types keep the empty base optimization
+        // of `basic_tuple`, and trivially copyable types are the only ones
+        // for which initializing an array element with `T(y)` is exactly
+        // like initializing a `basic_tuple` element from `y`.
+        //////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct is_array_storable {
+            static constexpr bool value = std::is_object<T>::value
+                                       && !std::is_array<T>::value
+                                       && std::is_same<T, typename std::remove_cv<T>::type>::value
+                                       && !BOOST_HANA_TT_IS_EMPTY(T)
+                                       && std::is_trivially_copyable<T>::value;
+        };
+
+        struct array_storage_tag;
+
+        template <typename T, std::size_t N>
+        struct array_storage {
+            using value_type = T;
+            static constexpr std::size_t size = N;
+            T elems_[N];
+
+            constexpr array_storage() = default;
+
+            template <typename ...Yn, typename = typename std::enable_if<
+                sizeof...(Yn) == N
+            >::type>
+            explicit constexpr array_storage(Yn&& ...yn)
+                : elems_{T(static_cast<Yn&&>(yn))...}
+            { }
+        };
+    }
+
+    template <typename T, std::size_t N>
+    struct tag_of<detail::array_storage<T, N>> {
+        using type = detail::array_storage_tag;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // get_impl
+    //////////////////////////////////////////////////////////////////////////
+    template <std::size_t n, typename T, std::size_t N>
+    constexpr T const& get_impl(detail::array_storage<T, N> const& xs)
+    { return xs.elems_[n]; }
+
+    template <std::size_t n, typename T, std::size_t N>
+    constexpr T& get_impl(detail::array_storage<T, N>& xs)
+    { return xs.elems_[n]; }
+
+    template <std::size_t n, typename T, std::size_t N>
+    constexpr T&& get_impl(detail::array_storage<T, N>&& xs)
+    { return static_cast<T&&>(xs.elems_[n]); }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<detail::array_storage_tag> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                hana::get_impl<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            constexpr std::size_t N = detail::decay<Xs>::type::size;
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 detail::make_index_sequence<N>{});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_ARRAY_STORAGE_HPP
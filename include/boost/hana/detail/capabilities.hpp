@@ -0,0 +1,84 @@
+/*!
+@file
+Defines `boost::hana::detail::capabilities`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_CAPABILITIES_HPP
+#define BOOST_HANA_DETAIL_CAPABILITIES_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/fwd/concept/applicative.hpp>
+#include <boost/hana/fwd/concept/comonad.hpp>
+#include <boost/hana/fwd/concept/comparable.hpp>
+#include <boost/hana/fwd/concept/constant.hpp>
+#include <boost/hana/fwd/concept/euclidean_ring.hpp>
+#include <boost/hana/fwd/concept/foldable.hpp>
+#include <boost/hana/fwd/concept/functor.hpp>
+#include <boost/hana/fwd/concept/group.hpp>
+#include <boost/hana/fwd/concept/hashable.hpp>
+#include <boost/hana/fwd/concept/integral_constant.hpp>
+#include <boost/hana/fwd/concept/iterable.hpp>
+#include <boost/hana/fwd/concept/logical.hpp>
+#include <boost/hana/fwd/concept/metafunction.hpp>
+#include <boost/hana/fwd/concept/monad.hpp>
+#include <boost/hana/fwd/concept/monad_plus.hpp>
+#include <boost/hana/fwd/concept/monoid.hpp>
+#include <boost/hana/fwd/concept/orderable.hpp>
+#include <boost/hana/fwd/concept/product.hpp>
+#include <boost/hana/fwd/concept/ring.hpp>
+#include <boost/hana/fwd/concept/searchable.hpp>
+#include <boost/hana/fwd/concept/sequence.hpp>
+#include <boost/hana/fwd/concept/struct.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! Record of the concepts modeled by the tag `Tag`.
+    //!
+    //! `capabilities<Tag>::Concept` is `hana::Concept<Tag>::value`, for each
+    //! concept of the library. The interface methods read the concepts of
+    //! their arguments from this record, both to dispatch and to check them,
+    //! so that each tag is described by a single class whose members are
+    //! shared by all the methods. Since the initializer of a static data
+    //! member is only instantiated when the member is used, a membership
+    //! is only computed when it is first queried, and only the concepts
+    //! that are defined when it is queried need to be.
+    //!
+    //! `capabilities_of<T>` is the record of the tag of `T`, so that the
+    //! arguments of the same tag share the same record.
+    template <typename Tag>
+    struct capabilities {
+        static constexpr bool Applicative = hana::Applicative<Tag>::value;
+        static constexpr bool Comonad = hana::Comonad<Tag>::value;
+        static constexpr bool Comparable = hana::Comparable<Tag>::value;
+        static constexpr bool Constant = hana::Constant<Tag>::value;
+        static constexpr bool EuclideanRing = hana::EuclideanRing<Tag>::value;
+        static constexpr bool Foldable = hana::Foldable<Tag>::value;
+        static constexpr bool Functor = hana::Functor<Tag>::value;
+        static constexpr bool Group = hana::Group<Tag>::value;
+        static constexpr bool Hashable = hana::Hashable<Tag>::value;
+        static constexpr bool IntegralConstant = hana::IntegralConstant<Tag>::value;
+        static constexpr bool Iterable = hana::Iterable<Tag>::value;
+        static constexpr bool Logical = hana::Logical<Tag>::value;
+        static constexpr bool Metafunction = hana::Metafunction<Tag>::value;
+        static constexpr bool Monad = hana::Monad<Tag>::value;
+        static constexpr bool MonadPlus = hana::MonadPlus<Tag>::value;
+        static constexpr bool Monoid = hana::Monoid<Tag>::value;
+        static constexpr bool Orderable = hana::Orderable<Tag>::value;
+        static constexpr bool Product = hana::Product<Tag>::value;
+        static constexpr bool Ring = hana::Ring<Tag>::value;
+        static constexpr bool Searchable = hana::Searchable<Tag>::value;
+        static constexpr bool Sequence = hana::Sequence<Tag>::value;
+        static constexpr bool Struct = hana::Struct<Tag>::value;
+    };
+
+    template <typename T>
+    using capabilities_of = capabilities<typename hana::tag_of<T>::type>;
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_CAPABILITIES_HPP
@@ -0,0 +1,57 @@
+/*!
+@file
+Defines `boost::hana::detail::contiguous_elements`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_CONTIGUOUS_ELEMENTS_HPP
+#define BOOST_HANA_DETAIL_CONTIGUOUS_ELEMENTS_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! Describes a `Foldable` whose elements all have the same type and are
+    //! stored contiguously, like a `std::array`.
+    //!
+    //! Algorithms use this to process such a structure with a runtime loop,
+    //! which is instantiated once instead of once per element and which the
+    //! optimizer can vectorize. Specializations must be usable with at least
+    //! one element, and they must provide
+    //! - `value`, which is `true`
+    //! - `value_type`, the type of the elements
+    //! - `size`, the number of elements
+    //! - `data(xs)`, returning a pointer to the first element of `xs`, with
+    //!   overloads for `const` and non-`const` objects
+    //!
+    //! Specializations for `Sequence`s must also provide a `rebind<U>` alias
+    //! to the type returned by `hana::make` when it is called with `size`
+    //! objects of type `U`.
+    template <typename Xs, typename = void>
+    struct contiguous_elements {
+        static constexpr bool value = false;
+    };
+
+    //! @ingroup group-details
+    //! Returns the `i`-th element of a structure described by
+    //! `contiguous_elements`, with the same value category as `xs`.
+    template <typename Xs>
+    constexpr decltype(auto) contiguous_at(Xs&& xs, std::size_t i) {
+        using Contiguous = contiguous_elements<typename detail::decay<Xs>::type>;
+        using Element = typename std::remove_pointer<decltype(Contiguous::data(xs))>::type;
+        using Reference = typename std::conditional<
+            std::is_lvalue_reference<Xs>::value, Element&, Element&&
+        >::type;
+        return static_cast<Reference>(Contiguous::data(xs)[i]);
+    }
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_CONTIGUOUS_ELEMENTS_HPP
@@ -16,10 +16,17 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+#if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+    template <bool ...b>
+    struct fast_and
+        : std::integral_constant<bool, (b && ...)>
+    { };
+#else
     template <bool ...b>
     struct fast_and
         : std::is_same<fast_and<b...>, fast_and<(b, true)...>>
     { };
+#endif
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_DETAIL_FAST_AND_HPP
@@ -11,6 +11,10 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_HASH_TABLE_HPP
 #define BOOST_HANA_DETAIL_HASH_TABLE_HPP
 
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
+#include <boost/hana/detail/type_foldl1.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/ext/std/integer_sequence.hpp>
 #include <boost/hana/ext/std/integral_constant.hpp>
@@ -50,6 +54,12 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
         using type = decltype(detail::find_indices_impl<Hash>(std::declval<Map>()));
     };
+
+    // Looking up a key in an empty table never requires hashing that key.
+    template <typename Key>
+    struct find_indices<hash_table<>, Key> {
+        using type = std::index_sequence<>;
+    };
     // end find_indices
 
     // find_index:
@@ -105,41 +115,199 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
         using type = bucket<Hash, i..., Index>;
     };
 
-    template <typename Map, typename Key, std::size_t Index, bool =
-        (find_indices<Map, Key>::type::size() > 0)
+    template <typename Map, typename Hash, std::size_t Index, bool =
+        (decltype(detail::find_indices_impl<Hash>(std::declval<Map>()))::size() > 0)
     >
-    struct bucket_insert;
+    struct bucket_insert_hash;
 
-    template <typename ...Buckets, typename Key, std::size_t Index>
-    struct bucket_insert<hash_table<Buckets...>, Key, Index, true> {
+    template <typename ...Buckets, typename Hash, std::size_t Index>
+    struct bucket_insert_hash<hash_table<Buckets...>, Hash, Index, true> {
         // There is a bucket for that Hash; append the new index to it.
-        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
         using type = hash_table<typename update_bucket<Buckets, Hash, Index>::type...>;
     };
 
-    template <typename ...Buckets, typename Key, std::size_t Index>
-    struct bucket_insert<hash_table<Buckets...>, Key, Index, false> {
+    template <typename ...Buckets, typename Hash, std::size_t Index>
+    struct bucket_insert_hash<hash_table<Buckets...>, Hash, Index, false> {
         // There is no bucket for that Hash; insert a new bucket.
-        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
         using type = hash_table<Buckets..., bucket<Hash, Index>>;
     };
+
+    template <typename Map, typename Key, std::size_t Index>
+    struct bucket_insert {
+        using Hash = typename decltype(hana::hash(std::declval<Key>()))::type;
+        using type = typename bucket_insert_hash<Map, Hash, Index>::type;
+    };
     // end bucket_insert
 
+    // has_unique_hash:
+    //  Returns whether exactly one bucket of the `Map` is associated to the
+    //  given `Hash`. This is used to validate a hash table that was built
+    //  under the assumption that no two keys have the same hash. Indeed, if
+    //  several `bucket<Hash, i>` are base classes of the table, deducing `i`
+    //  fails and we fall back to the variadic overload.
+    template <typename Hash, std::size_t i>
+    std::true_type has_unique_hash_impl(bucket<Hash, i> const&);
+
+    template <typename Hash>
+    std::false_type has_unique_hash_impl(...);
+
+    template <typename Map, typename Hash>
+    struct has_unique_hash
+        : decltype(detail::has_unique_hash_impl<Hash>(std::declval<Map>()))
+    { };
+    // end has_unique_hash
+
     // make_hash_table:
     //  Creates a `hash_table` type able of holding the given number of
     //  elements. The type of the key associated to any given index must
     //  be retrievable using the `KeyAtIndex` alias. All the keys must
-    //  be distinct and have different hashes too.
+    //  be distinct, but their hashes may collide.
+    //
+    //  We first build the table in a single pass by assuming that all the
+    //  hashes are different, which is by far the most common case. If that
+    //  assumption turns out to be wrong, we fall back to inserting the keys
+    //  one at a time with `bucket_insert_hash`, which handles collisions.
+    template <typename Map, typename Bucket>
+    struct bucket_insert_singleton;
+
+    template <typename Map, typename Hash, std::size_t i>
+    struct bucket_insert_singleton<Map, bucket<Hash, i>>
+        : bucket_insert_hash<Map, Hash, i>
+    { };
+
+    template <bool NoCollisions, typename ...Buckets>
+    struct make_hash_table_impl {
+        using type = hash_table<Buckets...>;
+    };
+
+    template <typename ...Buckets>
+    struct make_hash_table_impl<false, Buckets...> {
+        using type = typename detail::type_foldl1<
+            bucket_insert_singleton, hash_table<>, Buckets...
+        >::type;
+    };
+
     template <template <std::size_t> class KeyAtIndex, std::size_t N,
-              typename Indices = std::make_index_sequence<N>>
+              typename Indices = detail::make_index_sequence<N>>
     struct make_hash_table;
 
     template <template <std::size_t> class KeyAtIndex, std::size_t N, std::size_t ...i>
     struct make_hash_table<KeyAtIndex, N, std::index_sequence<i...>> {
-        using type = hash_table<
-            bucket<typename decltype(hana::hash(std::declval<KeyAtIndex<i>>()))::type, i>...
+        template <std::size_t n>
+        using HashAtIndex = typename decltype(
+            hana::hash(std::declval<KeyAtIndex<n>>())
+        )::type;
+
+        using Optimistic = hash_table<bucket<HashAtIndex<i>, i>...>;
+
+        using type = typename make_hash_table_impl<
+            detail::fast_and<has_unique_hash<Optimistic, HashAtIndex<i>>::value...>::value,
+            bucket<HashAtIndex<i>, i>...
+        >::type;
+    };
+    // end make_hash_table
+
+    // unique_indices:
+    //  Returns an `index_sequence` containing the index of the first
+    //  occurrence of each distinct key among the `N` keys retrievable with
+    //  the `KeyAtIndex` alias. When all the hashes are different, all the
+    //  keys are distinct too and we return all the indices without comparing
+    //  any keys. Otherwise, we insert the keys one at a time in a hash table,
+    //  which only compares keys that fall in the same bucket.
+    template <typename HashTable, typename Indices>
+    struct unique_indices_state {
+        using hash_table_type = HashTable;
+        using indices = Indices;
+    };
+
+    template <typename State, typename Key, std::size_t Index, typename MaybeIndex>
+    struct unique_indices_insert {
+        // The key is already in the table; skip it.
+        using type = State;
+    };
+
+    template <typename HashTable, std::size_t ...kept, typename Key, std::size_t Index>
+    struct unique_indices_insert<
+        unique_indices_state<HashTable, std::index_sequence<kept...>>,
+        Key, Index, hana::optional<>
+    > {
+        using type = unique_indices_state<
+            typename bucket_insert<HashTable, Key, Index>::type,
+            std::index_sequence<kept..., Index>
+        >;
+    };
+
+    template <template <std::size_t> class KeyAtIndex>
+    struct unique_indices_step {
+        template <typename State, typename Index>
+        using apply = unique_indices_insert<
+            State, KeyAtIndex<Index::value>, Index::value,
+            typename find_index<
+                typename State::hash_table_type, KeyAtIndex<Index::value>, KeyAtIndex
+            >::type
         >;
     };
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t N,
+              typename Indices = detail::make_index_sequence<N>>
+    struct unique_indices;
+
+    template <template <std::size_t> class KeyAtIndex, std::size_t N, std::size_t ...i>
+    struct unique_indices<KeyAtIndex, N, std::index_sequence<i...>> {
+        template <std::size_t n>
+        using HashAtIndex = typename decltype(
+            hana::hash(std::declval<KeyAtIndex<n>>())
+        )::type;
+
+        using Optimistic = hash_table<bucket<HashAtIndex<i>, i>...>;
+
+        template <bool NoCollisions, typename Dummy = void>
+        struct impl {
+            using type = std::index_sequence<i...>;
+        };
+
+        template <typename Dummy>
+        struct impl<false, Dummy> {
+            using type = typename detail::type_foldl1<
+                unique_indices_step<KeyAtIndex>::template apply,
+                unique_indices_state<hash_table<>, std::index_sequence<>>,
+                std::integral_constant<std::size_t, i>...
+            >::type::indices;
+        };
+
+        using type = typename impl<
+            detail::fast_and<has_unique_hash<Optimistic, HashAtIndex<i>>::value...>::value
+        >::type;
+    };
+    // end unique_indices
+
+    // lookup_results:
+    //  Returns a `predicate_results` telling, for each of the `N` keys
+    //  retrievable with the `KeyAtIndex` alias, whether it is found (when
+    //  `Found` is true) or not found (when `Found` is false) in the `Map`,
+    //  whose own keys are retrievable with the `MapKeyAtIndex` alias.
+    //
+    //  Each key is only compared with the keys of its bucket, so this is a
+    //  single pass over the keys, whose satisfied indices are the elements
+    //  to keep. This is used to implement the set-theoretic operations and
+    //  the erasure of keys on maps and sets without rebuilding them one
+    //  element at a time.
+    template <bool Found, typename Map, template <std::size_t> class MapKeyAtIndex,
+              template <std::size_t> class KeyAtIndex, std::size_t N,
+              typename Indices = detail::make_index_sequence<N>>
+    struct lookup_results;
+
+    template <bool Found, typename Map, template <std::size_t> class MapKeyAtIndex,
+              template <std::size_t> class KeyAtIndex, std::size_t N, std::size_t ...i>
+    struct lookup_results<Found, Map, MapKeyAtIndex, KeyAtIndex, N, std::index_sequence<i...>> {
+        using type = detail::predicate_results<(
+            !std::is_same<
+                typename find_index<Map, KeyAtIndex<i>, MapKeyAtIndex>::type,
+                hana::optional<>
+            >::value == Found
+        )...>;
+    };
+    // end lookup_results
 } BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_DETAIL_HASH_TABLE_HPP
@@ -11,7 +11,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_DETAIL_INDEX_IF_HPP
 
 #include <boost/hana/config.hpp>
-#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -43,27 +43,17 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail {
     //! @note
     //! The predicate must return an `IntegralConstant` that can be explicitly
     //! converted to `bool`.
-    template <typename Pred, typename Ts, typename = when<true>>
+    template <typename Pred, typename Ts>
     struct index_if;
 
     //! @cond
-    template <typename Pred, typename T, typename ...Ts>
-    struct index_if<Pred, pack<T, Ts...>, when<static_cast<bool>(decltype(
-        std::declval<Pred>()(std::declval<T>())
-    )::value)>> {
-        static constexpr std::size_t value = 0;
-    };
-
-    template <typename Pred, typename T, typename ...Ts>
-    struct index_if<Pred, pack<T, Ts...>, when<!static_cast<bool>(decltype(
-        std::declval<Pred>()(std::declval<T>())
-    )::value)>> {
-        static constexpr std::size_t value = 1 + index_if<Pred, pack<Ts...>>::value;
-    };
-
-    template <typename Pred>
-    struct index_if<Pred, pack<>> {
-        static constexpr std::size_t value = 0;
+    template <typename Pred, typename ...T>
+    struct index_if<Pred, pack<T...>> {
+        static constexpr std::size_t value = detail::predicate_results<
+            static_cast<bool>(decltype(
+                std::declval<Pred>()(std::declval<T>())
+            )::value)...
+        >::first_satisfied;
     };
     //! @endcond
 } BOOST_HANA_NAMESPACE_END
@@ -12,6 +12,9 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/config.hpp>
 
+#include <cstddef>
+#include <utility>
+
 
 // We use intrinsics if they are available because it speeds up the
 // compile-times.
@@ -39,6 +42,23 @@ Distributed under the Boost Software License, Version 1.0.
 #   endif
 #endif
 
+// Builtins generating index sequences and indexing parameter packs in
+// constant time are provided by Clang and by recent versions of GCC. They
+// can only be used inside templates, and must hence be wrapped in aliases.
+#if defined(__has_builtin)
+#   if __has_builtin(__make_integer_seq)
+#       define BOOST_HANA_TT_MAKE_INDEX_SEQUENCE(N) \
+            __make_integer_seq< ::std::integer_sequence, ::std::size_t, N>
+#   elif __has_builtin(__integer_pack)
+#       define BOOST_HANA_TT_MAKE_INDEX_SEQUENCE(N) \
+            ::std::index_sequence<__integer_pack(N)...>
+#   endif
+
+#   if __has_builtin(__type_pack_element)
+#       define BOOST_HANA_TT_TYPE_PACK_ELEMENT(n, ...) __type_pack_element<n, __VA_ARGS__>
+#   endif
+#endif
+
 #if !defined(BOOST_HANA_TT_IS_EMPTY)
 #   include <type_traits>
 #   define BOOST_HANA_TT_IS_EMPTY(T) ::std::is_empty<T>::value
@@ -64,4 +84,11 @@ Distributed under the Boost Software License, Version 1.0.
 #   define BOOST_HANA_TT_IS_CONVERTIBLE(T, U) ::std::is_convertible<T, U>::value
 #endif
 
+#if !defined(BOOST_HANA_TT_MAKE_INDEX_SEQUENCE)
+#   define BOOST_HANA_TT_MAKE_INDEX_SEQUENCE(N) ::std::make_index_sequence<N>
+#endif
+
+// `BOOST_HANA_TT_TYPE_PACK_ELEMENT` has no fallback here, because it can't
+// be emulated with a single alias; see `detail::type_at` instead.
+
 #endif // !BOOST_HANA_DETAIL_INTRINSICS_HPP
@@ -0,0 +1,33 @@
+/*!
+@file
+Defines `boost::hana::detail::make_index_sequence`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_MAKE_INDEX_SEQUENCE_HPP
+#define BOOST_HANA_DETAIL_MAKE_INDEX_SEQUENCE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/intrinsics.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! Equivalent to `std::make_index_sequence<N>`, but created with a
+    //! compiler builtin whenever one is available.
+    //!
+    //! The result is always a `std::index_sequence`, so it can be matched
+    //! as such. Some standard libraries implement `std::make_index_sequence`
+    //! with a recursive template, which makes creating long sequences both
+    //! slow and limited by the template instantiation depth.
+    template <std::size_t N>
+    using make_index_sequence = BOOST_HANA_TT_MAKE_INDEX_SEQUENCE(N);
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_MAKE_INDEX_SEQUENCE_HPP
@@ -0,0 +1,213 @@
+/*!
+@file
+Defines `boost::hana::detail::packed_layout`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_PACKED_LAYOUT_HPP
+#define BOOST_HANA_DETAIL_PACKED_LAYOUT_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/second.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! The elements of a composite object, which are the members of a
+    //! `Struct` and the elements of a `Sequence`.
+    template <typename T, typename = void>
+    struct layout_elements : layout_elements<T, hana::when<true>> { };
+
+    template <typename T, bool condition>
+    struct layout_elements<T, hana::when<condition>> {
+        static constexpr bool is_composite = false;
+    };
+
+    template <typename T>
+    struct layout_elements<T, hana::when<hana::Struct<T>::value>> {
+        static constexpr bool is_composite = true;
+        static constexpr std::size_t size =
+            decltype(hana::length(hana::accessors<T>()))::value;
+
+        template <std::size_t i, typename X>
+        static constexpr decltype(auto) get(X& x)
+        { return hana::second(hana::at_c<i>(hana::accessors<T>()))(x); }
+    };
+
+    template <typename T>
+    struct layout_elements<T, hana::when<
+        hana::Sequence<T>::value && !hana::Struct<T>::value
+    >> {
+        static constexpr bool is_composite = true;
+        static constexpr std::size_t size =
+            decltype(hana::length(std::declval<T const&>()))::value;
+
+        template <std::size_t i, typename X>
+        static constexpr decltype(auto) get(X& x)
+        { return hana::at_c<i>(x); }
+    };
+
+    template <typename T, std::size_t i>
+    using layout_element_t = std::remove_cv_t<std::remove_reference_t<
+        decltype(layout_elements<T>::template get<i>(std::declval<T&>()))
+    >>;
+
+    template <typename T>
+    char* object_bytes(T& x)
+    { return reinterpret_cast<char*>(std::addressof(x)); }
+
+    template <typename T>
+    char const* object_bytes(T const& x)
+    { return reinterpret_cast<char const*>(std::addressof(x)); }
+
+    // The elements of a composite object are split in segments, which are
+    // either a single element that is not packed, or a maximal block of
+    // adjacent packed elements without padding between them. The padding
+    // is predicted with the usual layout rules, where each element is placed
+    // at the first offset suitably aligned after the previous one, and empty
+    // elements take no space. `bounds[s]` is the index of the first element
+    // of the `s`-th segment, and `bounds[segments]` is `N`.
+    template <std::size_t N>
+    struct layout_plan {
+        detail::array<std::size_t, N + 1> offsets;
+        detail::array<std::size_t, N + 1> bounds;
+        std::size_t segments;
+    };
+
+    template <std::size_t N>
+    constexpr layout_plan<N>
+    make_layout_plan(bool const (&packed)[N + 1], bool const (&empty)[N + 1],
+                     std::size_t const (&sizes)[N + 1],
+                     std::size_t const (&alignments)[N + 1])
+    {
+        layout_plan<N> plan{};
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i != N; ++i) {
+            offset = (offset + alignments[i] - 1) / alignments[i] * alignments[i];
+            plan.offsets[i] = offset;
+            offset += empty[i] ? 0 : sizes[i];
+
+            bool joins_previous = i != 0 && packed[i] && packed[i - 1] &&
+                plan.offsets[i] == plan.offsets[i - 1] + sizes[i - 1];
+            if (!joins_previous)
+                plan.bounds[plan.segments++] = i;
+        }
+        plan.offsets[N] = offset;
+        plan.bounds[plan.segments] = N;
+        return plan;
+    }
+
+    //! @ingroup group-details
+    //! Visits the elements of a composite object `x` of type `T`, treating
+    //! adjacent _packed_ elements as blocks of bytes.
+    //!
+    //! `IsPacked<E>::value` tells whether the elements of type `E` can be
+    //! handled as their object representation. `apply(x, visitor)` calls
+    //! `visitor.bytes(p, n)` for each block of `n` bytes at `p` made of
+    //! adjacent packed elements, and `visitor.element(e)` for each other
+    //! element `e`, in order.
+    //!
+    //! The offsets of the members of an object are constants, so the
+    //! optimizer folds the check that the packed elements are where the plan
+    //! expects them, and the blocks have fixed offsets and sizes. Objects
+    //! with a different layout, like `Struct`s with unreflected members or
+    //! `std::tuple`s storing their elements backwards, are visited one
+    //! element at a time, with one block per packed element. This requires
+    //! the elements to be subobjects of `x`, which is the case for the
+    //! `Struct`s defined with Hana's macros.
+    template <typename T, template <typename> class IsPacked,
+              typename = std::make_index_sequence<layout_elements<T>::size>>
+    struct packed_layout;
+
+    template <typename T, template <typename> class IsPacked, std::size_t ...i>
+    struct packed_layout<T, IsPacked, std::index_sequence<i...>> {
+        static constexpr std::size_t N = sizeof...(i);
+
+        using plan_type = layout_plan<N>;
+        static constexpr plan_type plan = detail::make_layout_plan<N>(
+            {IsPacked<layout_element_t<T, i>>::value..., false},
+            {std::is_empty<layout_element_t<T, i>>::value..., true},
+            {sizeof(layout_element_t<T, i>)..., 0},
+            {alignof(layout_element_t<T, i>)..., 1}
+        );
+
+        template <typename X>
+        static bool has_planned_layout(X& x) {
+            auto const object = detail::object_bytes(x);
+            (void)object;
+            bool matches = true;
+            using Swallow = int[];
+            (void)Swallow{0, (matches = matches && (
+                !IsPacked<layout_element_t<T, i>>::value ||
+                detail::object_bytes(layout_elements<T>::template get<i>(x)) - object ==
+                    static_cast<std::ptrdiff_t>(plan.offsets[i])
+            ), 0)...};
+            return matches;
+        }
+
+        template <std::size_t b, std::size_t e, typename X, typename Visitor>
+        static void apply_segment(X& x, Visitor& visitor, hana::true_) {
+            constexpr std::size_t n = plan.offsets[e - 1] + sizeof(layout_element_t<T, e - 1>)
+                                    - plan.offsets[b];
+            visitor.bytes(detail::object_bytes(x) + plan.offsets[b], n);
+        }
+
+        template <std::size_t b, std::size_t e, typename X, typename Visitor>
+        static void apply_segment(X& x, Visitor& visitor, hana::false_)
+        { visitor.element(layout_elements<T>::template get<b>(x)); }
+
+        template <typename X, typename Visitor, std::size_t ...s>
+        static void apply_segments(X& x, Visitor& visitor, std::index_sequence<s...>) {
+            using Swallow = int[];
+            (void)Swallow{0, (packed_layout::apply_segment<
+                plan.bounds[s], plan.bounds[s + 1]
+            >(x, visitor, hana::bool_c<
+                IsPacked<layout_element_t<T, plan.bounds[s]>>::value
+            >), 0)...};
+        }
+
+        template <std::size_t k, typename X, typename Visitor>
+        static void apply_element(X& x, Visitor& visitor, hana::true_) {
+            auto& element = layout_elements<T>::template get<k>(x);
+            visitor.bytes(detail::object_bytes(element), sizeof(element));
+        }
+
+        template <std::size_t k, typename X, typename Visitor>
+        static void apply_element(X& x, Visitor& visitor, hana::false_)
+        { visitor.element(layout_elements<T>::template get<k>(x)); }
+
+        template <typename X, typename Visitor>
+        static void apply(X& x, Visitor& visitor) {
+            if (packed_layout::has_planned_layout(x)) {
+                packed_layout::apply_segments(x, visitor,
+                    std::make_index_sequence<plan.segments>{});
+            } else {
+                using Swallow = int[];
+                (void)Swallow{0, (packed_layout::apply_element<i>(x, visitor,
+                    hana::bool_c<IsPacked<layout_element_t<T, i>>::value>), 0)...};
+            }
+        }
+    };
+
+    template <typename T, template <typename> class IsPacked, std::size_t ...i>
+    constexpr typename packed_layout<T, IsPacked, std::index_sequence<i...>>::plan_type
+    packed_layout<T, IsPacked, std::index_sequence<i...>>::plan;
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_PACKED_LAYOUT_HPP
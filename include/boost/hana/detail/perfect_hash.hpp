@@ -0,0 +1,229 @@
+/*!
+@file
+Defines `boost::hana::detail::string_perfect_hash`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_PERFECT_HASH_HPP
+#define BOOST_HANA_DETAIL_PERFECT_HASH_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/fwd/string.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! Finalizer of `splitmix64`, which makes every bit of the result depend
+    //! on every bit of `h`.
+    constexpr std::uint64_t mix_hash(std::uint64_t h) {
+        h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ull;
+        h ^= h >> 27; h *= 0x94d049bb133111ebull;
+        h ^= h >> 31;
+        return h;
+    }
+
+    //! @ingroup group-details
+    //! Hashes the `n` characters starting at `s`.
+    //!
+    //! This is the 64 bits FNV-1a hash, followed by `mix_hash`. It is
+    //! `constexpr`, so that the same function is used to build a
+    //! `string_perfect_hash` at compile-time and to query it at runtime.
+    constexpr std::uint64_t string_hash(char const* s, std::size_t n) {
+        std::uint64_t h = 0xcbf29ce484222325ull;
+        for (std::size_t i = 0; i != n; ++i) {
+            h ^= static_cast<unsigned char>(s[i]);
+            h *= 0x100000001b3ull;
+        }
+        return detail::mix_hash(h);
+    }
+
+    //! @ingroup group-details
+    //! Smallest power of two greater than or equal to `n`, and at least 1.
+    constexpr std::size_t next_power_of_two(std::size_t n) {
+        std::size_t result = 1;
+        while (result < n)
+            result *= 2;
+        return result;
+    }
+
+    // Hash and displace: the keys are split in buckets by their hash, and
+    // every bucket is given the seed which sends all its keys to distinct
+    // free slots when mixed with their hash. Buckets are processed from
+    // the largest to the smallest, since large buckets are harder to place.
+    template <std::size_t N>
+    struct perfect_hash_table {
+        static constexpr std::size_t size = detail::next_power_of_two(N);
+        static constexpr std::size_t mask = size - 1;
+
+        static constexpr std::size_t slot(std::uint64_t hash, std::uint64_t seed)
+        { return static_cast<std::size_t>(detail::mix_hash(hash ^ seed)) & mask; }
+
+        // The seed of each bucket, and the index of the key in each slot,
+        // which is `N` for empty slots.
+        detail::array<std::uint64_t, size> seeds;
+        detail::array<std::size_t, size> indices;
+        bool valid;
+    };
+
+    template <std::size_t N>
+    constexpr perfect_hash_table<N>
+    make_perfect_hash_table(detail::array<std::uint64_t, N> const& hashes) {
+        using Table = perfect_hash_table<N>;
+        Table table{};
+        table.valid = true;
+        for (std::size_t s = 0; s != Table::size; ++s)
+            table.indices[s] = N;
+
+        detail::array<std::size_t, Table::size> bucket_sizes{};
+        std::size_t largest = 0;
+        for (std::size_t i = 0; i != N; ++i) {
+            std::size_t b = static_cast<std::size_t>(hashes[i]) & Table::mask;
+            if (++bucket_sizes[b] > largest)
+                largest = bucket_sizes[b];
+        }
+
+        detail::array<std::size_t, N> bucket{};
+        detail::array<std::size_t, N> slots{};
+        for (std::size_t k = largest; k != 0; --k) {
+            for (std::size_t b = 0; b != Table::size; ++b) {
+                if (bucket_sizes[b] != k)
+                    continue;
+
+                std::size_t n = 0;
+                for (std::size_t i = 0; i != N; ++i)
+                    if ((static_cast<std::size_t>(hashes[i]) & Table::mask) == b)
+                        bucket[n++] = i;
+
+                for (std::uint64_t seed = 1; ; ++seed) {
+                    // Give up when no seed can be found, which only happens
+                    // when two keys have exactly the same hash.
+                    if (seed > 64 * Table::size) {
+                        table.valid = false;
+                        return table;
+                    }
+
+                    bool placed = true;
+                    for (std::size_t j = 0; j != n && placed; ++j) {
+                        slots[j] = Table::slot(hashes[bucket[j]], seed);
+                        placed = table.indices[slots[j]] == N;
+                        for (std::size_t l = 0; l != j && placed; ++l)
+                            placed = slots[l] != slots[j];
+                    }
+
+                    if (placed) {
+                        table.seeds[b] = seed;
+                        for (std::size_t j = 0; j != n; ++j)
+                            table.indices[slots[j]] = bucket[j];
+                        break;
+                    }
+                }
+            }
+        }
+        return table;
+    }
+
+    template <typename T>
+    struct string_literal {
+        static constexpr bool is_string = false;
+    };
+
+    template <char ...s>
+    struct string_literal<hana::string<s...>> {
+        static constexpr bool is_string = true;
+        static constexpr std::size_t size = sizeof...(s);
+        static constexpr char const value[sizeof...(s) + 1] = {s..., '\0'};
+    };
+
+    template <char ...s>
+    constexpr char const string_literal<hana::string<s...>>::value[sizeof...(s) + 1];
+
+    template <typename ...Strings>
+    constexpr detail::array<std::uint64_t, sizeof...(Strings)> string_hashes() {
+        char const* keys[] = {string_literal<Strings>::value..., nullptr};
+        std::size_t lengths[] = {string_literal<Strings>::size..., 0};
+        detail::array<std::uint64_t, sizeof...(Strings)> result{};
+        for (std::size_t i = 0; i != sizeof...(Strings); ++i)
+            result[i] = detail::string_hash(keys[i], lengths[i]);
+        return result;
+    }
+
+    //! @ingroup group-details
+    //! Perfect hash table of a set of `hana::string`s, which can be queried
+    //! with runtime strings.
+    //!
+    //! The table is computed at compile-time from the `Strings`, which must
+    //! be distinct. `find(s, n)` returns the index of the key equal to the
+    //! `n` characters starting at `s` in the `Strings`, or the number of
+    //! `Strings` when there is no such key. A query hashes the runtime
+    //! string once, reads two entries of the table and compares the string
+    //! with the only key that could match it.
+    template <typename ...Strings>
+    struct string_perfect_hash {
+        static_assert(detail::fast_and<string_literal<Strings>::is_string...>::value,
+        "detail::string_perfect_hash requires all the keys to be hana::strings");
+
+        static constexpr std::size_t N = sizeof...(Strings);
+
+        static constexpr char const* keys[N + 1] = {
+            string_literal<Strings>::value..., nullptr
+        };
+        static constexpr std::size_t lengths[N + 1] = {
+            string_literal<Strings>::size..., 0
+        };
+
+        using table_type = perfect_hash_table<N>;
+        static constexpr table_type table =
+            detail::make_perfect_hash_table<N>(detail::string_hashes<Strings...>());
+        static_assert(table.valid,
+        "detail::string_perfect_hash requires the keys to be distinct");
+
+        static constexpr std::size_t find(char const* s, std::size_t n) {
+            using Table = table_type;
+            std::uint64_t const hash = detail::string_hash(s, n);
+            std::uint64_t const seed = table.seeds[static_cast<std::size_t>(hash) & Table::mask];
+            std::size_t const index = table.indices[Table::slot(hash, seed)];
+            if (index == N || lengths[index] != n)
+                return N;
+            for (std::size_t i = 0; i != n; ++i)
+                if (keys[index][i] != s[i])
+                    return N;
+            return index;
+        }
+    };
+
+    template <typename ...Strings>
+    constexpr char const* string_perfect_hash<Strings...>::keys[];
+
+    template <typename ...Strings>
+    constexpr std::size_t string_perfect_hash<Strings...>::lengths[];
+
+    template <typename ...Strings>
+    constexpr typename string_perfect_hash<Strings...>::table_type
+    string_perfect_hash<Strings...>::table;
+
+    //! @ingroup group-details
+    //! Function object returning the `string_perfect_hash` of the keys of
+    //! the `hana::pair`s it is called with. It is meant to be used as
+    //! `decltype(hana::unpack(pairs, perfect_hash_of_keys{}))`.
+    struct perfect_hash_of_keys {
+        template <typename ...Pairs>
+        constexpr auto operator()(Pairs const& ...) const {
+            return detail::string_perfect_hash<
+                typename detail::decay<decltype(hana::first(std::declval<Pairs>()))>::type...
+            >{};
+        }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_PERFECT_HASH_HPP
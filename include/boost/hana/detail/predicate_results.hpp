@@ -0,0 +1,90 @@
+/*!
+@file
+Defines `boost::hana::detail::predicate_results`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_PREDICATE_RESULTS_HPP
+#define BOOST_HANA_DETAIL_PREDICATE_RESULTS_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/decay.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! Holds the results of applying a predicate to every element of a
+    //! sequence, and answers queries about them with `constexpr` functions.
+    //!
+    //! All the results are computed in a single pack expansion, so building
+    //! a `predicate_results` requires a constant template recursion depth
+    //! and one instantiation of the predicate per element, regardless of
+    //! the query. The queries themselves are evaluated as `constexpr` code
+    //! over an array of `bool`s. The first satisfied and unsatisfied indices
+    //! and the count are computed along with the results, but the arrays of
+    //! indices are only computed when they are used.
+    //!
+    //! @note
+    //! Contrary to a recursive search, the predicate is always evaluated
+    //! on every element, even past the first one that satisfies it.
+    template <bool ...b>
+    struct predicate_results {
+        static constexpr std::size_t size = sizeof...(b);
+        static constexpr bool results[] = {b..., false}; // avoid empty array
+
+        //! Index of the first satisfied result, or `size` if there is none.
+        static constexpr std::size_t first_satisfied =
+            detail::find(results, results + size, true) - results;
+
+        //! Index of the first unsatisfied result, or `size` if there is none.
+        static constexpr std::size_t first_unsatisfied =
+            detail::find(results, results + size, false) - results;
+
+        //! Number of satisfied results.
+        static constexpr std::size_t count =
+            detail::count(results, results + size, true);
+
+        template <bool Result>
+        static constexpr auto compute_indices() {
+            detail::array<std::size_t, Result ? count : size - count> indices{};
+            std::size_t* out = &indices[0];
+            for (std::size_t i = 0; i < size; ++i)
+                if (results[i] == Result)
+                    *out++ = i;
+            return indices;
+        }
+
+        //! Indices of the results equal to `Result`, in order.
+        template <bool Result>
+        static constexpr auto indices = compute_indices<Result>();
+    };
+
+    template <bool ...b>
+    constexpr bool predicate_results<b...>::results[];
+
+    //! @ingroup group-details
+    //! Function object returning the `predicate_results` of `Pred` applied
+    //! to its arguments; meant to be used through `hana::unpack`.
+    //!
+    //! The predicate must return an `IntegralConstant` that can be explicitly
+    //! converted to `bool`.
+    template <typename Pred>
+    struct make_predicate_results {
+        template <typename ...X>
+        constexpr auto operator()(X&& ...) const -> predicate_results<
+            static_cast<bool>(detail::decay<
+                decltype(std::declval<Pred>()(std::declval<X>()))
+            >::type::value)...
+        > { return {}; }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_PREDICATE_RESULTS_HPP
@@ -0,0 +1,58 @@
+/*!
+@file
+Defines `boost::hana::detail::type_at`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_TYPE_AT_HPP
+#define BOOST_HANA_DETAIL_TYPE_AT_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/intrinsics.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! The `n`-th type of the `T...` parameter pack.
+    //!
+    //! This uses the `__type_pack_element` builtin when it is available,
+    //! which does not instantiate anything. Otherwise, the type is looked
+    //! up with overload resolution on the bases of a single class, which
+    //! requires `O(sizeof...(T))` instantiations the first time a pack is
+    //! indexed, but only one instantiation for each subsequent lookup in
+    //! the same pack.
+#if defined(BOOST_HANA_TT_TYPE_PACK_ELEMENT)
+    template <std::size_t n, typename ...T>
+    using type_at = BOOST_HANA_TT_TYPE_PACK_ELEMENT(n, T...);
+#else
+    namespace type_at_detail {
+        template <std::size_t I, typename T>
+        struct elt { using type = T; };
+
+        template <typename Indices, typename ...T>
+        struct indexer;
+
+        template <std::size_t ...I, typename ...T>
+        struct indexer<std::index_sequence<I...>, T...>
+            : elt<I, T>...
+        { };
+
+        template <std::size_t I, typename T>
+        elt<I, T> get_elt(elt<I, T> const&);
+    }
+
+    template <std::size_t n, typename ...T>
+    using type_at = typename decltype(type_at_detail::get_elt<n>(
+        type_at_detail::indexer<detail::make_index_sequence<sizeof...(T)>, T...>{}
+    ))::type;
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_TYPE_AT_HPP
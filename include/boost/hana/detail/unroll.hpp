@@ -0,0 +1,162 @@
+/*!
+@file
+Defines `boost::hana::detail::unroll`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_UNROLL_HPP
+#define BOOST_HANA_DETAIL_UNROLL_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
+#include <boost/hana/detail/void_t.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace detail {
+    //! @ingroup group-details
+    //! Returns whether a function can be called with a runtime index of
+    //! type `T` instead of an `integral_constant`, without this being
+    //! observable.
+    //!
+    //! This is the case for pointers to functions and for function objects
+    //! with a single, non-template call operator which accepts a `T`. Since
+    //! the parameter type of such a function is fixed, it only ever sees
+    //! the value of the index, not whether it was known at compile-time.
+    template <typename F, typename T, typename = void>
+    struct accepts_runtime_index {
+        static constexpr bool value = false;
+    };
+
+    template <typename F, typename T>
+    struct accepts_runtime_index<F, T, void_t<
+        decltype(&F::operator()),
+        decltype(std::declval<F&>()(std::declval<T>()))
+    >> {
+        static constexpr bool value = true;
+    };
+
+    template <typename R, typename ...Args, typename T>
+    struct accepts_runtime_index<R(*)(Args...), T, void_t<
+        decltype(std::declval<R(*)(Args...)>()(std::declval<T>()))
+    >> {
+        static constexpr bool value = true;
+    };
+
+    template <typename T, T from, typename Indices>
+    struct unroll_chunk;
+
+    template <typename T, T from, std::size_t ...i>
+    struct unroll_chunk<T, from, std::index_sequence<i...>> {
+        template <typename F>
+        static constexpr void without_index(F& f) {
+        #if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+            (((void)i, (void)f()), ...);
+        #else
+            using Swallow = int[];
+            (void)Swallow{0, ((void)i, (void)f(), 0)...};
+        #endif
+        }
+
+        template <typename F>
+        static constexpr void with_index(F& f) {
+        #if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+            ((void)f(integral_constant<T, static_cast<T>(from + static_cast<T>(i))>{}), ...);
+        #else
+            using Swallow = int[];
+            (void)Swallow{0, ((void)f(integral_constant<T, static_cast<T>(from + static_cast<T>(i))>{}), 0)...};
+        #endif
+        }
+
+        template <typename F>
+        static constexpr void with_runtime_index(F& f, T base) {
+            (void)base; // unused when the chunk is empty
+        #if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+            ((void)f(static_cast<T>(base + static_cast<T>(i))), ...);
+        #else
+            using Swallow = int[];
+            (void)Swallow{0, ((void)f(static_cast<T>(base + static_cast<T>(i))), 0)...};
+        #endif
+        }
+    };
+
+    //! @ingroup group-details
+    //! Calls a function `n` times, with the indices `from`, `from + 1`, ...,
+    //! `from + n - 1` when they are requested, unrolling at most `budget`
+    //! calls at once.
+    //!
+    //! When `n <= budget`, all the calls are unrolled, and `with_index`
+    //! passes the indices as `integral_constant`s. Otherwise,
+    //! - `without_index` calls `f()` in a loop whose body is unrolled
+    //!   `budget` times, followed by the remaining `n % budget` calls.
+    //! - `with_index` does the same when `f` accepts a runtime index, as
+    //!   reported by `accepts_runtime_index`, and passes the indices as
+    //!   objects of type `T`.
+    //! - Otherwise, `with_index` still passes `integral_constant`s, so it
+    //!   must expand all the calls, but it does so in chunks of `budget`
+    //!   calls, each of which is a separate function.
+    //!
+    //! In all cases, the calls are made in order of ascending index.
+    template <typename T, T from, std::size_t n, std::size_t budget,
+              bool = (n <= budget)>
+    struct unroll
+        : unroll_chunk<T, from, detail::make_index_sequence<n>>
+    { };
+
+    template <typename T, T from, std::size_t n, std::size_t budget>
+    struct unroll<T, from, n, budget, false> {
+        static_assert(budget > 0, "the unroll budget must be at least 1");
+        static constexpr std::size_t chunks = n / budget;
+
+        template <std::size_t c>
+        using Chunk = unroll_chunk<
+            T, static_cast<T>(from + static_cast<T>(c * budget)),
+            detail::make_index_sequence<(c < chunks ? budget : n % budget)>
+        >;
+
+        template <typename F>
+        static constexpr void without_index(F& f) {
+            for (std::size_t c = 0; c != chunks; ++c)
+                Chunk<0>::without_index(f);
+            Chunk<chunks>::without_index(f);
+        }
+
+        template <typename F>
+        static constexpr void with_index(F& f) {
+            using Runtime = accepts_runtime_index<
+                typename std::remove_reference<F>::type, T
+            >;
+            with_index_helper(f, hana::bool_c<Runtime::value>);
+        }
+
+        template <typename F>
+        static constexpr void with_index_helper(F& f, hana::true_) {
+            for (std::size_t c = 0; c != chunks; ++c)
+                Chunk<0>::with_runtime_index(f, static_cast<T>(from + static_cast<T>(c * budget)));
+            Chunk<chunks>::with_runtime_index(f, static_cast<T>(from + static_cast<T>(chunks * budget)));
+        }
+
+        template <typename F>
+        static constexpr void with_index_helper(F& f, hana::false_)
+        { chunked(f, detail::make_index_sequence<chunks + 1>{}); }
+
+        template <typename F, std::size_t ...c>
+        static constexpr void chunked(F& f, std::index_sequence<c...>) {
+        #if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+            (Chunk<c>::with_index(f), ...);
+        #else
+            using Swallow = int[];
+            (void)Swallow{0, (Chunk<c>::with_index(f), 0)...};
+        #endif
+        }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_DETAIL_UNROLL_HPP
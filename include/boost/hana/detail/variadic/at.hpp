@@ -11,13 +11,14 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_DETAIL_VARIADIC_AT_HPP
 
 #include <boost/hana/config.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 
 #include <cstddef>
 #include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
-    template <std::size_t n, typename = std::make_index_sequence<n>>
+    template <std::size_t n, typename = detail::make_index_sequence<n>>
     struct at_type;
 
     template <std::size_t n, std::size_t ...ignore>
@@ -13,6 +13,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/when.hpp>
 
+#include <utility>
+
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
     template <unsigned int n, typename = when<true>>
@@ -196,6 +198,55 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
         }
     };
 
+#if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+    // With fold expressions, we fold `operator|` over the arguments instead,
+    // with an accumulator that holds `f` and the current state. The state
+    // is held with the exact type returned by `f`, so the references it
+    // returns are preserved and the temporaries are moved at most once.
+    namespace foldl1_detail {
+        template <typename X>
+        struct argument { X&& value; };
+
+        template <typename F, typename State>
+        struct accumulator {
+            F& f;
+            State state;
+
+            template <typename X>
+            constexpr accumulator<F, decltype(
+                std::declval<F&>()(std::declval<State>(), std::declval<X>())
+            )> operator|(argument<X> x) && {
+                return {f, f(static_cast<State&&>(state),
+                             static_cast<X&&>(x.value))};
+            }
+        };
+
+        template <typename F>
+        struct start {
+            F& f;
+
+            template <typename X>
+            constexpr accumulator<F, X&&> operator|(argument<X> x) &&
+            { return {f, static_cast<X&&>(x.value)}; }
+        };
+    }
+
+    struct foldl1_t {
+        template <typename F, typename X1>
+        constexpr X1 operator()(F&&, X1&& x1) const
+        { return static_cast<X1&&>(x1); }
+
+        template <typename F, typename X1, typename X2, typename ...Xn>
+        constexpr decltype(auto)
+        operator()(F&& f, X1&& x1, X2&& x2, Xn&& ...xn) const {
+            return ((foldl1_detail::start<F>{f}
+                        | foldl1_detail::argument<X1>{static_cast<X1&&>(x1)}
+                        | foldl1_detail::argument<X2>{static_cast<X2&&>(x2)})
+                    | ... | foldl1_detail::argument<Xn>{static_cast<Xn&&>(xn)}
+            ).state;
+        }
+    };
+#else
     struct foldl1_t {
         template <typename F, typename X1, typename ...Xn>
         constexpr decltype(auto) operator()(F&& f, X1&& x1, Xn&& ...xn) const {
@@ -204,6 +255,7 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
             );
         }
     };
+#endif
 
     constexpr foldl1_t foldl1{};
     constexpr auto foldl = foldl1;
@@ -13,6 +13,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/when.hpp>
 
+#include <utility>
+
 
 BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
     template <unsigned int n, typename = when<true>>
@@ -182,6 +184,65 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
         }
     };
 
+#if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+    // With fold expressions, we fold `operator|` over the arguments instead,
+    // with an accumulator that holds `f` and the current state. The state
+    // is held with the exact type returned by `f`, so the references it
+    // returns are preserved and the temporaries are moved at most once.
+    namespace foldr1_detail {
+        template <typename F>
+        struct start { F& f; };
+
+        template <typename F, typename State>
+        struct accumulator {
+            F& f;
+            State state;
+        };
+
+        template <typename X>
+        struct argument {
+            X&& value;
+
+            template <typename F>
+            constexpr accumulator<F, X&&> operator|(start<F> s) &&
+            { return {s.f, static_cast<X&&>(value)}; }
+
+            template <typename F, typename State>
+            constexpr accumulator<F, decltype(
+                std::declval<F&>()(std::declval<X>(), std::declval<State>())
+            )> operator|(accumulator<F, State>&& acc) && {
+                return {acc.f, acc.f(static_cast<X&&>(value),
+                                     static_cast<State&&>(acc.state))};
+            }
+        };
+    }
+
+    struct foldr1_t {
+        template <typename F, typename X1>
+        constexpr X1 operator()(F&&, X1&& x1) const
+        { return static_cast<X1&&>(x1); }
+
+        template <typename F, typename X1, typename X2, typename ...Xn>
+        constexpr decltype(auto)
+        operator()(F&& f, X1&& x1, X2&& x2, Xn&& ...xn) const {
+            return (foldr1_detail::argument<X1>{static_cast<X1&&>(x1)}
+                | (foldr1_detail::argument<X2>{static_cast<X2&&>(x2)}
+                | (foldr1_detail::argument<Xn>{static_cast<Xn&&>(xn)}
+                    | ... | foldr1_detail::start<F>{f}))
+            ).state;
+        }
+    };
+
+    constexpr foldr1_t foldr1{};
+
+    struct foldr_t {
+        template <typename F, typename State, typename ...Xn>
+        constexpr decltype(auto) operator()(F&& f, State&& state, Xn&& ...xn) const {
+            return foldr1(static_cast<F&&>(f), static_cast<Xn&&>(xn)...,
+                          static_cast<State&&>(state));
+        }
+    };
+#else
     struct foldr1_t {
         template <typename F, typename X1, typename ...Xn>
         constexpr decltype(auto) operator()(F&& f, X1&& x1, Xn&& ...xn) const {
@@ -201,6 +262,7 @@ BOOST_HANA_NAMESPACE_BEGIN namespace detail { namespace variadic {
             );
         }
     };
+#endif
 
     constexpr foldr_t foldr{};
 }} BOOST_HANA_NAMESPACE_END
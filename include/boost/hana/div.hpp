@@ -31,16 +31,16 @@ BOOST_HANA_NAMESPACE_BEGIN
         using T = typename hana::tag_of<X>::type;
         using U = typename hana::tag_of<Y>::type;
         using Div = BOOST_HANA_DISPATCH_IF(decltype(div_impl<T, U>{}),
-            hana::EuclideanRing<T>::value &&
-            hana::EuclideanRing<U>::value &&
+            detail::capabilities<T>::EuclideanRing &&
+            detail::capabilities<U>::EuclideanRing &&
             !is_default<div_impl<T, U>>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::EuclideanRing<T>::value,
+        static_assert(detail::capabilities<T>::EuclideanRing,
         "hana::div(x, y) requires 'x' to be an EuclideanRing");
 
-        static_assert(hana::EuclideanRing<U>::value,
+        static_assert(detail::capabilities<U>::EuclideanRing,
         "hana::div(x, y) requires 'y' to be an EuclideanRing");
 
         static_assert(!is_default<div_impl<T, U>>::value,
@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/length.hpp>
 
@@ -31,15 +32,15 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto drop_back_t::operator()(Xs&& xs, N const& n) const {
         using S = typename hana::tag_of<Xs>::type;
         using DropBack = BOOST_HANA_DISPATCH_IF(drop_back_impl<S>,
-            hana::Sequence<S>::value &&
-            hana::IntegralConstant<N>::value
+            detail::capabilities<S>::Sequence &&
+            detail::capabilities_of<N>::IntegralConstant
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::drop_back(xs, n) requires 'xs' to be a Sequence");
 
-        static_assert(hana::IntegralConstant<N>::value,
+        static_assert(detail::capabilities_of<N>::IntegralConstant,
         "hana::drop_back(xs, n) requires 'n' to be an IntegralConstant");
     #endif
 
@@ -67,7 +68,7 @@ BOOST_HANA_NAMESPACE_BEGIN
             constexpr std::size_t n = N::value;
             constexpr std::size_t len = decltype(hana::length(xs))::value;
             return drop_back_helper(static_cast<Xs&&>(xs),
-                                    std::make_index_sequence<(n > len ? 0 : len - n)>{});
+                                    detail::make_index_sequence<(n > len ? 0 : len - n)>{});
         }
     };
 BOOST_HANA_NAMESPACE_END
@@ -28,15 +28,15 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto drop_front_exactly_t::operator()(Xs&& xs, N const& n) const {
         using It = typename hana::tag_of<Xs>::type;
         using DropFrontExactly = BOOST_HANA_DISPATCH_IF(drop_front_exactly_impl<It>,
-            hana::Iterable<It>::value &&
-            hana::IntegralConstant<N>::value
+            detail::capabilities<It>::Iterable &&
+            detail::capabilities_of<N>::IntegralConstant
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Iterable<It>::value,
+        static_assert(detail::capabilities<It>::Iterable,
         "hana::drop_front_exactly(xs, n) requires 'xs' to be an Iterable");
 
-        static_assert(hana::IntegralConstant<N>::value,
+        static_assert(detail::capabilities_of<N>::IntegralConstant,
         "hana::drop_front_exactly(xs, n) requires 'n' to be an IntegralConstant");
     #endif
 
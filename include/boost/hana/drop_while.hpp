@@ -16,12 +16,14 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/iterable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
-#include <boost/hana/detail/first_unsatisfied_index.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
 #include <boost/hana/drop_front.hpp>
 #include <boost/hana/eval_if.hpp>
 #include <boost/hana/front.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/is_empty.hpp>
 #include <boost/hana/lazy.hpp>
+#include <boost/hana/unpack.hpp>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -30,11 +32,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto drop_while_t::operator()(Xs&& xs, Pred&& pred) const {
         using It = typename hana::tag_of<Xs>::type;
         using DropWhile = BOOST_HANA_DISPATCH_IF(drop_while_impl<It>,
-            hana::Iterable<It>::value
+            detail::capabilities<It>::Iterable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Iterable<It>::value,
+        static_assert(detail::capabilities<It>::Iterable,
         "hana::drop_while(xs, pred) requires 'xs' to be an Iterable");
     #endif
 
@@ -80,12 +82,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct drop_while_impl<S, when<hana::Foldable<S>::value>> {
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred&&) {
-            using FirstUnsatisfied = decltype(
-                hana::unpack(static_cast<Xs&&>(xs),
-                             detail::first_unsatisfied_index<Pred&&>{})
-            );
+            using Results = decltype(hana::unpack(static_cast<Xs&&>(xs),
+                                     detail::make_predicate_results<Pred&&>{}));
             return hana::drop_front(static_cast<Xs&&>(xs),
-                                    FirstUnsatisfied{});
+                                    hana::size_c<Results::first_unsatisfied>);
         }
     };
 BOOST_HANA_NAMESPACE_END
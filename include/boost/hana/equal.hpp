@@ -29,6 +29,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/tag_of.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/concepts.hpp>
+#include <boost/hana/detail/contiguous_elements.hpp>
 #include <boost/hana/detail/dependent_on.hpp>
 #include <boost/hana/detail/has_common_embedding.hpp>
 #include <boost/hana/detail/nested_to.hpp> // required by fwd decl
@@ -39,6 +40,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/value.hpp>
 
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -164,16 +167,60 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
     }
 
+    namespace detail {
+        // Whether two sequences can be compared with a loop. This is the case
+        // when both store their elements contiguously, they have the same
+        // length and comparing their elements yields a runtime `bool`.
+        template <typename Xs, typename Ys, bool =
+            contiguous_elements<Xs>::value && contiguous_elements<Ys>::value
+        >
+        struct equal_loop {
+            static constexpr bool value = false;
+        };
+
+        template <typename Xs, typename Ys>
+        struct equal_loop<Xs, Ys, true> {
+            template <bool same_size, typename = void>
+            struct compare_elements : std::false_type { };
+
+            template <typename Dummy>
+            struct compare_elements<true, Dummy> : std::is_same<bool,
+                decltype(hana::equal(
+                    std::declval<typename contiguous_elements<Xs>::value_type const&>(),
+                    std::declval<typename contiguous_elements<Ys>::value_type const&>()
+                ))
+            > { };
+
+            static constexpr bool value = compare_elements<
+                contiguous_elements<Xs>::size == contiguous_elements<Ys>::size
+            >::value;
+        };
+    }
+
     template <typename T, typename U>
     struct equal_impl<T, U, when<Sequence<T>::value && hana::Sequence<U>::value>> {
         template <typename Xs, typename Ys>
-        static constexpr auto apply(Xs const& xs, Ys const& ys) {
+        static constexpr auto helper(Xs const& xs, Ys const& ys, hana::false_) {
             constexpr std::size_t xs_size = decltype(hana::length(xs))::value;
             constexpr std::size_t ys_size = decltype(hana::length(ys))::value;
             detail::compare_finite_sequences<Xs, Ys, xs_size> comp{xs, ys};
             return comp.template apply<0>(hana::bool_<xs_size == 0>{},
                                           hana::bool_<xs_size == ys_size>{});
         }
+
+        template <typename Xs, typename Ys>
+        static constexpr bool helper(Xs const& xs, Ys const& ys, hana::true_) {
+            using Contiguous = detail::contiguous_elements<Xs>;
+            for (std::size_t i = 0; i != Contiguous::size; ++i)
+                if (!hana::equal(detail::contiguous_at(xs, i), detail::contiguous_at(ys, i)))
+                    return false;
+            return true;
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const& xs, Ys const& ys) {
+            return helper(xs, ys, hana::bool_c<detail::equal_loop<Xs, Ys>::value>);
+        }
     };
 
     namespace detail {
@@ -29,11 +29,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) eval_if_t::operator()(Cond&& cond, Then&& then, Else&& else_) const {
         using Bool = typename hana::tag_of<Cond>::type;
         using EvalIf = BOOST_HANA_DISPATCH_IF(eval_if_impl<Bool>,
-            hana::Logical<Bool>::value
+            detail::capabilities<Bool>::Logical
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Logical<Bool>::value,
+        static_assert(detail::capabilities<Bool>::Logical,
         "hana::eval_if(cond, then, else) requires 'cond' to be a Logical");
     #endif
 
@@ -0,0 +1,205 @@
+/*
+@file
+Defines `boost::hana::experimental::binary_encode` and
+`boost::hana::experimental::binary_decode`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_BINARY_HPP
+#define BOOST_HANA_EXPERIMENTAL_BINARY_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/packed_layout.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace binary_detail {
+        enum class kind { empty, leaf, composite, unsupported };
+
+        template <typename T>
+        constexpr kind kind_of() {
+            return detail::layout_elements<T>::is_composite ? kind::composite
+                 : std::is_empty<T>::value                   ? kind::empty
+                 : std::is_trivially_copyable<T>::value       ? kind::leaf
+                 : kind::unsupported;
+        }
+
+        template <typename T>
+        struct is_leaf
+            : std::integral_constant<bool, binary_detail::kind_of<T>() == kind::leaf>
+        { };
+
+        template <std::size_t N>
+        constexpr std::size_t sum(std::size_t const (&xs)[N]) {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != N; ++i)
+                result += xs[i];
+            return result;
+        }
+
+        template <typename T, kind = binary_detail::kind_of<T>()>
+        struct layout;
+
+        template <typename Bytes, typename Buffer>
+        struct visitor {
+            Buffer& buffer;
+
+            template <typename Byte>
+            void bytes(Byte* object, std::size_t n) const
+            { Bytes::apply(buffer, object, n); }
+
+            template <typename X>
+            void element(X& x) const
+            { layout<std::remove_cv_t<X>>::template apply<Bytes>(x, buffer); }
+        };
+
+        template <typename T>
+        struct layout<T, kind::empty> {
+            static constexpr std::size_t size = 0;
+
+            template <typename Bytes, typename X, typename Buffer>
+            static void apply(X&, Buffer&) { }
+        };
+
+        template <typename T>
+        struct layout<T, kind::leaf> {
+            static constexpr std::size_t size = sizeof(T);
+
+            template <typename Bytes, typename X, typename Buffer>
+            static void apply(X& x, Buffer& buffer)
+            { Bytes::apply(buffer, detail::object_bytes(x), sizeof(T)); }
+        };
+
+        template <typename T, typename Indices>
+        struct composite_size;
+
+        template <typename T, std::size_t ...i>
+        struct composite_size<T, std::index_sequence<i...>> {
+            static constexpr std::size_t value = binary_detail::sum<sizeof...(i) + 1>(
+                {layout<detail::layout_element_t<T, i>>::size..., 0}
+            );
+        };
+
+        template <typename T>
+        struct layout<T, kind::composite> {
+            static constexpr std::size_t size = composite_size<
+                T, std::make_index_sequence<detail::layout_elements<T>::size>
+            >::value;
+
+            // Adjacent trivially copyable elements are copied with a single
+            // `memcpy` when they are not separated by padding.
+            template <typename Bytes, typename X, typename Buffer>
+            static void apply(X& x, Buffer& buffer) {
+                visitor<Bytes, Buffer> v{buffer};
+                detail::packed_layout<T, is_leaf>::apply(x, v);
+            }
+        };
+
+        template <typename T>
+        struct layout<T, kind::unsupported> {
+            static_assert(binary_detail::kind_of<T>() != kind::unsupported,
+            "hana::experimental::binary_encode and binary_decode require the "
+            "encoded object to be made of Structs, Sequences and trivially "
+            "copyable types");
+            static constexpr std::size_t size = 0;
+
+            template <typename Bytes, typename X, typename Buffer>
+            static void apply(X&, Buffer&) { }
+        };
+
+        struct encode_bytes {
+            static void apply(char*& out, char const* object, std::size_t n) {
+                std::memcpy(out, object, n);
+                out += n;
+            }
+        };
+
+        struct decode_bytes {
+            static void apply(char const*& in, char* object, std::size_t n) {
+                std::memcpy(object, in, n);
+                in += n;
+            }
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Number of bytes written by `binary_encode` for an object of type `T`.
+    //!
+    //! The binary representation of an object is the concatenation of the
+    //! object representations of its leaves, without any padding, in the
+    //! order in which they appear in the `Struct`s and `Sequence`s holding
+    //! them. Its size depends only on `T`, so the buffers can be allocated
+    //! on the stack.
+    template <typename T>
+    constexpr std::size_t binary_size = binary_detail::layout<T>::size;
+
+    //! @ingroup group-experimental
+    //! Writes the binary representation of an object to a buffer, and
+    //! returns a pointer past the last byte written.
+    //!
+    //! The object is traversed at compile-time: `Struct`s and `Sequence`s
+    //! are encoded recursively, empty objects (like `hana::integral_constant`s)
+    //! are skipped and every other object must be trivially copyable, and is
+    //! copied as it is in memory, in the native byte order. Adjacent
+    //! trivially copyable members of a `Struct` or elements of a `Sequence`
+    //! are copied with a single `memcpy`, except where they are separated by
+    //! padding. This requires the accessors of the `Struct`s and `Sequence`s
+    //! to return references to subobjects, which is the case for the
+    //! `Struct`s defined with Hana's macros.
+    //!
+    //! `out` must point to at least `binary_size<T>` bytes; the encoding
+    //! never allocates.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/binary.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto binary_encode = [](auto const& x, char* out) -> char* {
+        return tag-dispatched;
+    };
+#else
+    struct binary_encode_t {
+        template <typename T>
+        char* operator()(T const& x, char* out) const {
+            binary_detail::layout<T>::template apply<binary_detail::encode_bytes>(x, out);
+            return out;
+        }
+    };
+
+    constexpr binary_encode_t binary_encode{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Reads an object written by `binary_encode` from a buffer, and returns
+    //! a pointer past the last byte read.
+    //!
+    //! `in` must point to at least `binary_size<T>` bytes written by
+    //! `binary_encode` for an object of type `T`, on a platform with the
+    //! same object representations.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto binary_decode = [](char const* in, auto& x) -> char const* {
+        return tag-dispatched;
+    };
+#else
+    struct binary_decode_t {
+        template <typename T>
+        char const* operator()(char const* in, T& x) const {
+            binary_detail::layout<T>::template apply<binary_detail::decode_bytes>(x, in);
+            return in;
+        }
+    };
+
+    constexpr binary_decode_t binary_decode{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_BINARY_HPP
@@ -0,0 +1,439 @@
+/*
+@file
+Defines `boost::hana::experimental::format_to`,
+`boost::hana::experimental::format` and
+`boost::hana::experimental::max_formatted_size`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_FORMAT_HPP
+#define BOOST_HANA_EXPERIMENTAL_FORMAT_HPP
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace format_detail {
+        template <typename T, typename = void>
+        struct formatter : formatter<T, hana::when<true>> { };
+
+        template <typename T, bool condition>
+        struct formatter<T, hana::when<condition>> {
+            static_assert(condition && !condition,
+            "hana::experimental::format_to(out, x...) requires each 'x' to be a "
+            "hana::string, a string, a character, a bool or an arithmetic type");
+        };
+
+        // Compile-time strings
+        template <char ...s>
+        struct formatter<hana::string<s...>> {
+            static constexpr bool is_literal = true;
+            static constexpr bool is_bounded = true;
+            static constexpr std::size_t max_size = sizeof...(s);
+
+            static std::size_t size(hana::string<s...> const&)
+            { return max_size; }
+
+            static char* apply(char* out, hana::string<s...> const& str) {
+                std::memcpy(out, hana::to<char const*>(str), max_size);
+                return out + max_size;
+            }
+        };
+
+        // Runtime strings, whose size is only known at runtime
+        template <>
+        struct formatter<std::string> {
+            static constexpr bool is_literal = false;
+            static constexpr bool is_bounded = false;
+
+            static std::size_t size(std::string const& s)
+            { return s.size(); }
+
+            static char* apply(char* out, std::string const& s) {
+                std::memcpy(out, s.data(), s.size());
+                return out + s.size();
+            }
+        };
+
+        template <>
+        struct formatter<char const*> {
+            static constexpr bool is_literal = false;
+            static constexpr bool is_bounded = false;
+
+            static std::size_t size(char const* s)
+            { return std::strlen(s); }
+
+            static char* apply(char* out, char const* s) {
+                std::size_t n = std::strlen(s);
+                std::memcpy(out, s, n);
+                return out + n;
+            }
+        };
+
+        template <>
+        struct formatter<char*> : formatter<char const*> { };
+
+        template <std::size_t N>
+        struct formatter<char[N]> : formatter<char const*> {
+            static constexpr bool is_bounded = true;
+            static constexpr std::size_t max_size = N - 1;
+        };
+
+        // Characters and bools
+        template <>
+        struct formatter<char> {
+            static constexpr bool is_literal = false;
+            static constexpr bool is_bounded = true;
+            static constexpr std::size_t max_size = 1;
+
+            static std::size_t size(char)
+            { return max_size; }
+
+            static char* apply(char* out, char c) {
+                *out = c;
+                return out + 1;
+            }
+        };
+
+        template <>
+        struct formatter<bool> {
+            static constexpr bool is_literal = false;
+            static constexpr bool is_bounded = true;
+            static constexpr std::size_t max_size = 5;
+
+            static std::size_t size(bool)
+            { return max_size; }
+
+            static char* apply(char* out, bool b) {
+                if (b) { std::memcpy(out, "true", 4); return out + 4; }
+                else   { std::memcpy(out, "false", 5); return out + 5; }
+            }
+        };
+
+        // Integers are written two digits at a time, from the right, once
+        // their number of digits is known.
+        constexpr char digit_pairs[] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        template <typename U>
+        char* write_unsigned(char* out, U u) {
+            std::size_t n = 1;
+            for (U threshold = 10;
+                 n != std::numeric_limits<U>::digits10 + 1 && u >= threshold;
+                 threshold = static_cast<U>(threshold * 10))
+                ++n;
+
+            char* p = out + n;
+            while (u >= 100) {
+                std::size_t pair = static_cast<std::size_t>(u % 100) * 2;
+                u = static_cast<U>(u / 100);
+                *--p = digit_pairs[pair + 1];
+                *--p = digit_pairs[pair];
+            }
+            if (u >= 10) {
+                std::size_t pair = static_cast<std::size_t>(u) * 2;
+                *--p = digit_pairs[pair + 1];
+                *--p = digit_pairs[pair];
+            } else {
+                *--p = static_cast<char>('0' + u);
+            }
+            return out + n;
+        }
+
+        template <typename T>
+        struct formatter<T, hana::when<std::is_integral<T>::value>> {
+            using U = std::make_unsigned_t<T>;
+
+            static constexpr bool is_literal = false;
+            static constexpr bool is_bounded = true;
+            static constexpr std::size_t max_size =
+                std::numeric_limits<U>::digits10 + 1 + std::is_signed<T>::value;
+
+            static std::size_t size(T)
+            { return max_size; }
+
+            static char* apply(char* out, T x) {
+                if (x < 0) {
+                    *out++ = '-';
+                    return format_detail::write_unsigned(out, static_cast<U>(U{0} - static_cast<U>(x)));
+                }
+                return format_detail::write_unsigned(out, static_cast<U>(x));
+            }
+        };
+
+        // Floating point numbers are written with six decimals, like `%f`
+        // does, except when their magnitude is too large for that to have a
+        // reasonable bound on the size. They are then written in scientific
+        // notation, like `%e` does.
+        inline char* write_decimals(char* out, std::uint64_t decimals) {
+            for (int i = 5; i >= 0; --i) {
+                out[i] = static_cast<char>('0' + decimals % 10);
+                decimals /= 10;
+            }
+            return out + 6;
+        }
+
+        // Rounds a non-negative number to the nearest integer, and ties to
+        // the even one, as `printf` does with the exact value of a double.
+        // `error` is the difference between the exact value that `x`
+        // approximates and `x`, which decides the ties that are not exact.
+        inline std::uint64_t round_even(double x, double error) {
+            std::uint64_t result = static_cast<std::uint64_t>(x);
+            double const fraction = x - static_cast<double>(result);
+            if (fraction > 0.5 || (fraction == 0.5 &&
+                    (error > 0 || (error == 0 && result % 2 == 1))))
+                ++result;
+            return result;
+        }
+
+        inline char* write_double(char* out, double x) {
+            if (std::signbit(x))
+                *out++ = '-';
+            double const ax = std::fabs(x);
+
+            if (std::isnan(ax)) { std::memcpy(out, "nan", 3); return out + 3; }
+            if (std::isinf(ax)) { std::memcpy(out, "inf", 3); return out + 3; }
+
+            if (ax < 1e15) {
+                std::uint64_t integer = static_cast<std::uint64_t>(ax);
+                double const fraction = ax - static_cast<double>(integer);
+                double const scaled = fraction * 1e6;
+                std::uint64_t decimals = format_detail::round_even(
+                    scaled, std::fma(fraction, 1e6, -scaled));
+                if (decimals == 1000000) {
+                    ++integer;
+                    decimals = 0;
+                }
+                out = format_detail::write_unsigned(out, integer);
+                *out++ = '.';
+                return format_detail::write_decimals(out, decimals);
+            }
+
+            int exponent = static_cast<int>(std::floor(std::log10(ax)));
+            std::uint64_t mantissa = format_detail::round_even(
+                ax / std::pow(10.0, exponent) * 1e6, 0);
+            if (mantissa < 1000000) {
+                --exponent;
+                mantissa = format_detail::round_even(ax / std::pow(10.0, exponent) * 1e6, 0);
+            }
+            if (mantissa >= 10000000) {
+                mantissa /= 10;
+                ++exponent;
+            }
+            *out++ = static_cast<char>('0' + mantissa / 1000000);
+            *out++ = '.';
+            out = format_detail::write_decimals(out, mantissa % 1000000);
+            *out++ = 'e';
+            *out++ = '+';
+            return format_detail::write_unsigned(out, static_cast<unsigned>(exponent));
+        }
+
+        template <typename T>
+        struct formatter<T, hana::when<std::is_floating_point<T>::value>> {
+            static constexpr bool is_literal = false;
+            static constexpr bool is_bounded = true;
+            // A sign, 15 digits, a point and 6 decimals. Rounding the decimals
+            // never carries to a 16th digit, since doubles below `1e15` are
+            // spaced by more than a millionth near `1e15`.
+            static constexpr std::size_t max_size = 23;
+
+            static std::size_t size(T)
+            { return max_size; }
+
+            static char* apply(char* out, T x)
+            { return format_detail::write_double(out, static_cast<double>(x)); }
+        };
+
+        template <typename T>
+        using formatter_t = formatter<std::remove_cv_t<std::remove_reference_t<T>>>;
+
+        template <std::size_t N>
+        constexpr std::size_t total(std::size_t const (&xs)[N]) {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != N; ++i)
+                result += xs[i];
+            return result;
+        }
+
+        template <typename ...T>
+        struct max_size {
+            static_assert(detail::fast_and<formatter_t<T>::is_bounded...>::value,
+            "hana::experimental::max_formatted_size<T...> requires the size of "
+            "each 'T' to be bounded, which is not the case of std::string and "
+            "pointers to characters");
+
+            static constexpr std::size_t value = format_detail::total<sizeof...(T) + 1>(
+                {formatter_t<T>::max_size..., 0});
+        };
+
+        // The arguments are split in segments, which are either a maximal run
+        // of adjacent compile-time strings, or a single runtime argument.
+        // `bounds[s]` is the index of the first argument of the `s`-th
+        // segment, and `bounds[segments]` is `N`.
+        template <std::size_t N>
+        struct plan_bounds {
+            detail::array<std::size_t, N + 1> bounds;
+            std::size_t segments;
+        };
+
+        template <std::size_t N>
+        constexpr plan_bounds<N> make_plan_bounds(bool const (&literal)[N + 1]) {
+            plan_bounds<N> plan{};
+            for (std::size_t i = 0; i != N; ++i)
+                if (i == 0 || !literal[i] || !literal[i - 1])
+                    plan.bounds[plan.segments++] = i;
+            plan.bounds[plan.segments] = N;
+            return plan;
+        }
+
+        template <typename ...T>
+        struct write_plan {
+            static constexpr std::size_t N = sizeof...(T);
+            using types = hana::basic_tuple<std::remove_cv_t<std::remove_reference_t<T>>...>;
+
+            using plan_type = plan_bounds<N>;
+            static constexpr plan_type plan = format_detail::make_plan_bounds<N>(
+                {formatter_t<T>::is_literal..., false});
+
+            template <std::size_t i>
+            using type_at = std::remove_reference_t<decltype(
+                hana::at_c<i>(std::declval<types const&>())
+            )>;
+
+            template <std::size_t b, std::size_t ...k>
+            static constexpr auto literal(std::index_sequence<k...>)
+            { return hana::string_concat(type_at<b + k>{}...); }
+
+            template <std::size_t b, std::size_t e, typename Args>
+            static char* apply_segment(char* out, Args const&, hana::true_) {
+                constexpr auto segment = write_plan::literal<b>(std::make_index_sequence<e - b>{});
+                return formatter_t<decltype(segment)>::apply(out, segment);
+            }
+
+            template <std::size_t b, std::size_t e, typename Args>
+            static char* apply_segment(char* out, Args const& args, hana::false_)
+            { return formatter_t<type_at<b>>::apply(out, *hana::at_c<b>(args)); }
+
+            template <typename Args, std::size_t ...s>
+            static char* apply(char* out, Args const& args, std::index_sequence<s...>) {
+                using Swallow = int[];
+                (void)Swallow{0, (out = write_plan::apply_segment<
+                    plan.bounds[s], plan.bounds[s + 1]
+                >(out, args, hana::bool_c<
+                    formatter_t<type_at<plan.bounds[s]>>::is_literal
+                >), 0)...};
+                return out;
+            }
+
+            template <typename Args>
+            static char* apply(char* out, Args const& args) {
+                return write_plan::apply(out, args,
+                    std::make_index_sequence<plan.segments>{});
+            }
+        };
+
+        template <typename ...T>
+        constexpr typename write_plan<T...>::plan_type write_plan<T...>::plan;
+    }
+
+    //! @ingroup group-experimental
+    //! Upper bound on the number of characters written by `format_to` for
+    //! arguments of types `T...`.
+    //!
+    //! `hana::string`s count for their length, characters for 1, `bool`s
+    //! for 5, integers for their maximum number of digits plus a sign, and
+    //! floating point numbers for 23. This is only defined when all the
+    //! types have a bounded size, which is not the case of `std::string`
+    //! and pointers to characters, but is the case of arrays of characters.
+    template <typename ...T>
+    constexpr std::size_t max_formatted_size = format_detail::max_size<T...>::value;
+
+    //! @ingroup group-experimental
+    //! Writes a sequence of compile-time strings and runtime values to a
+    //! buffer, and returns a pointer past the last character written.
+    //!
+    //! `format_to(out, x...)` writes each `x` in turn, without separators.
+    //! `hana::string`s are the literal parts of the format; adjacent ones
+    //! are concatenated at compile-time, and each run of them is written
+    //! with a single `memcpy` from a static buffer. The other arguments are
+    //! written according to their type, which replaces the conversion
+    //! specifiers of `printf`: strings and characters as they are, `bool`s
+    //! as `true` or `false`, integers in decimal, and floating point numbers
+    //! with six decimals like `%f`, except that a magnitude of at least
+    //! `1e15` is written in scientific notation like `%e`. The output is the
+    //! same as that of `printf`, except that the last decimal in scientific
+    //! notation is computed in double precision, and can hence differ by one
+    //! unit in rare cases. `long double`s are written as `double`s.
+    //!
+    //! Nothing is parsed at runtime, no locale is used and nothing is
+    //! allocated. `out` must have room for the characters written, which is
+    //! at most `max_formatted_size<T...>` when it is defined. The result is
+    //! not null-terminated.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/format.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto format_to = [](char* out, auto const& ...x) -> char* {
+        return tag-dispatched;
+    };
+#else
+    struct format_to_t {
+        template <typename ...T>
+        char* operator()(char* out, T const& ...x) const {
+            return format_detail::write_plan<T...>::apply(out,
+                hana::make_basic_tuple(std::addressof(x)...));
+        }
+    };
+
+    constexpr format_to_t format_to{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Returns a `std::string` holding the characters written by `format_to`.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto format = [](auto const& ...x) -> std::string {
+        return tag-dispatched;
+    };
+#else
+    struct format_t {
+        template <typename ...T>
+        std::string operator()(T const& ...x) const {
+            std::size_t const size = format_detail::total<sizeof...(T) + 1>(
+                {format_detail::formatter_t<T>::size(x)..., 0});
+            std::string result(size, '\0');
+            char* const out = &result[0];
+            result.resize(static_cast<std::size_t>(format_to(out, x...) - out));
+            return result;
+        }
+    };
+
+    constexpr format_t format{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_FORMAT_HPP
@@ -0,0 +1,371 @@
+/*
+@file
+Defines `boost::hana::experimental::write_json` and
+`boost::hana::experimental::to_json`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_JSON_HPP
+#define BOOST_HANA_EXPERIMENTAL_JSON_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/iterable.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/fwd/string.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/string.hpp>
+
+#include <algorithm>
+#include <clocale>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(__has_include)
+#   if __has_include(<charconv>) && __cplusplus >= 201703L
+#       include <charconv>
+#   endif
+#endif
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace json_detail {
+        template <typename T, typename = void>
+        struct writer : writer<T, hana::when<true>> { };
+
+        template <typename T, bool condition>
+        struct writer<T, hana::when<condition>> {
+            static_assert(condition && !condition,
+            "hana::experimental::write_json(out, x) requires 'x' to be made of "
+            "Structs, Sequences, strings, characters and arithmetic types");
+        };
+
+        template <typename T>
+        void write(std::string& out, T const& x)
+        { writer<T>::apply(out, x); }
+
+        inline void write_string(std::string& out, char const* s, std::size_t n) {
+            static constexpr char hex[] = "0123456789abcdef";
+            out.push_back('"');
+            std::size_t run = 0;
+            for (std::size_t i = 0; i != n; ++i) {
+                unsigned char const c = static_cast<unsigned char>(s[i]);
+                if (c >= 0x20 && c != '"' && c != '\\')
+                    continue;
+
+                out.append(s + run, i - run);
+                run = i + 1;
+                switch (c) {
+                    case '"':  out.append("\\\"", 2); break;
+                    case '\\': out.append("\\\\", 2); break;
+                    case '\n': out.append("\\n", 2); break;
+                    case '\t': out.append("\\t", 2); break;
+                    case '\r': out.append("\\r", 2); break;
+                    default: {
+                        char const escaped[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf]};
+                        out.append(escaped, sizeof(escaped));
+                    }
+                }
+            }
+            out.append(s + run, n - run);
+            out.push_back('"');
+        }
+
+        // Strings
+        template <>
+        struct writer<std::string> {
+            static void apply(std::string& out, std::string const& s)
+            { json_detail::write_string(out, s.data(), s.size()); }
+        };
+
+        template <>
+        struct writer<char const*> {
+            static void apply(std::string& out, char const* s) {
+                std::size_t n = 0;
+                while (s[n] != '\0')
+                    ++n;
+                json_detail::write_string(out, s, n);
+            }
+        };
+
+        template <>
+        struct writer<char*> : writer<char const*> { };
+
+        template <std::size_t N>
+        struct writer<char[N]> {
+            static void apply(std::string& out, char const (&s)[N])
+            { writer<char const*>::apply(out, s); }
+        };
+
+        template <char ...s>
+        struct writer<hana::string<s...>> {
+            static void apply(std::string& out, hana::string<s...> const& str)
+            { json_detail::write_string(out, hana::to<char const*>(str), sizeof...(s)); }
+        };
+
+        template <>
+        struct writer<char> {
+            static void apply(std::string& out, char c)
+            { json_detail::write_string(out, &c, 1); }
+        };
+
+        // Arithmetic types
+        template <>
+        struct writer<bool> {
+            static void apply(std::string& out, bool b) {
+                if (b) out.append("true", 4);
+                else   out.append("false", 5);
+            }
+        };
+
+        template <typename T>
+        struct writer<T, hana::when<std::is_integral<T>::value>> {
+            static void apply(std::string& out, T x) {
+                using U = std::make_unsigned_t<T>;
+                char digits[std::numeric_limits<U>::digits10 + 2];
+                char* first = digits + sizeof(digits);
+                U u = x < 0 ? static_cast<U>(U{0} - static_cast<U>(x)) : static_cast<U>(x);
+                do {
+                    *--first = static_cast<char>('0' + u % 10);
+                    u /= 10;
+                } while (u != 0);
+                if (x < 0)
+                    *--first = '-';
+                out.append(first, static_cast<std::size_t>(digits + sizeof(digits) - first));
+            }
+        };
+
+        // JSON requires a '.' as the decimal point. `std::to_chars` always
+        // writes one, but `printf` writes that of the current C locale, which
+        // must then be replaced. Both write `max_digits10` significant digits
+        // so that the value can be read back exactly.
+        template <typename T>
+        char* write_floating_point(char* out, std::size_t size, T x) {
+        #if defined(__cpp_lib_to_chars)
+            return std::to_chars(out, out + size, x, std::chars_format::general,
+                                 std::numeric_limits<T>::max_digits10).ptr;
+        #else
+            int n = std::is_same<T, long double>::value
+                ? std::snprintf(out, size, "%.*Lg",
+                                std::numeric_limits<T>::max_digits10,
+                                static_cast<long double>(x))
+                : std::snprintf(out, size, "%.*g",
+                                std::numeric_limits<T>::max_digits10,
+                                static_cast<double>(x));
+            char* last = out + n;
+            char const* point = std::localeconv()->decimal_point;
+            std::size_t const length = std::strlen(point);
+            if (length == 0 || (length == 1 && *point == '.'))
+                return last;
+            char* found = std::search(out, last, point, point + length);
+            if (found != last) {
+                *found = '.';
+                last = std::copy(found + length, last, found + 1);
+            }
+            return last;
+        #endif
+        }
+
+        template <typename T>
+        struct writer<T, hana::when<std::is_floating_point<T>::value>> {
+            static void apply(std::string& out, T x) {
+                // JSON has no representation for infinities and NaNs.
+                if (!std::isfinite(x)) {
+                    out.append("null", 4);
+                    return;
+                }
+                char digits[64];
+                char* last = json_detail::write_floating_point(digits, sizeof(digits), x);
+                out.append(digits, static_cast<std::size_t>(last - digits));
+            }
+        };
+
+        // The text between the members of a `Struct` is known at compile-time.
+        // It is stored in one array holding the fragments `{"m0":`, `,"m1":`,
+        // ..., and `}` (or `{}` for a `Struct` without members), so writing a
+        // `Struct` only appends these fragments and the values of its members.
+        template <std::size_t N, std::size_t Size>
+        struct struct_fragments {
+            detail::array<char, Size> text;
+            detail::array<std::size_t, N + 2> offsets;
+        };
+
+        template <std::size_t N>
+        constexpr std::size_t struct_fragments_size(std::size_t const (&lengths)[N + 1]) {
+            std::size_t size = N == 0 ? 2 : 4 * N + 1;
+            for (std::size_t i = 0; i != N; ++i)
+                size += lengths[i];
+            return size;
+        }
+
+        template <std::size_t N, std::size_t Size>
+        constexpr struct_fragments<N, Size>
+        make_struct_fragments(char const* const (&names)[N + 1],
+                              std::size_t const (&lengths)[N + 1])
+        {
+            struct_fragments<N, Size> fragments{};
+            std::size_t k = 0;
+            fragments.text[k++] = '{';
+            for (std::size_t i = 0; i != N; ++i) {
+                fragments.offsets[i] = i == 0 ? 0 : k;
+                if (i != 0)
+                    fragments.text[k++] = ',';
+                fragments.text[k++] = '"';
+                for (std::size_t c = 0; c != lengths[i]; ++c)
+                    fragments.text[k++] = names[i][c];
+                fragments.text[k++] = '"';
+                fragments.text[k++] = ':';
+            }
+            fragments.offsets[N] = N == 0 ? 0 : k;
+            fragments.text[k++] = '}';
+            fragments.offsets[N + 1] = k;
+            return fragments;
+        }
+
+        template <typename T, typename Indices>
+        struct struct_writer;
+
+        template <typename T, std::size_t ...i>
+        struct struct_writer<T, std::index_sequence<i...>> {
+            template <std::size_t n>
+            using name_t = std::decay_t<decltype(
+                hana::first(hana::at_c<n>(hana::accessors<T>()))
+            )>;
+
+            static constexpr std::size_t N = sizeof...(i);
+            static constexpr std::size_t Size = json_detail::struct_fragments_size<N>(
+                {decltype(hana::length(name_t<i>{}))::value..., 0}
+            );
+
+            using fragments_type = struct_fragments<N, Size>;
+            static constexpr fragments_type fragments =
+                json_detail::make_struct_fragments<N, Size>(
+                    {hana::to<char const*>(name_t<i>{})..., nullptr},
+                    {decltype(hana::length(name_t<i>{}))::value..., 0}
+                );
+
+            template <std::size_t n>
+            static void fragment(std::string& out) {
+                out.append(fragments.text.begin() + fragments.offsets[n],
+                           fragments.offsets[n + 1] - fragments.offsets[n]);
+            }
+
+            static void apply(std::string& out, T const& x) {
+                using Swallow = int[];
+                (void)Swallow{0, (
+                    struct_writer::fragment<i>(out),
+                    json_detail::write(out, hana::second(hana::at_c<i>(hana::accessors<T>()))(x)),
+                0)...};
+                struct_writer::fragment<N>(out);
+            }
+        };
+
+        template <typename T, std::size_t ...i>
+        constexpr typename struct_writer<T, std::index_sequence<i...>>::fragments_type
+        struct_writer<T, std::index_sequence<i...>>::fragments;
+
+        template <typename T>
+        struct writer<T, hana::when<hana::Struct<T>::value>>
+            : struct_writer<T, std::make_index_sequence<
+                decltype(hana::length(hana::accessors<T>()))::value
+            >>
+        { };
+
+        // Sequences, and other finite Iterables like `std::array`
+        template <typename T>
+        struct writer<T, hana::when<
+            hana::Iterable<T>::value && hana::Foldable<T>::value &&
+            !hana::Struct<T>::value
+        >> {
+            template <typename Xs, std::size_t ...n>
+            static void apply_impl(std::string& out, Xs const& xs, std::index_sequence<n...>) {
+                using Swallow = int[];
+                (void)Swallow{0, (
+                    n == 0 ? void() : out.push_back(','),
+                    json_detail::write(out, hana::at_c<n>(xs)),
+                0)...};
+            }
+
+            static void apply(std::string& out, T const& xs) {
+                out.push_back('[');
+                apply_impl(out, xs, std::make_index_sequence<
+                    decltype(hana::length(xs))::value
+                >{});
+                out.push_back(']');
+            }
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Appends the JSON representation of an object to a string.
+    //!
+    //! `Struct`s are written as JSON objects whose keys are the names of
+    //! their members, and `Sequence`s (or more generally finite `Iterable`s,
+    //! like `std::array`) are written as JSON arrays. Strings
+    //! (`std::string`, `char const*` and `hana::string`) and characters
+    //! are written as JSON strings, `bool`s as `true` or `false`, and other
+    //! arithmetic types as numbers, with `null` for infinities and NaNs.
+    //! The output is compact, without any whitespace.
+    //!
+    //! The keys of a `Struct` and the punctuation around them are stored in
+    //! a single static array for each `Struct` type, so only the values are
+    //! formatted at runtime. Nothing is allocated except by `out` itself,
+    //! which does not allocate either once it has enough capacity; an output
+    //! string can hence be cleared and reused without any allocation.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/json.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto write_json = [](std::string& out, auto const& x) -> void {
+        return tag-dispatched;
+    };
+#else
+    struct write_json_t {
+        template <typename T>
+        void operator()(std::string& out, T const& x) const
+        { json_detail::write(out, x); }
+    };
+
+    constexpr write_json_t write_json{};
+#endif
+
+    //! @ingroup group-experimental
+    //! Returns the JSON representation of an object, as written by
+    //! `write_json`.
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    auto to_json = [](auto const& x) -> std::string {
+        return tag-dispatched;
+    };
+#else
+    struct to_json_t {
+        template <typename T>
+        std::string operator()(T const& x) const {
+            std::string out;
+            json_detail::write(out, x);
+            return out;
+        }
+    };
+
+    constexpr to_json_t to_json{};
+#endif
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_JSON_HPP
@@ -0,0 +1,470 @@
+/*
+@file
+Defines `boost::hana::experimental::soa_vector`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_SOA_VECTOR_HPP
+#define BOOST_HANA_EXPERIMENTAL_SOA_VECTOR_HPP
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/index_if.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/fwd/accessors.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    //! @ingroup group-experimental
+    //! Container storing the members of `Struct`s in separate arrays.
+    //!
+    //! `soa_vector<T>` holds a sequence of `T`s, where `T` is a `Struct`,
+    //! like a `std::vector<T>` would, except that each member of `T` is
+    //! stored in its own contiguous column. This layout, known as a
+    //! _structure of arrays_, makes scanning a few members of many objects
+    //! much more cache-friendly, since only the scanned columns are loaded.
+    //!
+    //! The objects themselves are not stored anywhere, so the elements of
+    //! a `soa_vector` are accessed through row proxies, which hold a pointer
+    //! to the container and an index. A row is a `Struct` with the same
+    //! member names as `T`, whose members are references into the columns;
+    //! hence `hana::at_key(row, BOOST_HANA_STRING("x"))` is a reference to
+    //! the `x` member of that row, and the rest of Hana's `Struct` support
+    //! (like `hana::keys` and `hana::members`) can be used on rows.
+    //! `column(key)` returns the whole column of the member named `key`,
+    //! which is looked up at compile-time. Unlike `std::vector<bool>`, the
+    //! `bool` members are stored one per byte, so that rows can refer to
+    //! them; the view of a `bool` column has no `data()`, however.
+    //!
+    //! The iterators of a `soa_vector` are random access iterators whose
+    //! `reference` is a row proxy, much like the iterators of
+    //! `std::vector<bool>`. Like with `std::vector`, inserting or erasing
+    //! elements invalidates the rows and iterators at or after the point
+    //! of insertion or erasure, and all of them if the capacity changes.
+    //! If copying or moving a member throws during `push_back`, the members
+    //! already appended are removed and the size of the container does not
+    //! change.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/soa_vector.cpp
+    template <typename T>
+    class soa_vector;
+
+    template <typename Vector>
+    struct soa_row;
+
+    template <typename T, bool is_const>
+    struct soa_row_tag;
+
+    namespace soa_detail {
+        template <typename T, std::size_t i>
+        using member_t = std::decay_t<decltype(
+            hana::second(hana::at_c<i>(hana::accessors<T>()))(std::declval<T&>())
+        )>;
+
+        template <typename T, std::size_t i>
+        using name_t = std::decay_t<decltype(
+            hana::first(hana::at_c<i>(hana::accessors<T>()))
+        )>;
+
+        // The `bool` members are not stored in a `std::vector<bool>`, whose
+        // elements are packed bits that cannot be referred to. Instead, each
+        // of them is stored in a cell, and the rows and the views of the
+        // column refer to the `bool` inside the cells.
+        struct bool_cell {
+            bool value;
+            bool_cell(bool v) : value{v} { }
+        };
+
+        template <typename M>
+        struct cell { using type = M; };
+
+        template <>
+        struct cell<bool> { using type = bool_cell; };
+
+        template <typename M>
+        M& element(M& x) { return x; }
+
+        inline bool& element(bool_cell& c) { return c.value; }
+        inline bool const& element(bool_cell const& c) { return c.value; }
+
+        template <typename T, typename Indices = std::make_index_sequence<
+            decltype(hana::length(hana::accessors<T>()))::value
+        >>
+        struct columns;
+
+        template <typename T, std::size_t ...i>
+        struct columns<T, std::index_sequence<i...>> {
+            using type = hana::tuple<std::vector<typename cell<member_t<T, i>>::type>...>;
+            using names = detail::pack<name_t<T, i>...>;
+        };
+
+        template <typename T, typename Key>
+        using column_index = detail::index_if<
+            decltype(hana::equal.to(std::declval<Key const&>())),
+            typename columns<T>::names
+        >;
+
+        // A view of a column, which gives access to its elements but cannot
+        // change its size.
+        template <typename M>
+        struct column_view {
+            M* first_;
+            M* last_;
+
+            using value_type = std::remove_const_t<M>;
+            using iterator = M*;
+
+            M* begin() const { return first_; }
+            M* end() const { return last_; }
+            M* data() const { return first_; }
+            std::size_t size() const { return static_cast<std::size_t>(last_ - first_); }
+            bool empty() const { return first_ == last_; }
+            M& operator[](std::size_t n) const { return first_[n]; }
+        };
+
+        // The iterator of a view of a column of `bool`s, which goes through
+        // the cells and refers to the `bool`s inside them.
+        template <typename Cell>
+        class bool_cell_iterator {
+            Cell* cell_;
+
+        public:
+            using value_type = bool;
+            using reference = decltype(soa_detail::element(std::declval<Cell&>()));
+            using pointer = std::remove_reference_t<reference>*;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+
+            bool_cell_iterator() : cell_{nullptr} { }
+            explicit bool_cell_iterator(Cell* cell) : cell_{cell} { }
+
+            reference operator*() const { return cell_->value; }
+            reference operator[](difference_type n) const { return cell_[n].value; }
+
+            bool_cell_iterator& operator++() { ++cell_; return *this; }
+            bool_cell_iterator& operator--() { --cell_; return *this; }
+            bool_cell_iterator operator++(int) { bool_cell_iterator it = *this; ++cell_; return it; }
+            bool_cell_iterator operator--(int) { bool_cell_iterator it = *this; --cell_; return it; }
+
+            bool_cell_iterator& operator+=(difference_type n) { cell_ += n; return *this; }
+            bool_cell_iterator& operator-=(difference_type n) { cell_ -= n; return *this; }
+
+            friend bool_cell_iterator operator+(bool_cell_iterator it, difference_type n) { return it += n; }
+            friend bool_cell_iterator operator+(difference_type n, bool_cell_iterator it) { return it += n; }
+            friend bool_cell_iterator operator-(bool_cell_iterator it, difference_type n) { return it -= n; }
+            friend difference_type operator-(bool_cell_iterator const& a, bool_cell_iterator const& b)
+            { return a.cell_ - b.cell_; }
+
+            friend bool operator==(bool_cell_iterator const& a, bool_cell_iterator const& b) { return a.cell_ == b.cell_; }
+            friend bool operator!=(bool_cell_iterator const& a, bool_cell_iterator const& b) { return a.cell_ != b.cell_; }
+            friend bool operator<(bool_cell_iterator const& a, bool_cell_iterator const& b)  { return a.cell_ < b.cell_; }
+            friend bool operator>(bool_cell_iterator const& a, bool_cell_iterator const& b)  { return a.cell_ > b.cell_; }
+            friend bool operator<=(bool_cell_iterator const& a, bool_cell_iterator const& b) { return a.cell_ <= b.cell_; }
+            friend bool operator>=(bool_cell_iterator const& a, bool_cell_iterator const& b) { return a.cell_ >= b.cell_; }
+        };
+
+        // A view of a column of `bool`s. Since the `bool`s are not
+        // contiguous, it has no `data()`.
+        template <typename Cell>
+        struct bool_column_view {
+            Cell* first_;
+            Cell* last_;
+
+            using value_type = bool;
+            using iterator = bool_cell_iterator<Cell>;
+
+            iterator begin() const { return iterator{first_}; }
+            iterator end() const { return iterator{last_}; }
+            std::size_t size() const { return static_cast<std::size_t>(last_ - first_); }
+            bool empty() const { return first_ == last_; }
+            typename iterator::reference operator[](std::size_t n) const { return first_[n].value; }
+        };
+
+        template <typename M>
+        column_view<M> make_view(M* first, M* last)
+        { return {first, last}; }
+
+        inline bool_column_view<bool_cell> make_view(bool_cell* first, bool_cell* last)
+        { return {first, last}; }
+
+        inline bool_column_view<bool_cell const> make_view(bool_cell const* first, bool_cell const* last)
+        { return {first, last}; }
+
+        template <typename Column>
+        auto make_view(Column& column) {
+            return soa_detail::make_view(column.data(), column.data() + column.size());
+        }
+
+        struct access {
+            template <typename Vector>
+            static auto& columns(Vector& vector) { return vector.columns_; }
+        };
+
+        template <std::size_t i>
+        struct row_accessor {
+            template <typename Row>
+            constexpr decltype(auto) operator()(Row&& row) const {
+                return soa_detail::element(
+                    hana::at_c<i>(soa_detail::access::columns(*row.vector_))[row.index_]
+                );
+            }
+        };
+
+        template <typename T, std::size_t ...i>
+        constexpr auto row_accessors(std::index_sequence<i...>) {
+            return hana::make_tuple(
+                hana::make_pair(name_t<T, i>{}, row_accessor<i>{})...
+            );
+        }
+    }
+
+    //! @ingroup group-experimental
+    //! Proxy to an element of a `soa_vector`; `Vector` is `soa_vector<T>`
+    //! or `soa_vector<T> const`. A row is a `Struct` whose members are
+    //! references to the elements of the columns of the `soa_vector`.
+    template <typename Vector>
+    struct soa_row {
+        Vector* vector_;
+        std::size_t index_;
+    };
+
+    template <typename Vector>
+    class soa_iterator {
+        Vector* vector_;
+        std::size_t index_;
+
+        template <typename>
+        friend class soa_iterator;
+
+    public:
+        using value_type = soa_row<Vector>;
+        using reference = soa_row<Vector>;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+        soa_iterator() : vector_{nullptr}, index_{0} { }
+        soa_iterator(Vector* vector, std::size_t index)
+            : vector_{vector}, index_{index}
+        { }
+
+        template <typename Other, typename = std::enable_if_t<
+            std::is_convertible<Other*, Vector*>::value
+        >>
+        soa_iterator(soa_iterator<Other> const& other)
+            : vector_{other.vector_}, index_{other.index_}
+        { }
+
+        std::size_t index() const { return index_; }
+
+        reference operator*() const { return {vector_, index_}; }
+        reference operator[](difference_type n) const
+        { return {vector_, index_ + static_cast<std::size_t>(n)}; }
+
+        soa_iterator& operator++() { ++index_; return *this; }
+        soa_iterator& operator--() { --index_; return *this; }
+        soa_iterator operator++(int) { soa_iterator it = *this; ++index_; return it; }
+        soa_iterator operator--(int) { soa_iterator it = *this; --index_; return it; }
+
+        soa_iterator& operator+=(difference_type n)
+        { index_ += static_cast<std::size_t>(n); return *this; }
+        soa_iterator& operator-=(difference_type n)
+        { index_ -= static_cast<std::size_t>(n); return *this; }
+
+        friend soa_iterator operator+(soa_iterator it, difference_type n) { return it += n; }
+        friend soa_iterator operator+(difference_type n, soa_iterator it) { return it += n; }
+        friend soa_iterator operator-(soa_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(soa_iterator const& a, soa_iterator const& b)
+        { return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_); }
+
+        friend bool operator==(soa_iterator const& a, soa_iterator const& b) { return a.index_ == b.index_; }
+        friend bool operator!=(soa_iterator const& a, soa_iterator const& b) { return a.index_ != b.index_; }
+        friend bool operator<(soa_iterator const& a, soa_iterator const& b)  { return a.index_ < b.index_; }
+        friend bool operator>(soa_iterator const& a, soa_iterator const& b)  { return a.index_ > b.index_; }
+        friend bool operator<=(soa_iterator const& a, soa_iterator const& b) { return a.index_ <= b.index_; }
+        friend bool operator>=(soa_iterator const& a, soa_iterator const& b) { return a.index_ >= b.index_; }
+    };
+
+    template <typename T>
+    class soa_vector {
+        static_assert(hana::Struct<T>::value,
+        "hana::experimental::soa_vector<T> requires 'T' to be a Struct");
+
+        using Columns = typename soa_detail::columns<T>::type;
+        static constexpr std::size_t N = decltype(hana::length(std::declval<Columns const&>()))::value;
+        static_assert(N != 0,
+        "hana::experimental::soa_vector<T> requires 'T' to have at least one member");
+
+        Columns columns_;
+
+        friend struct soa_detail::access;
+
+        template <typename F, std::size_t ...i>
+        void for_each_column(F&& f, std::index_sequence<i...>) {
+            using Swallow = int[];
+            (void)Swallow{0, ((void)f(hana::at_c<i>(columns_), hana::size_c<i>), 0)...};
+        }
+
+        template <typename F>
+        void for_each_column(F&& f)
+        { this->for_each_column(static_cast<F&&>(f), std::make_index_sequence<N>{}); }
+
+        // The members are appended one column at a time. If appending to a
+        // column throws, the guard removes the members already appended to
+        // the previous columns, so that all the columns keep the same size.
+        struct append_guard {
+            soa_vector* self;
+            std::size_t appended;
+
+            ~append_guard() {
+                if (appended == N)
+                    return;
+                std::size_t const n = appended;
+                self->for_each_column([n](auto& column, auto i) {
+                    if (decltype(i)::value < n)
+                        column.pop_back();
+                });
+            }
+        };
+
+        template <typename X>
+        void append(X&& x) {
+            append_guard guard{this, 0};
+            this->for_each_column([&x, &guard](auto& column, auto i) {
+                column.push_back(hana::second(hana::at_c<decltype(i)::value>(hana::accessors<T>()))(
+                    static_cast<X&&>(x)));
+                ++guard.appended;
+            });
+        }
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = soa_row<soa_vector>;
+        using const_reference = soa_row<soa_vector const>;
+        using iterator = soa_iterator<soa_vector>;
+        using const_iterator = soa_iterator<soa_vector const>;
+
+        soa_vector() = default;
+
+        // Capacity
+        std::size_t size() const { return hana::at_c<0>(columns_).size(); }
+        bool empty() const { return this->size() == 0; }
+
+        void reserve(std::size_t n) {
+            this->for_each_column([n](auto& column, auto) { column.reserve(n); });
+        }
+
+        // Modifiers
+        void push_back(T const& x)
+        { this->append(x); }
+
+        void push_back(T&& x)
+        { this->append(static_cast<T&&>(x)); }
+
+        void pop_back() {
+            this->for_each_column([](auto& column, auto) { column.pop_back(); });
+        }
+
+        iterator erase(const_iterator position) {
+            return this->erase(position, position + 1);
+        }
+
+        iterator erase(const_iterator first, const_iterator last) {
+            auto const b = static_cast<std::ptrdiff_t>(first.index());
+            auto const e = static_cast<std::ptrdiff_t>(last.index());
+            this->for_each_column([b, e](auto& column, auto) {
+                column.erase(column.begin() + b, column.begin() + e);
+            });
+            return iterator{this, first.index()};
+        }
+
+        void clear() {
+            this->for_each_column([](auto& column, auto) { column.clear(); });
+        }
+
+        // Element access
+        reference operator[](std::size_t n) { return {this, n}; }
+        const_reference operator[](std::size_t n) const { return {this, n}; }
+
+        reference front() { return (*this)[0]; }
+        const_reference front() const { return (*this)[0]; }
+        reference back() { return (*this)[this->size() - 1]; }
+        const_reference back() const { return (*this)[this->size() - 1]; }
+
+        //! Returns a view of the column holding the member named `key`,
+        //! whose elements can be modified but which cannot be resized.
+        template <typename Key>
+        auto column(Key const&) {
+            constexpr std::size_t i = soa_detail::column_index<T, Key>::value;
+            static_assert(i != N,
+            "hana::experimental::soa_vector<T>::column(key) requires 'key' to "
+            "be the name of a member of 'T'");
+            return soa_detail::make_view(hana::at_c<i>(columns_));
+        }
+
+        template <typename Key>
+        auto column(Key const&) const {
+            constexpr std::size_t i = soa_detail::column_index<T, Key>::value;
+            static_assert(i != N,
+            "hana::experimental::soa_vector<T>::column(key) requires 'key' to "
+            "be the name of a member of 'T'");
+            return soa_detail::make_view(hana::at_c<i>(columns_));
+        }
+
+        // Iterators
+        iterator begin() { return {this, 0}; }
+        iterator end() { return {this, this->size()}; }
+        const_iterator begin() const { return {this, 0}; }
+        const_iterator end() const { return {this, this->size()}; }
+        const_iterator cbegin() const { return this->begin(); }
+        const_iterator cend() const { return this->end(); }
+    };
+
+    template <typename T, bool is_const>
+    struct soa_row_tag { };
+} // end namespace experimental
+
+    template <typename T>
+    struct tag_of<experimental::soa_row<experimental::soa_vector<T>>> {
+        using type = experimental::soa_row_tag<T, false>;
+    };
+
+    template <typename T>
+    struct tag_of<experimental::soa_row<experimental::soa_vector<T> const>> {
+        using type = experimental::soa_row_tag<T, true>;
+    };
+
+    // Struct
+    template <typename T, bool is_const>
+    struct accessors_impl<experimental::soa_row_tag<T, is_const>> {
+        static constexpr auto apply() {
+            return experimental::soa_detail::row_accessors<T>(std::make_index_sequence<
+                decltype(hana::length(hana::accessors<T>()))::value
+            >{});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_SOA_VECTOR_HPP
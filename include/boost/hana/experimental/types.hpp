@@ -14,6 +14,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/metafunction.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/any_of.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
+#include <boost/hana/detail/type_at.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/contains.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
@@ -88,31 +90,13 @@ BOOST_HANA_NAMESPACE_BEGIN
         apply(hana::experimental::types<T...> const&, F const&) { return {}; }
     };
 
-    namespace types_detail {
-        template <std::size_t I, typename T>
-        struct elt { using type = T; };
-
-        template <typename Indices, typename ...T>
-        struct indexer;
-
-        template <std::size_t ...I, typename ...T>
-        struct indexer<std::index_sequence<I...>, T...>
-            : elt<I, T>...
-        { };
-
-        template <std::size_t I, typename T>
-        elt<I, T> get_elt(elt<I, T> const&);
-    }
-
     // Iterable
     template <>
     struct at_impl<hana::experimental::types_tag> {
         template <typename ...T, typename N>
         static constexpr auto
         apply(hana::experimental::types<T...> const&, N const&) {
-            using Indexer = types_detail::indexer<std::make_index_sequence<sizeof...(T)>, T...>;
-            using Nth = typename decltype(types_detail::get_elt<N::value>(Indexer{}))::type;
-            return hana::type<Nth>{};
+            return hana::type<detail::type_at<N::value, T...>>{};
         }
     };
 
@@ -126,18 +110,16 @@ BOOST_HANA_NAMESPACE_BEGIN
 
     template <>
     struct drop_front_impl<hana::experimental::types_tag> {
-        template <std::size_t n, typename Indexer, std::size_t ...i>
-        static hana::experimental::types<
-            typename decltype(types_detail::get_elt<i + n>(Indexer{}))::type...
-        > helper(std::index_sequence<i...>);
+        template <std::size_t n, typename ...T, std::size_t ...i>
+        static hana::experimental::types<detail::type_at<i + n, T...>...>
+        helper(hana::experimental::types<T...> const&, std::index_sequence<i...>);
 
         template <typename ...T, typename N>
         static constexpr auto
-        apply(hana::experimental::types<T...> const&, N const&) {
+        apply(hana::experimental::types<T...> const& xs, N const&) {
             constexpr std::size_t n = N::value > sizeof...(T) ? sizeof...(T) : N::value;
-            using Indices = std::make_index_sequence<sizeof...(T) - n>;
-            using Indexer = types_detail::indexer<std::make_index_sequence<sizeof...(T)>, T...>;
-            return decltype(helper<n, Indexer>(Indices{})){};
+            using Indices = detail::make_index_sequence<sizeof...(T) - n>;
+            return decltype(helper<n>(xs, Indices{})){};
         }
     };
 
@@ -0,0 +1,241 @@
+/*!
+@file
+Defines `boost::hana::experimental::types_map`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_TYPES_MAP_HPP
+#define BOOST_HANA_EXPERIMENTAL_TYPES_MAP_HPP
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/fwd/any_of.hpp>
+#include <boost/hana/fwd/at_key.hpp>
+#include <boost/hana/fwd/contains.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/find.hpp>
+#include <boost/hana/fwd/find_if.hpp>
+#include <boost/hana/fwd/insert.hpp>
+#include <boost/hana/fwd/keys.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Association of a `Key` type to a `Value` type in a `types_map`.
+        template <typename Key, typename Value>
+        struct type_pair {
+            using first_type = Key;
+            using second_type = Value;
+        };
+
+        //! @ingroup group-experimental
+        //! Map optimized for associating types to types.
+        //!
+        //! `types_map` is a counterpart of `hana::map` for maps whose keys
+        //! and values are all `hana::type`s, which is the case of most
+        //! compile-time registries. It does not hold anything at runtime;
+        //! its associations are its template parameters, which must be
+        //! `type_pair`s, and a key is looked up by overload resolution on
+        //! the bases of an indexer inheriting from all of these `type_pair`s.
+        //! The keys must be distinct types, which `hana::insert` makes sure
+        //! of.
+        //!
+        //! `types_map` models `Comparable`, `Searchable` and `Foldable` like
+        //! `hana::map` does, and it can be used with `hana::insert` and
+        //! `hana::keys`. Unpacking a `types_map` yields `hana::pair`s of
+        //! `hana::type`s, and its keys are returned as `experimental::types`.
+        template <typename ...Pairs>
+        struct types_map;
+
+        struct types_map_tag;
+
+        //////////////////////////////////////////////////////////////////////
+
+        template <typename ...Pairs>
+        struct types_map { };
+    } // end namespace experimental
+
+    template <typename ...Pairs>
+    struct tag_of<experimental::types_map<Pairs...>> {
+        using type = experimental::types_map_tag;
+    };
+
+    namespace types_map_detail {
+        template <typename ...Pairs>
+        struct indexer : Pairs... { };
+
+        template <typename Key, typename Value>
+        experimental::type_pair<Key, Value>
+        lookup(experimental::type_pair<Key, Value> const*);
+
+        template <typename Key>
+        void lookup(...);
+
+        // The `type_pair` associating `Key` to a value in the map, or `void`
+        // if there is no such `type_pair`.
+        template <typename Key, typename ...Pairs>
+        using find = decltype(
+            types_map_detail::lookup<Key>(static_cast<indexer<Pairs...>*>(nullptr))
+        );
+
+        template <typename Key, typename ...Pairs>
+        using contains = hana::bool_<
+            !std::is_void<find<Key, Pairs...>>::value
+        >;
+    }
+
+    // Comparable
+    template <>
+    struct equal_impl<hana::experimental::types_map_tag, hana::experimental::types_map_tag> {
+        template <typename ...Pairs1, typename ...Pairs2>
+        static constexpr auto
+        apply(hana::experimental::types_map<Pairs1...> const&,
+              hana::experimental::types_map<Pairs2...> const&)
+            -> hana::bool_<
+                sizeof...(Pairs1) == sizeof...(Pairs2) &&
+                detail::fast_and<
+                    std::is_base_of<Pairs1, types_map_detail::indexer<Pairs2...>>::value...
+                >::value
+            >
+        { return {}; }
+    };
+
+    // Foldable
+    template <>
+    struct unpack_impl<hana::experimental::types_map_tag> {
+        template <typename ...Pairs, typename F>
+        static constexpr decltype(auto)
+        apply(hana::experimental::types_map<Pairs...> const&, F&& f) {
+            return static_cast<F&&>(f)(hana::make_pair(
+                hana::type<typename Pairs::first_type>{},
+                hana::type<typename Pairs::second_type>{}
+            )...);
+        }
+    };
+
+    // Searchable
+    template <>
+    struct any_of_impl<hana::experimental::types_map_tag> {
+        template <typename ...Pairs, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types_map<Pairs...> const&, Pred const&) {
+            using Results = decltype(detail::make_predicate_results<Pred const&>{}(
+                hana::type<typename Pairs::first_type>{}...
+            ));
+            return hana::bool_c<Results::count != 0>;
+        }
+    };
+
+    template <>
+    struct find_if_impl<hana::experimental::types_map_tag> {
+        template <std::size_t i, typename ...Pairs>
+        static constexpr auto helper(hana::false_) { return hana::nothing; }
+
+        template <std::size_t i, typename ...Pairs>
+        static constexpr auto helper(hana::true_) {
+            using Nth = detail::type_at<i, Pairs...>;
+            return hana::just(hana::type<typename Nth::second_type>{});
+        }
+
+        template <typename ...Pairs, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types_map<Pairs...> const&, Pred const&) {
+            using Results = decltype(detail::make_predicate_results<Pred const&>{}(
+                hana::type<typename Pairs::first_type>{}...
+            ));
+            constexpr std::size_t i = Results::first_satisfied;
+            return find_if_impl::helper<i, Pairs...>(hana::bool_c<(i < sizeof...(Pairs))>);
+        }
+    };
+
+    template <>
+    struct find_impl<hana::experimental::types_map_tag> {
+        template <typename Pair>
+        static constexpr auto helper(Pair*)
+        { return hana::just(hana::type<typename Pair::second_type>{}); }
+
+        static constexpr hana::optional<> helper(void*) { return {}; }
+
+        template <typename ...Pairs, typename Key>
+        static constexpr auto
+        apply(hana::experimental::types_map<Pairs...> const&, hana::basic_type<Key> const&) {
+            using Pair = types_map_detail::find<Key, Pairs...>;
+            return find_impl::helper(static_cast<Pair*>(nullptr));
+        }
+
+        static constexpr hana::optional<> apply(...) { return {}; }
+    };
+
+    template <>
+    struct contains_impl<hana::experimental::types_map_tag> {
+        template <typename ...Pairs, typename Key>
+        static constexpr auto
+        apply(hana::experimental::types_map<Pairs...> const&, hana::basic_type<Key> const&)
+            -> types_map_detail::contains<Key, Pairs...>
+        { return {}; }
+
+        static constexpr hana::false_ apply(...) { return {}; }
+    };
+
+    template <>
+    struct at_key_impl<hana::experimental::types_map_tag> {
+        template <typename ...Pairs, typename Key>
+        static constexpr auto
+        apply(hana::experimental::types_map<Pairs...> const&, hana::basic_type<Key> const&) {
+            using Pair = types_map_detail::find<Key, Pairs...>;
+            static_assert(!std::is_void<Pair>::value,
+            "hana::at_key(map, key) requires the 'key' to be present in the 'map'");
+            return hana::type<typename Pair::second_type>{};
+        }
+    };
+
+    // keys
+    template <>
+    struct keys_impl<hana::experimental::types_map_tag> {
+        template <typename ...Pairs>
+        static constexpr hana::experimental::types<typename Pairs::first_type...>
+        apply(hana::experimental::types_map<Pairs...> const&)
+        { return {}; }
+    };
+
+    // insert
+    template <>
+    struct insert_impl<hana::experimental::types_map_tag> {
+        template <typename ...Pairs, typename Pair>
+        static constexpr auto
+        apply(hana::experimental::types_map<Pairs...> const&, Pair const& pair) {
+            using Key = typename detail::decay<decltype(hana::first(pair))>::type::type;
+            using Value = typename detail::decay<decltype(hana::second(pair))>::type::type;
+            using Result = std::conditional_t<
+                types_map_detail::contains<Key, Pairs...>::value,
+                hana::experimental::types_map<Pairs...>,
+                hana::experimental::types_map<
+                    Pairs..., hana::experimental::type_pair<Key, Value>
+                >
+            >;
+            return Result{};
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_TYPES_MAP_HPP
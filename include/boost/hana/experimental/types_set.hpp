@@ -0,0 +1,178 @@
+/*!
+@file
+Defines `boost::hana::experimental::types_set`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_TYPES_SET_HPP
+#define BOOST_HANA_EXPERIMENTAL_TYPES_SET_HPP
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
+#include <boost/hana/detail/type_at.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/fwd/any_of.hpp>
+#include <boost/hana/fwd/at_key.hpp>
+#include <boost/hana/fwd/contains.hpp>
+#include <boost/hana/fwd/core/tag_of.hpp>
+#include <boost/hana/fwd/equal.hpp>
+#include <boost/hana/fwd/find_if.hpp>
+#include <boost/hana/fwd/insert.hpp>
+#include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace experimental {
+        //! @ingroup group-experimental
+        //! Set optimized for holding types.
+        //!
+        //! `types_set` is a counterpart of `hana::set` for sets containing
+        //! `hana::type`s only. It does not hold anything at runtime; its
+        //! elements are its template parameters, and membership is decided
+        //! by overload resolution on the bases of an indexer inheriting
+        //! from one empty class per element. The elements must be distinct
+        //! types, which `hana::insert` makes sure of.
+        //!
+        //! `types_set` models `Comparable`, `Searchable` and `Foldable`,
+        //! and it can be used with `hana::insert`.
+        template <typename ...T>
+        struct types_set;
+
+        struct types_set_tag;
+
+        //////////////////////////////////////////////////////////////////////
+
+        template <typename ...T>
+        struct types_set { };
+    } // end namespace experimental
+
+    template <typename ...T>
+    struct tag_of<experimental::types_set<T...>> {
+        using type = experimental::types_set_tag;
+    };
+
+    namespace types_set_detail {
+        template <typename T>
+        struct key { };
+
+        template <typename ...T>
+        struct indexer : key<T>... { };
+
+        template <typename T>
+        hana::true_ lookup(key<T> const*);
+
+        template <typename T>
+        hana::false_ lookup(...);
+
+        template <typename U, typename ...T>
+        using contains = decltype(
+            types_set_detail::lookup<U>(static_cast<indexer<T...>*>(nullptr))
+        );
+    }
+
+    // Comparable
+    template <>
+    struct equal_impl<hana::experimental::types_set_tag, hana::experimental::types_set_tag> {
+        template <typename ...T, typename ...U>
+        static constexpr auto
+        apply(hana::experimental::types_set<T...> const&,
+              hana::experimental::types_set<U...> const&)
+            -> hana::bool_<
+                sizeof...(T) == sizeof...(U) &&
+                detail::fast_and<types_set_detail::contains<T, U...>::value...>::value
+            >
+        { return {}; }
+    };
+
+    // Foldable
+    template <>
+    struct unpack_impl<hana::experimental::types_set_tag> {
+        template <typename ...T, typename F>
+        static constexpr decltype(auto)
+        apply(hana::experimental::types_set<T...> const&, F&& f) {
+            return static_cast<F&&>(f)(hana::type<T>{}...);
+        }
+    };
+
+    // Searchable
+    template <>
+    struct any_of_impl<hana::experimental::types_set_tag> {
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types_set<T...> const&, Pred const&) {
+            using Results = decltype(detail::make_predicate_results<Pred const&>{}(
+                hana::type<T>{}...
+            ));
+            return hana::bool_c<Results::count != 0>;
+        }
+    };
+
+    template <>
+    struct find_if_impl<hana::experimental::types_set_tag> {
+        template <std::size_t i, typename ...T>
+        static constexpr auto helper(hana::false_) { return hana::nothing; }
+
+        template <std::size_t i, typename ...T>
+        static constexpr auto helper(hana::true_)
+        { return hana::just(hana::type<detail::type_at<i, T...>>{}); }
+
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        apply(hana::experimental::types_set<T...> const&, Pred const&) {
+            using Results = decltype(detail::make_predicate_results<Pred const&>{}(
+                hana::type<T>{}...
+            ));
+            constexpr std::size_t i = Results::first_satisfied;
+            return find_if_impl::helper<i, T...>(hana::bool_c<(i < sizeof...(T))>);
+        }
+    };
+
+    template <>
+    struct contains_impl<hana::experimental::types_set_tag> {
+        template <typename ...T, typename U>
+        static constexpr auto
+        apply(hana::experimental::types_set<T...> const&, hana::basic_type<U> const&)
+            -> types_set_detail::contains<U, T...>
+        { return {}; }
+
+        static constexpr hana::false_ apply(...) { return {}; }
+    };
+
+    template <>
+    struct at_key_impl<hana::experimental::types_set_tag> {
+        template <typename ...T, typename U>
+        static constexpr hana::type<U>
+        apply(hana::experimental::types_set<T...> const&, hana::basic_type<U> const&) {
+            static_assert(types_set_detail::contains<U, T...>::value,
+            "hana::at_key(set, key) requires the 'key' to be present in the 'set'");
+            return {};
+        }
+    };
+
+    // insert
+    template <>
+    struct insert_impl<hana::experimental::types_set_tag> {
+        template <typename ...T, typename U>
+        static constexpr auto
+        apply(hana::experimental::types_set<T...> const&, hana::basic_type<U> const&)
+            -> std::conditional_t<
+                types_set_detail::contains<U, T...>::value,
+                hana::experimental::types_set<T...>,
+                hana::experimental::types_set<T..., U>
+            >
+        { return {}; }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_TYPES_SET_HPP
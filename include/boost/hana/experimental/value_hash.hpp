@@ -0,0 +1,138 @@
+/*
+@file
+Defines `boost::hana::experimental::value_hash` and
+`boost::hana::experimental::value_equal`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_VALUE_HASH_HPP
+#define BOOST_HANA_EXPERIMENTAL_VALUE_HASH_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/packed_layout.hpp>
+#include <boost/hana/detail/perfect_hash.hpp>
+#include <boost/hana/equal.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+
+BOOST_HANA_NAMESPACE_BEGIN namespace experimental {
+    namespace value_hash_detail {
+        // Objects whose value is entirely determined by their object
+        // representation, which can hence be hashed as bytes. This is not
+        // the case of floating point numbers, where `0.0 == -0.0`, nor of
+        // types with padding or with pointers to their value.
+        template <typename T>
+        struct is_packed
+            : std::integral_constant<bool,
+                !detail::layout_elements<T>::is_composite && (
+                    std::is_integral<T>::value ||
+                    std::is_enum<T>::value ||
+                    std::is_pointer<T>::value
+                )
+            >
+        { };
+
+        template <typename T, std::size_t N>
+        struct is_packed<T[N]> : is_packed<T> { };
+
+        template <typename T, bool = detail::layout_elements<T>::is_composite>
+        struct hash_element;
+
+        struct hasher {
+            std::uint64_t state;
+
+            void word(std::uint64_t w) {
+                state = (state ^ w) * 0x9e3779b97f4a7c15ull;
+                state ^= state >> 29;
+            }
+
+            void bytes(char const* p, std::size_t n) {
+                for (; n >= 8; p += 8, n -= 8) {
+                    std::uint64_t w;
+                    std::memcpy(&w, p, 8);
+                    hasher::word(w);
+                }
+                if (n != 0) {
+                    std::uint64_t w = 0;
+                    std::memcpy(&w, p, n);
+                    hasher::word(w ^ (std::uint64_t{n} << 56));
+                }
+            }
+
+            template <typename X>
+            void element(X const& x)
+            { hash_element<X>::apply(*this, x); }
+        };
+
+        template <typename T>
+        struct hash_element<T, true> {
+            static void apply(hasher& h, T const& x)
+            { detail::packed_layout<T, is_packed>::apply(x, h); }
+        };
+
+        template <typename T>
+        struct hash_element<T, false> {
+            static void apply(hasher& h, T const& x)
+            { hash_element::apply(h, x, std::is_empty<T>{}); }
+
+            // Empty objects like `hana::integral_constant`s have no value
+            // beyond their type.
+            static void apply(hasher&, T const&, std::true_type) { }
+
+            static void apply(hasher& h, T const& x, std::false_type)
+            { h.word(static_cast<std::uint64_t>(std::hash<T>{}(x))); }
+        };
+    }
+
+    //! @ingroup group-experimental
+    //! Function object hashing the value of a `Struct` or a `Sequence`.
+    //!
+    //! The hash of a `Struct` or a `Sequence` is derived from the hashes of
+    //! its members, which are either `Struct`s and `Sequence`s, hashed
+    //! recursively, empty objects like `hana::integral_constant`s, which are
+    //! skipped, or objects hashed with `std::hash`. Adjacent integral, enum
+    //! and pointer members are hashed together as a single block of bytes
+    //! when they are not separated by padding, in the same way that
+    //! `binary_encode` copies them, which makes hashing records of such
+    //! members about as fast as hashing an integer per 8 bytes.
+    //!
+    //! `value_hash` is consistent with `value_equal`, and the two are meant
+    //! to be used as the `Hash` and `KeyEqual` of unordered containers.
+    //! `value_hash` can also be used to specialize `std::hash` for a type,
+    //! by deriving from it. The hash depends on the object representation of
+    //! the members, so it is not stable across platforms.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/experimental/value_hash.cpp
+    struct value_hash {
+        template <typename T>
+        std::size_t operator()(T const& x) const {
+            value_hash_detail::hasher h{0x243f6a8885a308d3ull};
+            h.element(x);
+            return static_cast<std::size_t>(detail::mix_hash(h.state));
+        }
+    };
+
+    //! @ingroup group-experimental
+    //! Function object comparing two objects with `hana::equal`.
+    //!
+    //! This is the equality matching `value_hash`, for `Struct`s and
+    //! `Sequence`s without an `operator==`.
+    struct value_equal {
+        template <typename T>
+        bool operator()(T const& x, T const& y) const
+        { return static_cast<bool>(hana::equal(x, y)); }
+    };
+} BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_EXPERIMENTAL_VALUE_HASH_HPP
@@ -12,8 +12,11 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/and.hpp>
 #include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/fwd/ap.hpp>
@@ -34,6 +37,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/unpack.hpp>
 
 #include <cstddef>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -47,7 +51,8 @@ Distributed under the Boost Software License, Version 1.0.
 //     - Lose the ability to move from temporary containers
 //     - When fetching the members of a view multiple times, no caching is done.
 //       So for example, `t = transform(xs, f); at_c<0>(t); at_c<0>(t)` will
-//       compute `f(at_c<0>(xs))` twice.
+//       compute `f(at_c<0>(xs))` twice. `cached_transformed` can be used when
+//       this is a problem, at the cost of storing the results in the view.
 //     - push_back creates a joint_view and a single_view. The single_view holds
 //       the value as a member. When doing multiple push_backs, we end up with a
 //         joint_view<xxx, joint_view<single_view<T>, joint_view<single_view<T>, ....>>>
@@ -66,6 +71,9 @@ namespace experimental {
             static constexpr bool value = false;
         };
 
+        template <typename Sequence>
+        struct is_view<Sequence const> : is_view<Sequence> { };
+
         template <typename Sequence>
         using view_storage = typename std::conditional<
             detail::is_view<Sequence>::value, Sequence, Sequence&
@@ -118,18 +126,121 @@ namespace experimental {
         };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // cached_transformed_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // Storage for a value computed on first access. Copying a slot does
+        // not copy the value it might hold; the copy computes it again.
+        template <typename T>
+        struct cache_slot {
+            cache_slot() = default;
+            cache_slot(cache_slot const&) { }
+            cache_slot& operator=(cache_slot const&) = delete;
+
+            ~cache_slot() {
+                if (engaged_)
+                    pointer()->~T();
+            }
+
+            template <typename Compute>
+            T const& get(Compute const& compute) const {
+                if (!engaged_) {
+                    ::new (static_cast<void*>(&storage_)) T(compute());
+                    engaged_ = true;
+                }
+                return *pointer();
+            }
+
+        private:
+            T* pointer() const { return reinterpret_cast<T*>(&storage_); }
+
+            mutable typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+            mutable bool engaged_ = false;
+        };
+
+        template <typename Sequence, typename F, typename Indices =
+            std::make_index_sequence<decltype(hana::length(std::declval<Sequence&>()))::value>>
+        struct transformed_cache;
+
+        template <typename Sequence, typename F, std::size_t ...i>
+        struct transformed_cache<Sequence, F, std::index_sequence<i...>> {
+            using type = hana::basic_tuple<cache_slot<
+                typename hana::detail::decay<decltype(
+                    std::declval<F const&>()(hana::at_c<i>(std::declval<Sequence&>()))
+                )>::type
+            >...>;
+        };
+    }
+
+    // Contrary to `transformed_view_t`, the result of applying `f` to each
+    // element is computed at most once and stored in the view. Since it
+    // owns these results, this view is held by reference in other views,
+    // like a container would be, and it can't be used in constant
+    // expressions.
+    template <typename Sequence, typename F>
+    struct cached_transformed_view_t {
+        detail::view_storage<Sequence> sequence_;
+        F f_;
+        typename detail::transformed_cache<Sequence, F>::type cache_;
+        using hana_tag = view_tag;
+    };
+
+    template <typename Sequence, typename F>
+    cached_transformed_view_t<Sequence, typename hana::detail::decay<F>::type>
+    cached_transformed(Sequence& sequence, F&& f) {
+        return {sequence, static_cast<F&&>(f), {}};
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // filtered_view
     //////////////////////////////////////////////////////////////////////////
-#if 0
+    namespace detail {
+        template <typename Sequence, typename Results, typename Indices =
+            std::make_index_sequence<Results::count>>
+        struct filtered_view;
+
+        template <typename Sequence, typename Results, std::size_t ...k>
+        struct filtered_view<Sequence, Results, std::index_sequence<k...>> {
+            using type = sliced_view_t<Sequence, Results::template indices<true>[k]...>;
+        };
+    }
+
+    // The predicate must return a compile-time `Logical`; it is applied to
+    // every element once, when the type of the view is computed.
     template <typename Sequence, typename Pred>
-    using filtered_view_t = sliced_view_t<Sequence, detail::filtered_indices<...>>;
+    using filtered_view_t = typename detail::filtered_view<Sequence,
+        decltype(hana::unpack(std::declval<Sequence&>(),
+                              hana::detail::make_predicate_results<Pred>{}))
+    >::type;
 
     template <typename Sequence, typename Pred>
-    constexpr filtered_view_t<Sequence, Pred> filtered(Sequence& sequence, Pred&& pred) {
+    constexpr filtered_view_t<Sequence, typename hana::detail::decay<Pred>::type>
+    filtered(Sequence& sequence, Pred&&) {
+        return {sequence};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // reversed_view
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename Sequence, typename Indices =
+            std::make_index_sequence<decltype(hana::length(std::declval<Sequence&>()))::value>>
+        struct reversed_view;
+
+        template <typename Sequence, std::size_t ...i>
+        struct reversed_view<Sequence, std::index_sequence<i...>> {
+            using type = sliced_view_t<Sequence, sizeof...(i) - 1 - i...>;
+        };
+    }
+
+    template <typename Sequence>
+    using reversed_view_t = typename detail::reversed_view<Sequence>::type;
+
+    template <typename Sequence>
+    constexpr reversed_view_t<Sequence> reversed(Sequence& sequence) {
         return {sequence};
     }
-#endif
 
     //////////////////////////////////////////////////////////////////////////
     // joined_view
@@ -156,6 +267,38 @@ namespace experimental {
         };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // zipped_view
+    //////////////////////////////////////////////////////////////////////////
+    template <typename ...Sequences>
+    struct zipped_view_t {
+        hana::basic_tuple<detail::view_storage<Sequences>...> sequences_;
+        using hana_tag = view_tag;
+    };
+
+    struct make_zipped_view_t {
+        template <typename Sequence, typename ...Sequences>
+        constexpr zipped_view_t<Sequence, Sequences...>
+        operator()(Sequence& s, Sequences& ...ss) const {
+            static_assert(hana::detail::fast_and<(
+                decltype(hana::length(s))::value == decltype(hana::length(ss))::value
+            )...>::value,
+            "hana::experimental::zipped(s1, ..., sn) requires all the sequences "
+            "to have the same length");
+            return {hana::basic_tuple<
+                detail::view_storage<Sequence>, detail::view_storage<Sequences>...
+            >{s, ss...}};
+        }
+    };
+    constexpr make_zipped_view_t zipped{};
+
+    namespace detail {
+        template <typename ...Sequences>
+        struct is_view<zipped_view_t<Sequences...>> {
+            static constexpr bool value = true;
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // single_view
     //////////////////////////////////////////////////////////////////////////
@@ -237,6 +380,38 @@ struct unpack_impl<experimental::view_tag> {
                              std::make_index_sequence<N2>{});
     }
 
+    // cached_transformed_view
+    template <typename Sequence, typename F, typename G, std::size_t ...i>
+    static decltype(auto)
+    unpack_cached(experimental::cached_transformed_view_t<Sequence, F> const& view,
+                  G&& g, std::index_sequence<i...>)
+    {
+        (void)view; // Remove spurious unused variable warning with GCC
+        return static_cast<G&&>(g)(hana::at_c<i>(view)...);
+    }
+
+    template <typename Sequence, typename F, typename G>
+    static decltype(auto)
+    apply(experimental::cached_transformed_view_t<Sequence, F> const& view, G&& g) {
+        constexpr auto N = decltype(hana::length(view.sequence_))::value;
+        return unpack_cached(view, static_cast<G&&>(g), std::make_index_sequence<N>{});
+    }
+
+    // zipped_view
+    template <typename View, typename F, std::size_t ...i>
+    static constexpr decltype(auto)
+    unpack_zipped(View view, F&& f, std::index_sequence<i...>) {
+        (void)view; // Remove spurious unused variable warning with GCC
+        return static_cast<F&&>(f)(hana::at_c<i>(view)...);
+    }
+
+    template <typename ...Sequences, typename F>
+    static constexpr decltype(auto)
+    apply(experimental::zipped_view_t<Sequences...> view, F&& f) {
+        constexpr auto N = decltype(hana::length(hana::at_c<0>(view.sequences_)))::value;
+        return unpack_zipped(view, static_cast<F&&>(f), std::make_index_sequence<N>{});
+    }
+
     // single_view
     template <typename T, typename F>
     static constexpr decltype(auto) apply(experimental::single_view_t<T> view, F&& f) {
@@ -289,6 +464,29 @@ struct at_impl<experimental::view_tag> {
         return at_joined_view<Left>(view, n, hana::bool_c<(N::value < Left)>);
     }
 
+    // cached_transformed_view
+    template <typename Sequence, typename F, typename N>
+    static decltype(auto)
+    apply(experimental::cached_transformed_view_t<Sequence, F> const& view, N const&) {
+        constexpr std::size_t n = N::value;
+        return hana::at_c<n>(view.cache_).get([&]() -> decltype(auto) {
+            return view.f_(hana::at_c<n>(view.sequence_));
+        });
+    }
+
+    // zipped_view
+    template <std::size_t n, typename View, std::size_t ...s>
+    static constexpr auto at_zipped(View view, std::index_sequence<s...>) {
+        (void)view; // Remove spurious unused variable warning with GCC
+        return hana::make_tuple(hana::at_c<n>(hana::at_c<s>(view.sequences_))...);
+    }
+
+    template <typename ...Sequences, typename N>
+    static constexpr auto
+    apply(experimental::zipped_view_t<Sequences...> view, N const&) {
+        return at_zipped<N::value>(view, std::index_sequence_for<Sequences...>{});
+    }
+
     // single_view
     template <typename T, typename N>
     static constexpr decltype(auto) apply(experimental::single_view_t<T> view, N const&) {
@@ -326,6 +524,19 @@ struct length_impl<experimental::view_tag> {
         >;
     }
 
+    // cached_transformed_view
+    template <typename Sequence, typename F>
+    static constexpr auto
+    apply(experimental::cached_transformed_view_t<Sequence, F> const& view) {
+        return hana::length(view.sequence_);
+    }
+
+    // zipped_view
+    template <typename ...Sequences>
+    static constexpr auto apply(experimental::zipped_view_t<Sequences...> view) {
+        return hana::length(hana::at_c<0>(view.sequences_));
+    }
+
     // single_view
     template <typename T>
     static constexpr auto apply(experimental::single_view_t<T>) {
@@ -360,6 +571,19 @@ struct is_empty_impl<experimental::view_tag> {
                           hana::is_empty(view.sequence2_));
     }
 
+    // cached_transformed_view
+    template <typename Sequence, typename F>
+    static constexpr auto
+    apply(experimental::cached_transformed_view_t<Sequence, F> const& view) {
+        return hana::is_empty(view.sequence_);
+    }
+
+    // zipped_view
+    template <typename ...Sequences>
+    static constexpr auto apply(experimental::zipped_view_t<Sequences...> view) {
+        return hana::is_empty(hana::at_c<0>(view.sequences_));
+    }
+
     // single_view
     template <typename T>
     static constexpr auto apply(experimental::single_view_t<T>) {
@@ -375,7 +599,7 @@ struct is_empty_impl<experimental::view_tag> {
 template <>
 struct drop_front_impl<experimental::view_tag> {
     template <typename View, typename N>
-    static constexpr auto apply(View view, N const&) {
+    static constexpr auto apply(View const& view, N const&) {
         constexpr auto n = N::value;
         constexpr auto Length = decltype(hana::length(view))::value;
         return experimental::sliced(view, hana::range_c<std::size_t, n, Length>);
@@ -395,7 +619,7 @@ struct transform_impl<experimental::view_tag> {
     }
 
     template <typename View, typename F>
-    static constexpr auto apply(View view, F&& f) {
+    static constexpr auto apply(View const& view, F&& f) {
         return experimental::transformed(view, static_cast<F&&>(f));
     }
 };
@@ -440,7 +664,7 @@ struct flatten_impl<experimental::view_tag> {
 template <>
 struct concat_impl<experimental::view_tag> {
     template <typename View1, typename View2>
-    static constexpr auto apply(View1 view1, View2 view2) {
+    static constexpr auto apply(View1 const& view1, View2 const& view2) {
         return experimental::joined(view1, view2);
     }
 };
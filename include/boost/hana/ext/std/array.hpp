@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/bool.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/contiguous_elements.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/core/tag_of.hpp>
 #include <boost/hana/fwd/drop_front.hpp>
@@ -53,7 +54,9 @@ namespace std {
     //!
     //! 3. `Foldable`\n
     //! Folding an array from the left is equivalent to calling
-    //! `std::accumulate` on it, except it can be `constexpr`.
+    //! `std::accumulate` on it, except it can be `constexpr`. When the
+    //! accumulated result keeps the same type, the fold is performed with
+    //! a loop, and so is `for_each`.
     //! @include example/ext/std/array/foldable.cpp
     //!
     //! 4. `Iterable`\n
@@ -77,6 +80,23 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename T, std::size_t N>
+        struct contiguous_elements<std::array<T, N>, typename std::enable_if<
+            (N > 0)
+        >::type> {
+            static constexpr bool value = true;
+            using value_type = T;
+            static constexpr std::size_t size = N;
+
+            static constexpr T* data(std::array<T, N>& xs)
+            { return xs.data(); }
+
+            static constexpr T const* data(std::array<T, N> const& xs)
+            { return &xs[0]; }
+        };
+    }
+
     template <>
     struct length_impl<ext::std::array_tag> {
         template <typename Xs>
@@ -25,11 +25,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) extend_t::operator()(W_&& w, F&& f) const {
         using W = typename hana::tag_of<W_>::type;
         using Extend = BOOST_HANA_DISPATCH_IF(extend_impl<W>,
-            hana::Comonad<W>::value
+            detail::capabilities<W>::Comonad
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Comonad<W>::value,
+        static_assert(detail::capabilities<W>::Comonad,
         "hana::extend(w, f) requires 'w' to be a Comonad");
     #endif
 
@@ -23,11 +23,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) extract_t::operator()(W_&& w) const {
         using W = typename hana::tag_of<W_>::type;
         using Extract = BOOST_HANA_DISPATCH_IF(extract_impl<W>,
-            hana::Comonad<W>::value
+            detail::capabilities<W>::Comonad
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Comonad<W>::value,
+        static_assert(detail::capabilities<W>::Comonad,
         "hana::extract(w) requires 'w' to be a Comonad");
     #endif
 
@@ -20,9 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
-#include <boost/hana/detail/algorithm.hpp>
-#include <boost/hana/detail/array.hpp>
-#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
 #include <boost/hana/empty.hpp>
 #include <boost/hana/lift.hpp>
 #include <boost/hana/unpack.hpp>
@@ -37,11 +35,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto filter_t::operator()(Xs&& xs, Pred&& pred) const {
         using M = typename hana::tag_of<Xs>::type;
         using Filter = BOOST_HANA_DISPATCH_IF(filter_impl<M>,
-            hana::MonadPlus<M>::value
+            detail::capabilities<M>::MonadPlus
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::MonadPlus<M>::value,
+        static_assert(detail::capabilities<M>::MonadPlus,
         "hana::filter(xs, pred) requires 'xs' to be a MonadPlus");
     #endif
 
@@ -79,54 +77,22 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
-    namespace detail {
-        template <bool ...b>
-        struct filter_indices {
-            static constexpr auto compute_indices() {
-                constexpr bool bs[] = {b..., false}; // avoid empty array
-                constexpr std::size_t N = detail::count(bs, bs + sizeof(bs), true);
-                detail::array<std::size_t, N> indices{};
-                std::size_t* keep = &indices[0];
-                for (std::size_t i = 0; i < sizeof...(b); ++i)
-                    if (bs[i])
-                        *keep++ = i;
-                return indices;
-            }
-
-            static constexpr auto indices = compute_indices();
-        };
-
-        template <typename Pred>
-        struct make_filter_indices {
-            Pred const& pred;
-            template <typename ...X>
-            auto operator()(X&& ...x) const -> filter_indices<
-                static_cast<bool>(detail::decay<
-                    decltype(pred(static_cast<X&&>(x)))
-                >::type::value)...
-            > { return {}; }
-        };
-    }
-
     template <typename S>
     struct filter_impl<S, when<Sequence<S>::value>> {
-        template <typename Indices, typename Xs, std::size_t ...i>
+        template <typename Results, typename Xs, std::size_t ...i>
         static constexpr auto filter_helper(Xs&& xs, std::index_sequence<i...>) {
             return hana::make<S>(
-                hana::at_c<Indices::indices[i]>(static_cast<Xs&&>(xs))...
+                hana::at_c<Results::template indices<true>[i]>(static_cast<Xs&&>(xs))...
             );
         }
 
         template <typename Xs, typename Pred>
-        static constexpr auto apply(Xs&& xs, Pred const& pred) {
-            using Indices = decltype(
-                hana::unpack(static_cast<Xs&&>(xs),
-                             detail::make_filter_indices<Pred>{pred})
-            );
-
-            return filter_impl::filter_helper<Indices>(
+        static constexpr auto apply(Xs&& xs, Pred const&) {
+            using Results = decltype(hana::unpack(static_cast<Xs&&>(xs),
+                                     detail::make_predicate_results<Pred const&>{}));
+            return filter_impl::filter_helper<Results>(
                 static_cast<Xs&&>(xs),
-                std::make_index_sequence<Indices::indices.size()>{}
+                std::make_index_sequence<Results::count>{}
             );
         }
     };
@@ -25,11 +25,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto find_t::operator()(Xs&& xs, Key const& key) const {
         using S = typename hana::tag_of<Xs>::type;
         using Find = BOOST_HANA_DISPATCH_IF(find_impl<S>,
-            hana::Searchable<S>::value
+            detail::capabilities<S>::Searchable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S>::value,
+        static_assert(detail::capabilities<S>::Searchable,
         "hana::find(xs, key) requires 'xs' to be Searchable");
     #endif
 
@@ -21,20 +21,19 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
-#include <boost/hana/detail/decay.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
 #include <boost/hana/drop_while.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/front.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/is_empty.hpp>
-#include <boost/hana/length.hpp>
 #include <boost/hana/not.hpp>
 #include <boost/hana/optional.hpp>
 #include <boost/hana/second.hpp>
 #include <boost/hana/transform.hpp>
+#include <boost/hana/unpack.hpp>
 
 #include <cstddef>
-#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -43,11 +42,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto find_if_t::operator()(Xs&& xs, Pred&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using FindIf = BOOST_HANA_DISPATCH_IF(find_if_impl<S>,
-            hana::Searchable<S>::value
+            detail::capabilities<S>::Searchable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S>::value,
+        static_assert(detail::capabilities<S>::Searchable,
         "hana::find_if(xs, pred) requires 'xs' to be a Searchable");
     #endif
 
@@ -61,42 +60,23 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto apply(Args&& ...) = delete;
     };
 
-    namespace detail {
-        template <typename Xs, typename Pred, std::size_t i, std::size_t N, bool Done>
-        struct advance_until;
-
-        template <typename Xs, typename Pred, std::size_t i, std::size_t N>
-        struct advance_until<Xs, Pred, i, N, false>
-            : advance_until<Xs, Pred, i + 1, N, static_cast<bool>(detail::decay<decltype(
-                std::declval<Pred>()(hana::at_c<i>(std::declval<Xs>()))
-            )>::type::value)>
-        { };
-
-        template <typename Xs, typename Pred, std::size_t N>
-        struct advance_until<Xs, Pred, N, N, false> {
-            template <typename Ys>
-            static constexpr auto apply(Ys&&) {
-                return hana::nothing;
-            }
-        };
-
-        template <typename Xs, typename Pred, std::size_t i, std::size_t N>
-        struct advance_until<Xs, Pred, i, N, true> {
-            template <typename Ys>
-            static constexpr auto apply(Ys&& ys) {
-                return hana::just(hana::at_c<i - 1>(static_cast<Ys&&>(ys)));
-            }
-        };
-    }
-
     template <typename S>
     struct find_if_impl<S, when<Sequence<S>::value>> {
+        template <std::size_t index, typename Xs>
+        static constexpr auto helper(Xs&&, hana::true_)
+        { return hana::nothing; }
+
+        template <std::size_t index, typename Xs>
+        static constexpr auto helper(Xs&& xs, hana::false_)
+        { return hana::just(hana::at_c<index>(static_cast<Xs&&>(xs))); }
+
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred&&) {
-            constexpr std::size_t N = decltype(hana::length(xs))::value;
-            return detail::advance_until<Xs&&, Pred&&, 0, N, false>::apply(
-                static_cast<Xs&&>(xs)
-            );
+            using Results = decltype(hana::unpack(static_cast<Xs&&>(xs),
+                                     detail::make_predicate_results<Pred&&>{}));
+            constexpr std::size_t index = Results::first_satisfied;
+            return helper<index>(static_cast<Xs&&>(xs),
+                                 hana::bool_c<index == Results::size>);
         }
     };
 
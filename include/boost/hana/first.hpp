@@ -23,11 +23,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) first_t::operator()(Pair&& pair) const {
         using P = typename hana::tag_of<Pair>::type;
         using First = BOOST_HANA_DISPATCH_IF(first_impl<P>,
-            hana::Product<P>::value
+            detail::capabilities<P>::Product
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Product<P>::value,
+        static_assert(detail::capabilities<P>::Product,
         "hana::first(pair) requires 'pair' to be a Product");
     #endif
 
@@ -12,13 +12,20 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/fold_left.hpp>
 
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/contiguous_elements.hpp>
+#include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/variadic/foldl1.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/unpack.hpp>
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -26,11 +33,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) fold_left_t::operator()(Xs&& xs, State&& state, F&& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using FoldLeft = BOOST_HANA_DISPATCH_IF(fold_left_impl<S>,
-            hana::Foldable<S>::value
+            detail::capabilities<S>::Foldable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Foldable<S>::value,
+        static_assert(detail::capabilities<S>::Foldable,
         "hana::fold_left(xs, state, f) requires 'xs' to be Foldable");
     #endif
 
@@ -43,11 +50,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) fold_left_t::operator()(Xs&& xs, F&& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using FoldLeft = BOOST_HANA_DISPATCH_IF(fold_left_impl<S>,
-            hana::Foldable<S>::value
+            detail::capabilities<S>::Foldable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Foldable<S>::value,
+        static_assert(detail::capabilities<S>::Foldable,
         "hana::fold_left(xs, f) requires 'xs' to be Foldable");
     #endif
 
@@ -71,19 +78,78 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
     }
 
+    namespace detail {
+        // Whether folding `Xs` with `f` can be done with a loop. This is the
+        // case when the elements are stored contiguously and the type of the
+        // accumulated result never changes, so it can be kept in a variable.
+        // `S` is the type of the initial state, or `void` if there is none.
+        template <typename Xs, typename S, typename F,
+                  bool = contiguous_elements<typename decay<Xs>::type>::value>
+        struct fold_left_loop {
+            static constexpr bool value = false;
+        };
+
+        template <typename Xs, typename S, typename F>
+        struct fold_left_loop<Xs, S, F, true> {
+            using Contiguous = contiguous_elements<typename decay<Xs>::type>;
+            using Element = decltype(detail::contiguous_at(std::declval<Xs>(), 0));
+            using Init = typename std::conditional<std::is_void<S>::value, Element, S>::type;
+            using First = decltype(std::declval<F&>()(std::declval<Init>(),
+                                                      std::declval<Element>()));
+            using State = typename decay<First>::type;
+
+            template <typename R, bool = std::is_same<R, State>::value>
+            struct stable : std::false_type { };
+
+            template <typename R>
+            struct stable<R, true>
+                : std::is_same<decltype(std::declval<F&>()(std::declval<State>(),
+                                                           std::declval<Element>())),
+                               State>
+            { };
+
+            static constexpr bool value =
+                Contiguous::size >= (std::is_void<S>::value ? 2 : 1) &&
+                stable<First>::value &&
+                std::is_move_assignable<State>::value;
+        };
+    }
+
     template <typename T, bool condition>
     struct fold_left_impl<T, when<condition>> : default_ {
         // with state
         template <typename Xs, typename S, typename F>
         static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return with_state(static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                              static_cast<F&&>(f),
+                              hana::bool_c<detail::fold_left_loop<Xs, S&&, F>::value>);
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) with_state(Xs&& xs, S&& s, F&& f, hana::false_) {
             return hana::unpack(static_cast<Xs&&>(xs),
                 detail::variadic_foldl1<F, S>{f, s}
             );
         }
 
+        template <typename Xs, typename S, typename F>
+        static constexpr auto with_state(Xs&& xs, S&& s, F&& f, hana::true_) {
+            using Contiguous = detail::contiguous_elements<typename detail::decay<Xs>::type>;
+            auto state = f(static_cast<S&&>(s), detail::contiguous_at(static_cast<Xs&&>(xs), 0));
+            for (std::size_t i = 1; i != Contiguous::size; ++i)
+                state = f(std::move(state), detail::contiguous_at(static_cast<Xs&&>(xs), i));
+            return state;
+        }
+
         // without state
         template <typename Xs, typename F>
         static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return without_state(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                hana::bool_c<detail::fold_left_loop<Xs, void, F>::value>);
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) without_state(Xs&& xs, F&& f, hana::false_) {
             return hana::unpack(static_cast<Xs&&>(xs),
                 hana::partial(
                     detail::variadic::foldl1,
@@ -91,6 +157,16 @@ BOOST_HANA_NAMESPACE_BEGIN
                 )
             );
         }
+
+        template <typename Xs, typename F>
+        static constexpr auto without_state(Xs&& xs, F&& f, hana::true_) {
+            using Contiguous = detail::contiguous_elements<typename detail::decay<Xs>::type>;
+            auto state = f(detail::contiguous_at(static_cast<Xs&&>(xs), 0),
+                           detail::contiguous_at(static_cast<Xs&&>(xs), 1));
+            for (std::size_t i = 2; i != Contiguous::size; ++i)
+                state = f(std::move(state), detail::contiguous_at(static_cast<Xs&&>(xs), i));
+            return state;
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
@@ -12,11 +12,16 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/for_each.hpp>
 
+#include <boost/hana/bool.hpp>
 #include <boost/hana/concept/foldable.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/contiguous_elements.hpp>
+#include <boost/hana/detail/decay.hpp>
 #include <boost/hana/unpack.hpp>
 
+#include <cstddef>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -24,11 +29,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr void for_each_t::operator()(Xs&& xs, F&& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using ForEach = BOOST_HANA_DISPATCH_IF(for_each_impl<S>,
-            hana::Foldable<S>::value
+            detail::capabilities<S>::Foldable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Foldable<S>::value,
+        static_assert(detail::capabilities<S>::Foldable,
         "hana::for_each(xs, f) requires 'xs' to be Foldable");
     #endif
 
@@ -42,8 +47,12 @@ BOOST_HANA_NAMESPACE_BEGIN
             F f;
             template <typename ...Xs>
             constexpr void operator()(Xs&& ...xs) const {
+            #if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+                ((void)(*f)(static_cast<Xs&&>(xs)), ...);
+            #else
                 using Swallow = int[];
                 (void)Swallow{0, ((void)(*f)(static_cast<Xs&&>(xs)), 0)...};
+            #endif
             }
         };
     }
@@ -51,11 +60,27 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename T, bool condition>
     struct for_each_impl<T, when<condition>> : default_ {
         template <typename Xs, typename F>
-        static constexpr void apply(Xs&& xs, F&& f) {
+        static constexpr void helper(Xs&& xs, F&& f, hana::false_) {
             // We use a pointer instead of a reference to avoid a Clang ICE.
             hana::unpack(static_cast<Xs&&>(xs),
                          detail::on_each<decltype(&f)>{&f});
         }
+
+        // Elements stored contiguously are visited with a loop, which is
+        // instantiated once instead of once per element.
+        template <typename Xs, typename F>
+        static constexpr void helper(Xs&& xs, F&& f, hana::true_) {
+            using Contiguous = detail::contiguous_elements<typename detail::decay<Xs>::type>;
+            for (std::size_t i = 0; i != Contiguous::size; ++i)
+                (void)f(detail::contiguous_at(static_cast<Xs&&>(xs), i));
+        }
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            using Contiguous = detail::contiguous_elements<typename detail::decay<Xs>::type>;
+            helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                   hana::bool_c<Contiguous::value>);
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
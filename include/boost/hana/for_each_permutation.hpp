@@ -0,0 +1,69 @@
+/*!
+@file
+Defines `boost::hana::for_each_permutation`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FOR_EACH_PERMUTATION_HPP
+#define BOOST_HANA_FOR_EACH_PERMUTATION_HPP
+
+#include <boost/hana/fwd/for_each_permutation.hpp>
+
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/nth_permutation.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <typename Xs, typename F>
+    constexpr void for_each_permutation_t::operator()(Xs&& xs, F&& f) const {
+        using S = typename hana::tag_of<Xs>::type;
+        using ForEachPermutation = BOOST_HANA_DISPATCH_IF(for_each_permutation_impl<S>,
+            detail::capabilities<S>::Sequence
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(detail::capabilities<S>::Sequence,
+        "hana::for_each_permutation(xs, f) requires 'xs' to be a Sequence");
+    #endif
+
+        return ForEachPermutation::apply(static_cast<Xs&&>(xs), static_cast<F&&>(f));
+    }
+    //! @endcond
+
+    template <typename S, bool condition>
+    struct for_each_permutation_impl<S, when<condition>> : default_ {
+        template <std::size_t N, typename Xs, typename F, std::size_t ...n>
+        static constexpr void
+        for_each_helper(Xs const& xs, F* f, std::index_sequence<n...>) {
+        #if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+            ((void)(*f)(detail::make_nth_permutation<S, n>(
+                xs, std::make_index_sequence<N>{})), ...);
+        #else
+            using Swallow = int[];
+            (void)Swallow{0, ((void)(*f)(detail::make_nth_permutation<S, n>(
+                xs, std::make_index_sequence<N>{})), 0)...};
+        #endif
+        }
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs const& xs, F&& f) {
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            constexpr std::size_t total_perms = detail::factorial(N);
+            // We use a pointer instead of a reference to avoid a Clang ICE.
+            for_each_helper<N>(xs, &f, std::make_index_sequence<total_perms>{});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FOR_EACH_PERMUTATION_HPP
@@ -0,0 +1,86 @@
+/*!
+@file
+Defines `boost::hana::for_each_product`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FOR_EACH_PRODUCT_HPP
+#define BOOST_HANA_FOR_EACH_PRODUCT_HPP
+
+#include <boost/hana/fwd/for_each_product.hpp>
+
+#include <boost/hana/cartesian_product.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <typename Xs, typename F>
+    constexpr void for_each_product_t::operator()(Xs&& xs, F&& f) const {
+        using S = typename hana::tag_of<Xs>::type;
+        using ForEachProduct = BOOST_HANA_DISPATCH_IF(for_each_product_impl<S>,
+            detail::capabilities<S>::Sequence
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(detail::capabilities<S>::Sequence,
+        "hana::for_each_product(xs, f) requires 'xs' to be a Sequence");
+    #endif
+
+        return ForEachProduct::apply(static_cast<Xs&&>(xs), static_cast<F&&>(f));
+    }
+    //! @endcond
+
+    namespace detail {
+        template <typename S, typename F>
+        struct on_each_product {
+            F f;
+
+            template <std::size_t ...n, typename ...Xs>
+            constexpr void call(std::index_sequence<n...>, Xs const& ...xs) const {
+                using indices = detail::cartesian_product_indices<
+                    decltype(hana::length(xs))::value...
+                >;
+            #if defined(BOOST_HANA_CONFIG_HAS_FOLD_EXPRESSIONS)
+                ((void)(*f)(indices::template product_element<S, n>(
+                    std::make_index_sequence<sizeof...(Xs)>{}, xs...)), ...);
+            #else
+                using Swallow = int[];
+                (void)Swallow{0, ((void)(*f)(indices::template product_element<S, n>(
+                    std::make_index_sequence<sizeof...(Xs)>{}, xs...)), 0)...};
+            #endif
+            }
+
+            template <typename ...Xs>
+            constexpr void operator()(Xs const& ...xs) const {
+                using indices = detail::cartesian_product_indices<
+                    decltype(hana::length(xs))::value...
+                >;
+                call(std::make_index_sequence<indices::length>{}, xs...);
+            }
+
+            constexpr void operator()() const { }
+        };
+    }
+
+    template <typename S, bool condition>
+    struct for_each_product_impl<S, when<condition>> : default_ {
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs const& xs, F&& f) {
+            // We use a pointer instead of a reference to avoid a Clang ICE.
+            hana::unpack(xs, detail::on_each_product<S, decltype(&f)>{&f});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FOR_EACH_PRODUCT_HPP
@@ -24,11 +24,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) front_t::operator()(Xs&& xs) const {
         using It = typename hana::tag_of<Xs>::type;
         using Front = BOOST_HANA_DISPATCH_IF(front_impl<It>,
-            hana::Iterable<It>::value
+            detail::capabilities<It>::Iterable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Iterable<It>::value,
+        static_assert(detail::capabilities<It>::Iterable,
         "hana::front(xs) requires 'xs' to be an Iterable");
     #endif
 
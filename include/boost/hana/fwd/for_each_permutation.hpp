@@ -0,0 +1,59 @@
+/*!
+@file
+Forward declares `boost::hana::for_each_permutation`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FOR_EACH_PERMUTATION_HPP
+#define BOOST_HANA_FWD_FOR_EACH_PERMUTATION_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Perform an action on each permutation of a sequence, discarding
+    //! the result each time.
+    //! @ingroup group-Sequence
+    //!
+    //! `for_each_permutation(xs, f)` calls `f` with each permutation of
+    //! `xs`, in the order given by `nth_permutation`. It is equivalent to
+    //! `for_each(permutations(xs), f)`, except the sequence of all the
+    //! permutations is never created; each permutation is built right
+    //! before it is passed to `f`. This keeps the compile-time memory usage
+    //! proportional to the number of permutations, instead of having all
+    //! of them live at once in a single huge type.
+    //!
+    //!
+    //! @param xs
+    //! The sequence whose permutations are visited.
+    //!
+    //! @param f
+    //! A function called as `f(perm)` for each permutation `perm` of `xs`.
+    //! The result of `f`, if any, is discarded.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/for_each_permutation.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto for_each_permutation = [](auto&& xs, auto&& f) -> void {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct for_each_permutation_impl : for_each_permutation_impl<S, when<true>> { };
+
+    struct for_each_permutation_t {
+        template <typename Xs, typename F>
+        constexpr void operator()(Xs&& xs, F&& f) const;
+    };
+
+    constexpr for_each_permutation_t for_each_permutation{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_FOR_EACH_PERMUTATION_HPP
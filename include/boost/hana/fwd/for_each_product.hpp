@@ -0,0 +1,63 @@
+/*!
+@file
+Forward declares `boost::hana::for_each_product`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FOR_EACH_PRODUCT_HPP
+#define BOOST_HANA_FWD_FOR_EACH_PRODUCT_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Perform an action on each element of the cartesian product of a
+    //! sequence of sequences, discarding the result each time.
+    //! @ingroup group-Sequence
+    //!
+    //! `for_each_product(xs, f)` calls `f` with each element of the
+    //! cartesian product of the sequences in `xs`, in the same order as
+    //! they appear in `cartesian_product(xs)`. It is equivalent to
+    //! `for_each(cartesian_product(xs), f)`, except the sequence holding
+    //! the whole product is never created; each element of the product
+    //! is built right before it is passed to `f`.
+    //!
+    //! @note
+    //! All the sequences must have the same tag, and that tag must also match
+    //! that of the top-level sequence.
+    //!
+    //!
+    //! @param xs
+    //! A sequence of sequences whose cartesian product is visited.
+    //!
+    //! @param f
+    //! A function called as `f(x)` for each element `x` of the cartesian
+    //! product of the sequences in `xs`. The result of `f`, if any, is
+    //! discarded.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/for_each_product.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto for_each_product = [](auto&& xs, auto&& f) -> void {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct for_each_product_impl : for_each_product_impl<S, when<true>> { };
+
+    struct for_each_product_t {
+        template <typename Xs, typename F>
+        constexpr void operator()(Xs&& xs, F&& f) const;
+    };
+
+    constexpr for_each_product_t for_each_product{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_FOR_EACH_PRODUCT_HPP
@@ -26,15 +26,18 @@ BOOST_HANA_NAMESPACE_BEGIN
     };
 
     namespace ic_detail {
-        template <typename T, T v>
+        template <typename T, T v, std::size_t budget = BOOST_HANA_CONFIG_UNROLL_BUDGET>
         struct with_index_t {
             template <typename F>
             constexpr void operator()(F&& f) const;
         };
 
-        template <typename T, T v>
+        template <typename T, T v, std::size_t budget = BOOST_HANA_CONFIG_UNROLL_BUDGET>
         struct times_t {
-            static constexpr with_index_t<T, v> with_index{};
+            static constexpr with_index_t<T, v, budget> with_index{};
+
+            template <std::size_t k>
+            static constexpr times_t<T, v, k> unrolled_by{};
 
             template <typename F>
             constexpr void operator()(F&& f) const;
@@ -164,6 +167,18 @@ BOOST_HANA_NAMESPACE_BEGIN
         //! called as `f(0)`, `f(1)`, `f(2)`, etc., but with `integral_constant`s
         //! instead of normal integers. Side effects can also be done in the
         //! function passed to `times` and `times.with_index`.
+        //!
+        //! To keep the generated code small, at most
+        //! `BOOST_HANA_CONFIG_UNROLL_BUDGET` calls are unrolled. Past that
+        //! number, `times(f)` calls `f` in a partially unrolled loop. Since
+        //! `times.with_index(f)` may need the indices at compile-time, it
+        //! expands the calls in chunks of that size instead, unless `f` is a
+        //! pointer to function or a function object with a single,
+        //! non-template call operator accepting a `T`; such a function only
+        //! sees the value of the index, which is then passed to it as a `T`
+        //! from a loop. The budget can be changed for a single call by using
+        //! `times.unrolled_by<k>` instead of `times`:
+        //! @snippet example/integral_constant.cpp times_unrolled_by
         template <typename F>
         static constexpr void times(F&& f) {
             f(); f(); ... f(); // n times total
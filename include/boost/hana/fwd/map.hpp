@@ -13,9 +13,12 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/fwd/core/to.hpp>
 #include <boost/hana/fwd/core/make.hpp>
+#include <boost/hana/fwd/difference.hpp>
 #include <boost/hana/fwd/erase_key.hpp>
 #include <boost/hana/fwd/insert.hpp>
+#include <boost/hana/fwd/intersection.hpp>
 #include <boost/hana/fwd/keys.hpp>
+#include <boost/hana/fwd/union.hpp>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -91,7 +94,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator[](Key&& key);
     };
 #else
-    template <typename HashTable, typename Storage>
+    template <typename ...Pairs>
     struct map;
 #endif
 
@@ -106,13 +109,12 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! `make<map_tag>` returns a `hana::map` associating these keys to these
     //! values.
     //!
-    //! `make<map_tag>` requires all the keys to be unique and to have
-    //! different hashes. If you need to create a map with duplicate keys
-    //! or with keys whose hashes might collide, use `hana::to_map` or
-    //! insert `(key, value)` pairs to an empty map successively. However,
-    //! be aware that doing so will be much more compile-time intensive than
-    //! using `make<map_tag>`, because the uniqueness of keys will have to be
-    //! enforced.
+    //! `make<map_tag>` requires all the keys to be unique, but their hashes
+    //! may collide. If you need to create a map with duplicate keys, use
+    //! `hana::to_map` or insert `(key, value)` pairs to an empty map
+    //! successively. However, be aware that doing so will be more
+    //! compile-time intensive than using `make<map_tag>`, because the
+    //! uniqueness of keys will have to be enforced.
     //!
     //!
     //! Example
@@ -220,6 +222,77 @@ BOOST_HANA_NAMESPACE_BEGIN
         return tag-dispatched;
     };
 #endif
+
+    //! Returns the union of two maps.
+    //! @relates hana::map
+    //!
+    //! Given two maps `xs` and `ys`, `hana::union_(xs, ys)` is a new map
+    //! containing all the elements of `xs` and all the elements of `ys`,
+    //! without duplicate keys. If both `xs` and `ys` contain an element
+    //! with the same `key`, the element from `ys` is kept. The keys of
+    //! `xs` are looked up in `ys` in a single pass, so this is much cheaper
+    //! at compile-time than inserting the elements of `xs` one by one.
+    //!
+    //!
+    //! @param xs, ys
+    //! The two maps to compute the union of.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/map/union.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto union_ = [](auto&& xs, auto&& ys) {
+        return tag-dispatched;
+    };
+#endif
+
+    //! Returns the intersection of two maps.
+    //! @relates hana::map
+    //!
+    //! Given two maps `xs` and `ys`, `hana::intersection(xs, ys)` is a new
+    //! map containing the elements of `xs` whose key is also present in `ys`.
+    //! In other words, the values of `xs` are kept and the values of `ys`
+    //! are ignored.
+    //!
+    //!
+    //! @param xs, ys
+    //! The two maps to intersect.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/map/intersection.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto intersection = [](auto&& xs, auto&& ys) {
+        return tag-dispatched;
+    };
+#endif
+
+    //! Returns the difference of two maps.
+    //! @relates hana::map
+    //!
+    //! Given two maps `xs` and `ys`, `hana::difference(xs, ys)` is a new map
+    //! containing the elements of `xs` whose key is not present in `ys`. Only
+    //! the keys of `ys` matter, not its values. This is equivalent to, but
+    //! cheaper at compile-time than, erasing each key of `ys` from `xs`.
+    //!
+    //!
+    //! @param xs
+    //! The map to remove elements from.
+    //!
+    //! @param ys
+    //! The map whose keys are removed from `xs`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/map/difference.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto difference = [](auto&& xs, auto&& ys) {
+        return tag-dispatched;
+    };
+#endif
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_FWD_MAP_HPP
@@ -0,0 +1,58 @@
+/*!
+@file
+Forward declares `boost::hana::nth_permutation`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_NTH_PERMUTATION_HPP
+#define BOOST_HANA_FWD_NTH_PERMUTATION_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+#include <cstddef>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Returns the `n`th permutation of a sequence, in lexicographical
+    //! order of the indices of its elements.
+    //! @ingroup group-Sequence
+    //!
+    //! Given a sequence `xs` of length `N`, the permutations of `xs` are
+    //! ordered like the permutations of the indices `[0, ..., N-1]` are in
+    //! lexicographical order. `nth_permutation<0>(xs)` is thus `xs` itself,
+    //! and `nth_permutation<N! - 1>(xs)` is `xs` in reverse order. Unlike
+    //! `permutations`, only the requested permutation is computed; its
+    //! indices are obtained directly from `n` without generating those of
+    //! the permutations that come before it.
+    //!
+    //!
+    //! @tparam n
+    //! The 0-based index of the permutation to return. It must be strictly
+    //! smaller than `N!`, where `N` is the length of `xs`.
+    //!
+    //! @param xs
+    //! The sequence to permute.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/nth_permutation.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <std::size_t n>
+    constexpr auto nth_permutation = [](auto&& xs) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct nth_permutation_impl : nth_permutation_impl<S, when<true>> { };
+
+    template <std::size_t n, typename Xs>
+    constexpr auto nth_permutation(Xs&& xs);
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_NTH_PERMUTATION_HPP
@@ -47,7 +47,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     //!
     //! 2. `Foldable`\n
     //! Folding a `range` is equivalent to folding a list of the
-    //! `integral_constant`s in the interval it spans.
+    //! `integral_constant`s in the interval it spans. `for_each` unrolls
+    //! at most `BOOST_HANA_CONFIG_UNROLL_BUDGET` calls, like
+    //! `integral_constant::%times.with_index`; past that, the values may
+    //! be passed as plain integers to functions that accept them.
     //! @include example/range/foldable.cpp
     //!
     //! 3. `Iterable`\n
@@ -24,6 +24,8 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @code
     //!     f(); f(); ... f(); // n times total
     //! @endcode
+    //! When `n` exceeds `BOOST_HANA_CONFIG_UNROLL_BUDGET`, the calls are
+    //! made from a loop whose body is unrolled that many times instead.
     //!
     //!
     //! @param n
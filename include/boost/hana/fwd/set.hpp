@@ -66,6 +66,8 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! @code
     //!     to<set_tag>(xs) == fold_left(xs, make_set(), insert)
     //! @endcode
+    //! However, the conversion is performed in a single pass instead of
+    //! creating an intermediate set for each element.
     //!
     //! __Example__
     //! @include example/set/to.cpp
@@ -26,12 +26,15 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! to any kind of object.
     //!
     //! Compile-time strings are used for simple purposes like being keys in a
-    //! `hana::map` or tagging the members of a `Struct`. However, you might
-    //! find that `hana::string` does not provide enough functionality to be
-    //! used as a full-blown compile-time string implementation (e.g. regexp
-    //! matching or substring finding). Indeed, providing a comprehensive
-    //! string interface is a lot of job, and it is out of the scope of the
-    //! library for the time being.
+    //! `hana::map` or tagging the members of a `Struct`. Beyond the concepts
+    //! documented below, a few string algorithms are provided, namely
+    //! `string_concat`, `string_find`, `string_split`, `string_replace`,
+    //! `starts_with` and `ends_with`. They compute their result in a
+    //! `constexpr` array and expand it at once, so their cost does not grow
+    //! with the number of characters the way a character-by-character
+    //! recursion would. However, `hana::string` is not meant to be a
+    //! full-blown compile-time string implementation (e.g. with regexp
+    //! matching), which is out of the scope of the library.
     //!
     //!
     //! @note
@@ -78,6 +81,13 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! that string.
     //! @include example/string/hashable.cpp
     //!
+    //! 7. `Monoid`\n
+    //! Strings form a monoid under concatenation, whose identity is the
+    //! empty string. To concatenate more than two strings, `string_concat`
+    //! should be preferred to folding with `hana::plus`, since it does not
+    //! create the intermediate strings.
+    //! @include example/string/monoid.cpp
+    //!
     //!
     //! Conversion to `char const*`
     //! ---------------------------
@@ -199,6 +209,194 @@ BOOST_HANA_NAMESPACE_BEGIN
     // defined in <boost/hana/string.hpp>
 #endif
 
+    //! Concatenates any number of compile-time strings.
+    //! @relates hana::string
+    //!
+    //! `string_concat(s1, ..., sn)` is the string made of the characters of
+    //! `s1`, followed by those of `s2`, ..., followed by those of `sn`, and
+    //! `string_concat()` is the empty string. This is equivalent to folding
+    //! the strings with `hana::plus`, but the characters of the result are
+    //! computed at once, without creating the intermediate strings.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/string_concat.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto string_concat = [](auto const& ...strings) {
+        return string<implementation_defined>{};
+    };
+#else
+    struct string_concat_t {
+        template <typename ...Strings>
+        constexpr auto operator()(Strings const& ...strings) const;
+    };
+
+    constexpr string_concat_t string_concat{};
+#endif
+
+    //! Finds the first occurrence of a substring in a compile-time string.
+    //! @relates hana::string
+    //!
+    //! `string_find(s, pattern)` returns `just(size_c<i>)`, where `i` is the
+    //! index of the first character of the first occurrence of `pattern`
+    //! in `s`, or `nothing` if `pattern` does not occur in `s`. The empty
+    //! string occurs at index 0 of any string. Unlike `hana::find`, which
+    //! searches for a single character, this searches for a whole string.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/string_find.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto string_find = [](auto const& s, auto const& pattern) {
+        return optional<size_t<implementation_defined>>{};
+    };
+#else
+    struct string_find_t {
+        template <typename S, typename Pattern>
+        constexpr auto operator()(S const& s, Pattern const& pattern) const;
+    };
+
+    constexpr string_find_t string_find{};
+#endif
+
+    //! Splits a compile-time string at each occurrence of a separator.
+    //! @relates hana::string
+    //!
+    //! `string_split(s, separator)` returns a `hana::tuple` holding the
+    //! substrings of `s` between the non-overlapping occurrences of
+    //! `separator`, from left to right. There is always one more substring
+    //! than there are occurrences of `separator`, so empty substrings are
+    //! kept, and splitting the empty string returns a tuple holding the
+    //! empty string. The separator must not be empty.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/string_split.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto string_split = [](auto const& s, auto const& separator) {
+        return tuple<string<implementation_defined>...>{};
+    };
+#else
+    struct string_split_t {
+        template <typename S, typename Separator>
+        constexpr auto operator()(S const& s, Separator const& separator) const;
+    };
+
+    constexpr string_split_t string_split{};
+#endif
+
+    //! Replaces each occurrence of a substring in a compile-time string.
+    //! @relates hana::string
+    //!
+    //! `string_replace(s, oldval, newval)` is the string `s` where each of
+    //! the non-overlapping occurrences of `oldval`, from left to right, is
+    //! replaced by `newval`. `oldval` must not be empty. Unlike
+    //! `hana::replace`, which replaces the elements of a `Functor`, this
+    //! replaces whole substrings.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/string_replace.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto string_replace = [](auto const& s, auto const& oldval, auto const& newval) {
+        return string<implementation_defined>{};
+    };
+#else
+    struct string_replace_t {
+        template <typename S, typename OldVal, typename NewVal>
+        constexpr auto
+        operator()(S const& s, OldVal const& oldval, NewVal const& newval) const;
+    };
+
+    constexpr string_replace_t string_replace{};
+#endif
+
+    //! Returns whether a compile-time string starts with another one.
+    //! @relates hana::string
+    //!
+    //! `starts_with(s, prefix)` is a boolean `IntegralConstant` holding
+    //! whether the first characters of `s` are those of `prefix`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/starts_with.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto starts_with = [](auto const& s, auto const& prefix) {
+        return bool_<implementation_defined>{};
+    };
+#else
+    struct starts_with_t {
+        template <typename S, typename Prefix>
+        constexpr auto operator()(S const& s, Prefix const& prefix) const;
+    };
+
+    constexpr starts_with_t starts_with{};
+#endif
+
+    //! Returns whether a compile-time string ends with another one.
+    //! @relates hana::string
+    //!
+    //! `ends_with(s, suffix)` is a boolean `IntegralConstant` holding
+    //! whether the last characters of `s` are those of `suffix`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/starts_with.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto ends_with = [](auto const& s, auto const& suffix) {
+        return bool_<implementation_defined>{};
+    };
+#else
+    struct ends_with_t {
+        template <typename S, typename Suffix>
+        constexpr auto operator()(S const& s, Suffix const& suffix) const;
+    };
+
+    constexpr ends_with_t ends_with{};
+#endif
+
+    //! Parses a compile-time string holding the decimal representation of
+    //! an integer into an `integral_constant`.
+    //! @relates hana::string
+    //!
+    //! Given a `hana::string` holding the decimal representation of an
+    //! integer, optionally preceded by a `-` sign, `string_to_integral<T>(s)`
+    //! is an `integral_constant` of underlying type `T` holding that integer.
+    //! It is a compile-time error for the string not to be such a
+    //! representation, or for the integer not to be representable by `T`.
+    //!
+    //! @note
+    //! This is not provided as a `to<integral_constant_tag<T>>` conversion
+    //! because that would make `hana::string`s and `IntegralConstant`s
+    //! embeddable into a common type as far as `hana::equal` is concerned,
+    //! which they are not.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/string/string_to_integral.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename T>
+    constexpr auto string_to_integral = [](auto const& s) {
+        return integral_constant<T, implementation_defined>{};
+    };
+#else
+    template <typename T>
+    struct string_to_integral_t {
+        template <typename S>
+        constexpr auto operator()(S const& s) const;
+    };
+
+    template <typename T>
+    constexpr string_to_integral_t<T> string_to_integral{};
+#endif
+
 #ifdef BOOST_HANA_CONFIG_ENABLE_STRING_UDL
     namespace literals {
         //! Creates a compile-time string from a string literal.
@@ -32,6 +32,12 @@ BOOST_HANA_NAMESPACE_BEGIN
     //! sequence with a key-based access, then you should consider
     //! `hana::map` or `hana::set` instead.
     //!
+    //! When all the elements of a tuple have the same trivially copyable,
+    //! non-empty type, they are stored in an array. `fold_left`, `for_each`,
+    //! `transform` and `equal` then process them with a runtime loop instead
+    //! of unrolling the computation, whenever the type of the result allows
+    //! it. This does not change the result of these algorithms.
+    //!
     //!
     //! Modeled concepts
     //! ----------------
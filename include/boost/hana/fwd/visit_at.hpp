@@ -0,0 +1,102 @@
+/*!
+@file
+Forward declares `boost::hana::visit_at` and `boost::hana::visit_at_unchecked`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_VISIT_AT_HPP
+#define BOOST_HANA_FWD_VISIT_AT_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+#include <cstddef>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Calls a function with the element of an iterable located at an
+    //! index known only at runtime.
+    //! @ingroup group-Iterable
+    //!
+    //! Given an `Iterable` `xs` of length `N`, an index `i` and a function
+    //! `f`, `visit_at(xs, i, f, otherwise)` returns `f(at_c<i>(xs))`, even
+    //! though `i` is a runtime value. This is done by indexing a table of
+    //! `N` function pointers, each of which calls `f` with the result of
+    //! `at_c<k>(xs)` for its own `k`. Hence, the cost of the dispatch does
+    //! not depend on the length of `xs`, unlike that of a chain of `if`s.
+    //!
+    //! Since a single function pointer type is used for all the elements,
+    //! `f` must return the same type for every element of `xs`, like the
+    //! visitor of `std::visit` must. The index is checked against the length
+    //! of `xs`, and `otherwise()` is returned instead when it is out of
+    //! bounds; Hana does not use exceptions. When the index is known to be
+    //! valid, `visit_at_unchecked` can be used to skip that check.
+    //!
+    //!
+    //! @param xs
+    //! An iterable that is also a `Foldable`, so that its length is known
+    //! at compile-time. When `xs` is empty, every index is out of bounds
+    //! and `f` is never called, so `otherwise()` is always returned.
+    //!
+    //! @param i
+    //! The 0-based index of the element to pass to `f`, as a `std::size_t`.
+    //!
+    //! @param f
+    //! A function called as `f(at_c<k>(xs))` for the `k` equal to `i`.
+    //! It must return the same type for all the elements of `xs`.
+    //!
+    //! @param otherwise
+    //! A nullary function called when `i` is out of bounds. It must return
+    //! the same type as `f`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/visit_at.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto visit_at = [](auto&& xs, std::size_t i, auto&& f, auto&& otherwise) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename It, typename = void>
+    struct visit_at_impl : visit_at_impl<It, when<true>> { };
+
+    struct visit_at_t {
+        template <typename Xs, typename F, typename Otherwise>
+        constexpr decltype(auto)
+        operator()(Xs&& xs, std::size_t i, F&& f, Otherwise&& otherwise) const;
+    };
+
+    constexpr visit_at_t visit_at{};
+#endif
+
+    //! Equivalent to `visit_at`, but without checking the index.
+    //! @ingroup group-Iterable
+    //!
+    //! `visit_at_unchecked(xs, i, f)` returns `f(at_c<i>(xs))` for a runtime
+    //! index `i`, like `visit_at` does. It is undefined behavior to call
+    //! `visit_at_unchecked(xs, i, f)` with an index `i` that is not smaller
+    //! than the length of `xs`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/visit_at.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto visit_at_unchecked = [](auto&& xs, std::size_t i, auto&& f) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    struct visit_at_unchecked_t {
+        template <typename Xs, typename F>
+        constexpr decltype(auto) operator()(Xs&& xs, std::size_t i, F&& f) const;
+    };
+
+    constexpr visit_at_unchecked_t visit_at_unchecked{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_VISIT_AT_HPP
@@ -0,0 +1,72 @@
+/*!
+@file
+Forward declares `boost::hana::visit_key`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_VISIT_KEY_HPP
+#define BOOST_HANA_FWD_VISIT_KEY_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/when.hpp>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! Calls a function with the value associated to a key known only at
+    //! runtime, in a structure whose keys are compile-time strings.
+    //! @ingroup group-Searchable
+    //!
+    //! Given a `hana::map` or a `Struct` `xs` whose keys are all
+    //! `hana::string`s, a runtime string `key` and a function `f`,
+    //! `visit_key(xs, key, f, otherwise)` returns `f(at_key(xs, k))` for the
+    //! compile-time key `k` whose characters are those of `key`. If there is
+    //! no such key, `otherwise()` is returned instead.
+    //!
+    //! The lookup uses a perfect hash table computed at compile-time from
+    //! the keys of `xs`. Hence, `key` is hashed once, and it is compared to
+    //! at most one of the keys of `xs`, instead of being compared to each of
+    //! them in turn. The element is then accessed like with `visit_at`, so
+    //! `f` must return the same type for all the values of `xs`, and
+    //! `otherwise` must return that type too.
+    //!
+    //!
+    //! @param xs
+    //! A non-empty `hana::map` or `Struct` whose keys are `hana::string`s.
+    //!
+    //! @param key
+    //! A runtime string, which is either a null-terminated `char const*`
+    //! or an object with `data()` and `size()` member functions, like a
+    //! `std::string` or a `std::string_view`.
+    //!
+    //! @param f
+    //! A function called with the value associated to `key` in `xs`. For
+    //! a `Struct`, this is the member whose name is `key`.
+    //!
+    //! @param otherwise
+    //! A nullary function called when `key` is not a key of `xs`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/visit_key.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto visit_key = [](auto&& xs, auto const& key, auto&& f, auto&& otherwise) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct visit_key_impl : visit_key_impl<S, when<true>> { };
+
+    struct visit_key_t {
+        template <typename Xs, typename Key, typename F, typename Otherwise>
+        decltype(auto) operator()(Xs&& xs, Key const& key, F&& f, Otherwise&& otherwise) const;
+    };
+
+    constexpr visit_key_t visit_key{};
+#endif
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_FWD_VISIT_KEY_HPP
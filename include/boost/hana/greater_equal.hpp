@@ -32,15 +32,15 @@ BOOST_HANA_NAMESPACE_BEGIN
         using U = typename hana::tag_of<Y>::type;
         using GreaterEqual = BOOST_HANA_DISPATCH_IF(
             decltype(greater_equal_impl<T, U>{}),
-            hana::Orderable<T>::value &&
-            hana::Orderable<U>::value
+            detail::capabilities<T>::Orderable &&
+            detail::capabilities<U>::Orderable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Orderable<T>::value,
+        static_assert(detail::capabilities<T>::Orderable,
         "hana::greater_equal(x, y) requires 'x' to be Orderable");
 
-        static_assert(hana::Orderable<U>::value,
+        static_assert(detail::capabilities<U>::Orderable,
         "hana::greater_equal(x, y) requires 'y' to be Orderable");
     #endif
 
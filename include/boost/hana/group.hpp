@@ -33,11 +33,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto group_t::operator()(Xs&& xs) const {
         using S = typename hana::tag_of<Xs>::type;
         using Group = BOOST_HANA_DISPATCH_IF(group_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::group(xs) requires 'xs' to be a Sequence");
     #endif
 
@@ -48,11 +48,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto group_t::operator()(Xs&& xs, Predicate&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using Group = BOOST_HANA_DISPATCH_IF(group_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::group(xs, predicate) requires 'xs' to be a Sequence");
     #endif
 
@@ -28,11 +28,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto hash_t::operator()(X const& x) const {
         using Tag = typename hana::tag_of<X>::type;
         using Hash = BOOST_HANA_DISPATCH_IF(hash_impl<Tag>,
-            hana::Hashable<Tag>::value
+            detail::capabilities<Tag>::Hashable
         );
 
 #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Hashable<Tag>::value,
+        static_assert(detail::capabilities<Tag>::Hashable,
         "hana::hash(x) requires 'x' to be Hashable");
 #endif
 
@@ -28,15 +28,15 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto insert_range_t::operator()(Xs&& xs, N&& n, Elements&& elements) const {
         using S = typename hana::tag_of<Xs>::type;
         using InsertRange = BOOST_HANA_DISPATCH_IF(insert_range_impl<S>,
-            hana::Sequence<Xs>::value &&
-            hana::Foldable<Elements>::value
+            detail::capabilities_of<Xs>::Sequence &&
+            detail::capabilities_of<Elements>::Foldable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<Xs>::value,
+        static_assert(detail::capabilities_of<Xs>::Sequence,
         "hana::insert_range(xs, n, elements) requires 'xs' to be a Sequence");
 
-        static_assert(hana::Foldable<Elements>::value,
+        static_assert(detail::capabilities_of<Elements>::Foldable,
         "hana::insert_range(xs, n, elements) requires 'elements' to be a Foldable");
     #endif
 
@@ -23,11 +23,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto is_empty_t::operator()(Xs const& xs) const {
         using It = typename hana::tag_of<Xs>::type;
         using IsEmpty = BOOST_HANA_DISPATCH_IF(is_empty_impl<It>,
-            hana::Iterable<It>::value
+            detail::capabilities<It>::Iterable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Iterable<It>::value,
+        static_assert(detail::capabilities<It>::Iterable,
         "hana::is_empty(xs) requires 'xs' to be an Iterable");
     #endif
 
@@ -31,16 +31,16 @@ BOOST_HANA_NAMESPACE_BEGIN
         using S2 = typename hana::tag_of<Ys>::type;
         using IsSubset = BOOST_HANA_DISPATCH_IF(
             decltype(is_subset_impl<S1, S2>{}),
-            hana::Searchable<S1>::value &&
-            hana::Searchable<S2>::value &&
+            detail::capabilities<S1>::Searchable &&
+            detail::capabilities<S2>::Searchable &&
             !is_default<is_subset_impl<S1, S2>>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Searchable<S1>::value,
+        static_assert(detail::capabilities<S1>::Searchable,
         "hana::is_subset(xs, ys) requires 'xs' to be Searchable");
 
-        static_assert(hana::Searchable<S2>::value,
+        static_assert(detail::capabilities<S2>::Searchable,
         "hana::is_subset(xs, ys) requires 'ys' to be Searchable");
 
         static_assert(!is_default<is_subset_impl<S1, S2>>::value,
@@ -42,16 +42,16 @@ BOOST_HANA_NAMESPACE_BEGIN
         using T = typename hana::tag_of<X>::type;
         using U = typename hana::tag_of<Y>::type;
         using Less = BOOST_HANA_DISPATCH_IF(decltype(less_impl<T, U>{}),
-            hana::Orderable<T>::value &&
-            hana::Orderable<U>::value &&
+            detail::capabilities<T>::Orderable &&
+            detail::capabilities<U>::Orderable &&
             !is_default<less_impl<T, U>>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Orderable<T>::value,
+        static_assert(detail::capabilities<T>::Orderable,
         "hana::less(x, y) requires 'x' to be Orderable");
 
-        static_assert(hana::Orderable<U>::value,
+        static_assert(detail::capabilities<U>::Orderable,
         "hana::less(x, y) requires 'y' to be Orderable");
 
         static_assert(!is_default<less_impl<T, U>>::value,
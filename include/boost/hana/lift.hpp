@@ -23,14 +23,14 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename A>
     struct lift_t {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Applicative<A>::value,
+        static_assert(detail::capabilities<A>::Applicative,
         "hana::lift<A> requires 'A' to be an Applicative");
     #endif
 
         template <typename X>
         constexpr auto operator()(X&& x) const {
             using Lift = BOOST_HANA_DISPATCH_IF(lift_impl<A>,
-                hana::Applicative<A>::value
+                detail::capabilities<A>::Applicative
             );
 
             return Lift::apply(static_cast<X&&>(x));
@@ -30,29 +30,34 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/searchable.hpp>
+#include <boost/hana/detail/perfect_hash.hpp>
 #include <boost/hana/equal.hpp>
 #include <boost/hana/find.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/functional/demux.hpp>
-#include <boost/hana/functional/on.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/fwd/any_of.hpp>
 #include <boost/hana/fwd/at_key.hpp>
+#include <boost/hana/fwd/difference.hpp>
 #include <boost/hana/fwd/erase_key.hpp>
+#include <boost/hana/fwd/intersection.hpp>
 #include <boost/hana/fwd/is_subset.hpp>
 #include <boost/hana/fwd/keys.hpp>
+#include <boost/hana/fwd/union.hpp>
+#include <boost/hana/fwd/visit_key.hpp>
 #include <boost/hana/insert.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/keys.hpp>
 #include <boost/hana/length.hpp>
 #include <boost/hana/optional.hpp>
-#include <boost/hana/remove_if.hpp>
 #include <boost/hana/second.hpp>
 #include <boost/hana/unpack.hpp>
 #include <boost/hana/value.hpp>
+#include <boost/hana/visit_at.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 
@@ -71,24 +76,23 @@ BOOST_HANA_NAMESPACE_BEGIN
     // map
     //////////////////////////////////////////////////////////////////////////
     //! @cond
-    template <typename HashTable, typename Storage>
+    template <typename ...Pairs>
     struct map
-        : detail::searchable_operators<map<HashTable, Storage>>
-        , detail::operators::adl<map<HashTable, Storage>>
+        : detail::searchable_operators<map<Pairs...>>
+        , detail::operators::adl<map<Pairs...>>
     {
-        using hash_table_type = HashTable;
-        using storage_type = Storage;
+        using storage_type = hana::basic_tuple<Pairs...>;
 
-        Storage storage;
+        storage_type storage;
 
         using hana_tag = map_tag;
 
-        explicit constexpr map(Storage const& xs)
+        explicit constexpr map(storage_type const& xs)
             : storage(xs)
         { }
 
-        explicit constexpr map(Storage&& xs)
-            : storage(static_cast<Storage&&>(xs))
+        explicit constexpr map(storage_type&& xs)
+            : storage(static_cast<storage_type&&>(xs))
         { }
 
         constexpr map() = default;
@@ -97,12 +101,47 @@ BOOST_HANA_NAMESPACE_BEGIN
     };
     //! @endcond
 
+    //////////////////////////////////////////////////////////////////////////
+    // Hash table
+    //
+    // The hash table of a map is not part of its type, which keeps the
+    // symbols and the debug information of maps small; it is computed on
+    // demand from the keys of the map the first time a lookup is performed,
+    // and it is then memoized by the compiler.
+    //////////////////////////////////////////////////////////////////////////
     namespace detail {
+        // The keys are looked up through the `basic_tuple` rather than by
+        // indexing the `Pairs...` pack with `type_at`. Without the
+        // `__type_pack_element` builtin, indexing the pack from an alias
+        // nested in a specialization on `Pairs...` was measured to be more
+        // than twice as slow for a map of 1000 keys on GCC 12.
         template <typename Storage>
         struct KeyAtIndex {
             template <std::size_t i>
             using apply = decltype(hana::first(hana::get_impl<i>(std::declval<Storage>())));
         };
+
+        template <typename Map>
+        struct map_hash_table;
+
+        template <typename ...Pairs>
+        struct map_hash_table<hana::map<Pairs...>> {
+            using type = typename detail::make_hash_table<
+                detail::KeyAtIndex<hana::basic_tuple<Pairs...>>::template apply,
+                sizeof...(Pairs)
+            >::type;
+        };
+
+        template <typename Map, typename Key>
+        struct map_find_index;
+
+        template <typename ...Pairs, typename Key>
+        struct map_find_index<hana::map<Pairs...>, Key> {
+            using type = typename detail::find_index<
+                typename map_hash_table<hana::map<Pairs...>>::type,
+                Key, detail::KeyAtIndex<hana::basic_tuple<Pairs...>>::template apply
+            >::type;
+        };
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -134,17 +173,9 @@ BOOST_HANA_NAMESPACE_BEGIN
             //! inside each bucket instead.
             static_assert(!detail::has_duplicates<decltype(hana::first(pairs))...>::value,
             "hana::make_map({keys, values}...) requires all the keys to be unique");
-
-            static_assert(!detail::has_duplicates<decltype(hana::hash(hana::first(pairs)))...>::value,
-            "hana::make_map({keys, values}...) requires all the keys to have different hashes");
 #endif
 
-            using Storage = hana::basic_tuple<typename detail::decay<Pairs>::type...>;
-            using HashTable = typename detail::make_hash_table<
-                detail::KeyAtIndex<Storage>::template apply, sizeof...(Pairs)
-            >::type;
-
-            return map<HashTable, Storage>(
+            return map<typename detail::decay<Pairs>::type...>(
                 hana::make_basic_tuple(static_cast<Pairs&&>(pairs)...)
             );
         }
@@ -176,20 +207,14 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct insert_impl<map_tag> {
+        template <typename ...Pairs>
+        static constexpr auto from_storage(hana::basic_tuple<Pairs...>&& storage) {
+            return hana::map<Pairs...>(static_cast<hana::basic_tuple<Pairs...>&&>(storage));
+        }
+
         template <typename Map, typename Pair>
         static constexpr auto helper(Map&& map, Pair&& pair, ...) {
-            using RawMap = typename std::remove_reference<Map>::type;
-            using HashTable = typename RawMap::hash_table_type;
-            using NewHashTable = typename detail::bucket_insert<
-                HashTable,
-                decltype(hana::first(pair)),
-                decltype(hana::length(map.storage))::value
-            >::type;
-
-            using NewStorage = decltype(
-                hana::append(static_cast<Map&&>(map).storage, static_cast<Pair&&>(pair))
-            );
-            return hana::map<NewHashTable, NewStorage>(
+            return from_storage(
                 hana::append(static_cast<Map&&>(map).storage, static_cast<Pair&&>(pair))
             );
         }
@@ -202,19 +227,14 @@ BOOST_HANA_NAMESPACE_BEGIN
             return static_cast<Map&&>(map);
         }
 
-        //! @todo
-        //! Here, we insert only if the key is not already in the map.
-        //! This should be handled by `bucket_insert`, and that would also
-        //! be more efficient.
+        // Here, we insert only if the key is not already in the map. The key
+        // is looked up in the hash table of the map, which is computed on
+        // demand and then reused by the following lookups in that map.
         template <typename Map, typename Pair>
         static constexpr auto apply(Map&& map, Pair&& pair) {
-            using RawMap = typename std::remove_reference<Map>::type;
-            using Storage = typename RawMap::storage_type;
-            using HashTable = typename RawMap::hash_table_type;
+            using RawMap = typename detail::decay<Map>::type;
             using Key = decltype(hana::first(pair));
-            using MaybeIndex = typename detail::find_index<
-              HashTable, Key, detail::KeyAtIndex<Storage>::template apply
-            >::type;
+            using MaybeIndex = typename detail::map_find_index<RawMap, Key>::type;
             return helper(static_cast<Map&&>(map), static_cast<Pair&&>(pair), MaybeIndex{});
         }
     };
@@ -224,30 +244,116 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<map_tag> {
-        //! @todo
-        //! We could implement some kind of `bucket_erase` metafunction
-        //! that would be much more efficient than this.
-        template <typename Map, typename Key>
-        static constexpr auto
-        erase_key_helper(Map&& map, Key const&, hana::false_) {
+        template <typename Map>
+        static constexpr auto erase_key_helper(Map&& map, ...) {
             return static_cast<Map&&>(map);
         }
 
-        template <typename Map, typename Key>
+        // The bucket of the key gives us its index, so we copy the other
+        // pairs without comparing any keys nor rehashing them.
+        template <typename Map, std::size_t i, std::size_t ...k>
         static constexpr auto
-        erase_key_helper(Map&& map, Key const& key, hana::true_) {
-            return hana::unpack(
-                hana::remove_if(static_cast<Map&&>(map).storage,
-                                hana::on(hana::equal.to(key), hana::first)),
-                hana::make_map
+        erase_index(Map&& map, std::index_sequence<k...>) {
+            return hana::make_map(
+                hana::at_c<(k < i ? k : k + 1)>(static_cast<Map&&>(map).storage)...
             );
         }
 
+        template <typename Map, std::size_t i>
+        static constexpr auto
+        erase_key_helper(Map&& map, hana::optional<std::integral_constant<std::size_t, i>>) {
+            constexpr std::size_t size = decltype(hana::length(map.storage))::value;
+            return erase_index<Map, i>(static_cast<Map&&>(map),
+                                       std::make_index_sequence<size - 1>{});
+        }
+
         template <typename Map, typename Key>
-        static constexpr auto apply(Map&& map, Key const& key) {
-            constexpr bool contains = hana::value<decltype(hana::contains(map, key))>();
-            return erase_key_helper(static_cast<Map&&>(map), key,
-                                    hana::bool_c<contains>);
+        static constexpr auto apply(Map&& map, Key const&) {
+            using RawMap = typename detail::decay<Map>::type;
+            using MaybeIndex = typename detail::map_find_index<RawMap, Key>::type;
+            return erase_key_helper(static_cast<Map&&>(map), MaybeIndex{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Set-theoretic operations
+    //
+    // Each key of the first map is looked up in the hash table of the second
+    // map in a single pass, and the resulting map is created at once from
+    // the pairs to keep, instead of inserting or erasing the pairs one at a
+    // time.
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <bool Found, typename Xs, typename Ys>
+        struct map_lookup_results;
+
+        template <bool Found, typename ...X, typename ...Y>
+        struct map_lookup_results<Found, hana::map<X...>, hana::map<Y...>> {
+            using type = typename detail::lookup_results<
+                Found,
+                typename map_hash_table<hana::map<Y...>>::type,
+                KeyAtIndex<hana::basic_tuple<Y...>>::template apply,
+                KeyAtIndex<hana::basic_tuple<X...>>::template apply,
+                sizeof...(X)
+            >::type;
+        };
+
+        template <bool Found>
+        struct map_select {
+            template <typename Results, typename Xs, typename Ys,
+                      std::size_t ...k, std::size_t ...j>
+            static constexpr auto
+            helper(Xs&& xs, Ys&& ys, std::index_sequence<k...>, std::index_sequence<j...>) {
+                return hana::make_map(
+                    hana::at_c<Results::template indices<true>[k]>(static_cast<Xs&&>(xs).storage)...,
+                    hana::at_c<j>(static_cast<Ys&&>(ys).storage)...
+                );
+            }
+
+            // Returns a map containing the pairs of `xs` whose key is (or is
+            // not) in `ys`, followed by the pairs at the `Extra` indices of `ys`.
+            template <typename Extra, typename Xs, typename Ys>
+            static constexpr auto apply(Xs&& xs, Ys&& ys) {
+                using Results = typename map_lookup_results<
+                    Found,
+                    typename detail::decay<Xs>::type,
+                    typename detail::decay<Ys>::type
+                >::type;
+                return helper<Results>(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
+                                       std::make_index_sequence<Results::count>{},
+                                       Extra{});
+            }
+        };
+    }
+
+    template <>
+    struct union_impl<map_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys&& ys) {
+            constexpr std::size_t size = decltype(hana::length(ys.storage))::value;
+            return detail::map_select<false>::template apply<std::make_index_sequence<size>>(
+                static_cast<Xs&&>(xs), static_cast<Ys&&>(ys)
+            );
+        }
+    };
+
+    template <>
+    struct intersection_impl<map_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys const& ys) {
+            return detail::map_select<true>::template apply<std::index_sequence<>>(
+                static_cast<Xs&&>(xs), ys
+            );
+        }
+    };
+
+    template <>
+    struct difference_impl<map_tag> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys const& ys) {
+            return detail::map_select<false>::template apply<std::index_sequence<>>(
+                static_cast<Xs&&>(xs), ys
+            );
         }
     };
 
@@ -296,12 +402,8 @@ BOOST_HANA_NAMESPACE_BEGIN
 
         template <typename Map, typename Key>
         static constexpr auto apply(Map&& map, Key const&) {
-            using RawMap = typename std::remove_reference<Map>::type;
-            using Storage = typename RawMap::storage_type;
-            using HashTable = typename RawMap::hash_table_type;
-            using MaybeIndex = typename detail::find_index<
-              HashTable, Key, detail::KeyAtIndex<Storage>::template apply
-            >::type;
+            using RawMap = typename detail::decay<Map>::type;
+            using MaybeIndex = typename detail::map_find_index<RawMap, Key>::type;
             return find_helper(static_cast<Map&&>(map), MaybeIndex{});
         }
     };
@@ -349,12 +451,8 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct at_key_impl<map_tag> {
         template <typename Map, typename Key>
         static constexpr decltype(auto) apply(Map&& map, Key const&) {
-            using RawMap = typename std::remove_reference<Map>::type;
-            using HashTable = typename RawMap::hash_table_type;
-            using Storage = typename RawMap::storage_type;
-            using MaybeIndex = typename detail::find_index<
-                HashTable, Key, detail::KeyAtIndex<Storage>::template apply
-            >::type;
+            using RawMap = typename detail::decay<Map>::type;
+            using MaybeIndex = typename detail::map_find_index<RawMap, Key>::type;
             static_assert(!decltype(hana::is_nothing(MaybeIndex{}))::value,
                 "hana::at_key(map, key) requires the 'key' to be present in the 'map'");
             constexpr std::size_t index = decltype(*MaybeIndex{}){}();
@@ -362,6 +460,46 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct visit_key_impl<map_tag> {
+        // An empty map has no key to find, and no value to call `f` with.
+        template <typename Storage, typename Visit, typename Otherwise>
+        static decltype(auto) helper(hana::true_, Storage&&, char const*, std::size_t,
+                                     Visit&, Otherwise&& otherwise)
+        { return static_cast<Otherwise&&>(otherwise)(); }
+
+        template <typename Storage, typename Visit, typename Otherwise>
+        static decltype(auto) helper(hana::false_, Storage&& storage, char const* key,
+                                     std::size_t length, Visit& visit, Otherwise&& otherwise)
+        {
+            using Hash = decltype(hana::unpack(storage, detail::perfect_hash_of_keys{}));
+            using Result = decltype(hana::visit_at_unchecked(
+                static_cast<Storage&&>(storage), 0, visit));
+            static_assert(std::is_same<
+                Result, decltype(static_cast<Otherwise&&>(otherwise)())
+            >::value,
+            "hana::visit_key(map, key, f, otherwise) requires 'otherwise' to "
+            "return the same type as 'f'");
+
+            std::size_t const index = Hash::find(key, length);
+            if (index == Hash::N)
+                return static_cast<Otherwise&&>(otherwise)();
+            return hana::visit_at_unchecked(static_cast<Storage&&>(storage), index, visit);
+        }
+
+        template <typename Map, typename F, typename Otherwise>
+        static decltype(auto) apply(Map&& map, char const* key, std::size_t length,
+                                    F&& f, Otherwise&& otherwise)
+        {
+            auto visit = [&](auto&& pair) -> decltype(auto) {
+                return static_cast<F&&>(f)(hana::second(static_cast<decltype(pair)&&>(pair)));
+            };
+            constexpr bool empty = decltype(hana::length(map.storage))::value == 0;
+            return helper(hana::bool_c<empty>, static_cast<Map&&>(map).storage,
+                          key, length, visit, static_cast<Otherwise&&>(otherwise));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
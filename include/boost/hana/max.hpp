@@ -26,15 +26,15 @@ BOOST_HANA_NAMESPACE_BEGIN
         using T = typename hana::tag_of<X>::type;
         using U = typename hana::tag_of<Y>::type;
         using Max = BOOST_HANA_DISPATCH_IF(decltype(max_impl<T, U>{}),
-            hana::Orderable<T>::value &&
-            hana::Orderable<U>::value
+            detail::capabilities<T>::Orderable &&
+            detail::capabilities<U>::Orderable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Orderable<T>::value,
+        static_assert(detail::capabilities<T>::Orderable,
         "hana::max(x, y) requires 'x' to be Orderable");
 
-        static_assert(hana::Orderable<U>::value,
+        static_assert(detail::capabilities<U>::Orderable,
         "hana::max(x, y) requires 'y' to be Orderable");
     #endif
 
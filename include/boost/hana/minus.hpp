@@ -34,15 +34,15 @@ BOOST_HANA_NAMESPACE_BEGIN
         using T = typename hana::tag_of<X>::type;
         using U = typename hana::tag_of<Y>::type;
         using Minus = BOOST_HANA_DISPATCH_IF(decltype(minus_impl<T, U>{}),
-            hana::Group<T>::value &&
-            hana::Group<U>::value
+            detail::capabilities<T>::Group &&
+            detail::capabilities<U>::Group
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Group<T>::value,
+        static_assert(detail::capabilities<T>::Group,
         "hana::minus(x, y) requires 'x' to be in a Group");
 
-        static_assert(hana::Group<U>::value,
+        static_assert(detail::capabilities<U>::Group,
         "hana::minus(x, y) requires 'y' to be in a Group");
     #endif
 
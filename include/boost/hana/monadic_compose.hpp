@@ -27,7 +27,7 @@ BOOST_HANA_NAMESPACE_BEGIN
                 using M = typename hana::tag_of<decltype(g(x))>::type;
 
             #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-                static_assert(hana::Monad<M>::value,
+                static_assert(detail::capabilities<M>::Monad,
                 "hana::monadic_compose(f, g) requires 'g' to return a monadic value");
             #endif
 
@@ -30,7 +30,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename M>
     struct monadic_fold_left_t {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Monad<M>::value,
+        static_assert(detail::capabilities<M>::Monad,
         "hana::monadic_fold_left<M> requires 'M' to be a Monad");
     #endif
 
@@ -38,11 +38,11 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator()(Xs&& xs, State&& state, F&& f) const {
             using S = typename hana::tag_of<Xs>::type;
             using MonadicFoldLeft = BOOST_HANA_DISPATCH_IF(monadic_fold_left_impl<S>,
-                hana::Foldable<S>::value
+                detail::capabilities<S>::Foldable
             );
 
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            static_assert(hana::Foldable<S>::value,
+            static_assert(detail::capabilities<S>::Foldable,
             "hana::monadic_fold_left<M>(xs, state, f) requires 'xs' to be Foldable");
         #endif
 
@@ -55,11 +55,11 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
             using S = typename hana::tag_of<Xs>::type;
             using MonadicFoldLeft = BOOST_HANA_DISPATCH_IF(monadic_fold_left_impl<S>,
-                hana::Foldable<S>::value
+                detail::capabilities<S>::Foldable
             );
 
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            static_assert(hana::Foldable<S>::value,
+            static_assert(detail::capabilities<S>::Foldable,
             "hana::monadic_fold_left<M>(xs, f) requires 'xs' to be Foldable");
         #endif
 
@@ -31,16 +31,16 @@ BOOST_HANA_NAMESPACE_BEGIN
         using T = typename hana::tag_of<X>::type;
         using U = typename hana::tag_of<Y>::type;
         using Mult = BOOST_HANA_DISPATCH_IF(decltype(mult_impl<T, U>{}),
-            hana::Ring<T>::value &&
-            hana::Ring<U>::value &&
+            detail::capabilities<T>::Ring &&
+            detail::capabilities<U>::Ring &&
             !is_default<mult_impl<T, U>>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Ring<T>::value,
+        static_assert(detail::capabilities<T>::Ring,
         "hana::mult(x, y) requires 'x' to be in a Ring");
 
-        static_assert(hana::Ring<U>::value,
+        static_assert(detail::capabilities<U>::Ring,
         "hana::mult(x, y) requires 'y' to be in a Ring");
 
         static_assert(!is_default<mult_impl<T, U>>::value,
@@ -28,11 +28,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) not_t::operator()(X&& x) const {
         using Bool = typename hana::tag_of<X>::type;
         using Not = BOOST_HANA_DISPATCH_IF(hana::not_impl<Bool>,
-            hana::Logical<Bool>::value
+            detail::capabilities<Bool>::Logical
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Logical<Bool>::value,
+        static_assert(detail::capabilities<Bool>::Logical,
         "hana::not_(cond) requires 'cond' to be a Logical");
     #endif
 
@@ -0,0 +1,89 @@
+/*!
+@file
+Defines `boost::hana::nth_permutation`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_NTH_PERMUTATION_HPP
+#define BOOST_HANA_NTH_PERMUTATION_HPP
+
+#include <boost/hana/fwd/nth_permutation.hpp>
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+
+#include <cstddef>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    //! @cond
+    template <std::size_t n, typename Xs>
+    constexpr auto nth_permutation(Xs&& xs) {
+        using S = typename hana::tag_of<Xs>::type;
+        using NthPermutation = BOOST_HANA_DISPATCH_IF(nth_permutation_impl<S>,
+            detail::capabilities<S>::Sequence
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(detail::capabilities<S>::Sequence,
+        "hana::nth_permutation<n>(xs) requires 'xs' to be a Sequence");
+    #endif
+
+        return NthPermutation::apply(static_cast<Xs&&>(xs), hana::size_t<n>{});
+    }
+    //! @endcond
+
+    namespace detail {
+        // Returns the indices of the `n`th permutation of `[0, ..., N-1]` in
+        // lexicographical order, which is the order in which they are
+        // generated by `array::permutations()`. The permutation is decoded
+        // from the factorial base representation of `n`, so that none of the
+        // `n` permutations before it has to be generated.
+        template <std::size_t N>
+        constexpr detail::array<std::size_t, N>
+        nth_permutation_indices(std::size_t n) {
+            detail::array<std::size_t, N> unused = detail::array<std::size_t, N>{}.iota(0);
+            detail::array<std::size_t, N> result{};
+            for (std::size_t i = 0; i != N; ++i) {
+                std::size_t const block = detail::factorial(N - i - 1);
+                std::size_t j = n / block;
+                n %= block;
+                result[i] = unused[j];
+                for (; j + 1 < N - i; ++j)
+                    unused[j] = unused[j + 1];
+            }
+            return result;
+        }
+
+        template <typename S, std::size_t n, typename Xs, std::size_t ...i>
+        constexpr auto make_nth_permutation(Xs const& xs, std::index_sequence<i...>) {
+            constexpr auto indices = detail::nth_permutation_indices<sizeof...(i)>(n);
+            (void)indices; // workaround GCC warning when sizeof...(i) == 0
+            return hana::make<S>(hana::at_c<indices[i]>(xs)...);
+        }
+    }
+
+    template <typename S, bool condition>
+    struct nth_permutation_impl<S, when<condition>> : default_ {
+        template <typename Xs, std::size_t n>
+        static constexpr auto apply(Xs const& xs, hana::size_t<n>) {
+            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            static_assert(n < detail::factorial(N),
+            "hana::nth_permutation<n>(xs) requires 'n' to be smaller than the "
+            "number of permutations of 'xs'");
+            return detail::make_nth_permutation<S, n>(xs, std::make_index_sequence<N>{});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_NTH_PERMUTATION_HPP
@@ -26,13 +26,13 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename R>
     struct one_t {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Ring<R>::value,
+        static_assert(detail::capabilities<R>::Ring,
         "hana::one<R>() requires 'R' to be a Ring");
     #endif
 
         constexpr decltype(auto) operator()() const {
             using One = BOOST_HANA_DISPATCH_IF(one_impl<R>,
-                hana::Ring<R>::value
+                detail::capabilities<R>::Ring
             );
 
             return One::apply();
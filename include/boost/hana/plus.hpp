@@ -31,16 +31,16 @@ BOOST_HANA_NAMESPACE_BEGIN
         using T = typename hana::tag_of<X>::type;
         using U = typename hana::tag_of<Y>::type;
         using Plus = BOOST_HANA_DISPATCH_IF(decltype(plus_impl<T, U>{}),
-            hana::Monoid<T>::value &&
-            hana::Monoid<U>::value &&
+            detail::capabilities<T>::Monoid &&
+            detail::capabilities<U>::Monoid &&
             !is_default<plus_impl<T, U>>::value
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Monoid<T>::value,
+        static_assert(detail::capabilities<T>::Monoid,
         "hana::plus(x, y) requires 'x' to be a Monoid");
 
-        static_assert(hana::Monoid<U>::value,
+        static_assert(detail::capabilities<U>::Monoid,
         "hana::plus(x, y) requires 'y' to be a Monoid");
 
         static_assert(!is_default<plus_impl<T, U>>::value,
@@ -30,15 +30,15 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) power_t::operator()(X&& x, N const& n) const {
         using R = typename hana::tag_of<X>::type;
         using Power = BOOST_HANA_DISPATCH_IF(power_impl<R>,
-            hana::Ring<R>::value &&
-            hana::IntegralConstant<N>::value
+            detail::capabilities<R>::Ring &&
+            detail::capabilities_of<N>::IntegralConstant
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Ring<R>::value,
+        static_assert(detail::capabilities<R>::Ring,
         "hana::power(x, n) requires 'x' to be in a Ring");
 
-        static_assert(hana::IntegralConstant<N>::value,
+        static_assert(detail::capabilities_of<N>::IntegralConstant,
         "hana::power(x, n) requires 'n' to be an IntegralConstant");
     #endif
 
@@ -27,11 +27,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto prefix_t::operator()(Xs&& xs, Pref&& pref) const {
         using M = typename hana::tag_of<Xs>::type;
         using Prefix = BOOST_HANA_DISPATCH_IF(prefix_impl<M>,
-            hana::MonadPlus<M>::value
+            detail::capabilities<M>::MonadPlus
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::MonadPlus<M>::value,
+        static_assert(detail::capabilities<M>::MonadPlus,
         "hana::prefix(xs, pref) requires 'xs' to be a MonadPlus");
     #endif
 
@@ -26,7 +26,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename R>
     struct product_t {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Ring<R>::value,
+        static_assert(detail::capabilities<R>::Ring,
         "hana::product<R> requires 'R' to be a Ring");
     #endif
 
@@ -34,11 +34,11 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator()(Xs&& xs) const {
             using S = typename hana::tag_of<Xs>::type;
             using Product = BOOST_HANA_DISPATCH_IF(product_impl<S>,
-                hana::Foldable<S>::value
+                detail::capabilities<S>::Foldable
             );
 
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            static_assert(hana::Foldable<S>::value,
+            static_assert(detail::capabilities<S>::Foldable,
             "hana::product<R>(xs) requires 'xs' to be Foldable");
         #endif
 
@@ -18,9 +18,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/common.hpp>
 #include <boost/hana/core/to.hpp>
 #include <boost/hana/core/tag_of.hpp>
+#include <boost/hana/detail/capabilities.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/iterable.hpp>
+#include <boost/hana/detail/unroll.hpp>
 #include <boost/hana/fwd/at.hpp>
 #include <boost/hana/fwd/back.hpp>
 #include <boost/hana/fwd/contains.hpp>
@@ -28,6 +30,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/drop_front_exactly.hpp>
 #include <boost/hana/fwd/equal.hpp>
 #include <boost/hana/fwd/find.hpp>
+#include <boost/hana/fwd/for_each.hpp>
 #include <boost/hana/fwd/front.hpp>
 #include <boost/hana/fwd/is_empty.hpp>
 #include <boost/hana/fwd/length.hpp>
@@ -77,10 +80,10 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto apply(From const&, To const&) {
 
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            static_assert(hana::IntegralConstant<From>::value,
+            static_assert(detail::capabilities_of<From>::IntegralConstant,
             "hana::make_range(from, to) requires 'from' to be an IntegralConstant");
 
-            static_assert(hana::IntegralConstant<To>::value,
+            static_assert(detail::capabilities_of<To>::IntegralConstant,
             "hana::make_range(from, to) requires 'to' to be an IntegralConstant");
         #endif
 
@@ -136,6 +139,15 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct for_each_impl<range_tag> {
+        template <typename T, T from, T to, typename F>
+        static constexpr void apply(range<T, from, to> const&, F&& f) {
+            detail::unroll<T, from, static_cast<std::size_t>(to - from),
+                           BOOST_HANA_CONFIG_UNROLL_BUDGET>::with_index(f);
+        }
+    };
+
     template <>
     struct length_impl<range_tag> {
         template <typename T, T from, T to>
@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/length.hpp>
 
@@ -31,15 +32,15 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto remove_at_t::operator()(Xs&& xs, N const& n) const {
         using S = typename hana::tag_of<Xs>::type;
         using RemoveAt = BOOST_HANA_DISPATCH_IF(remove_at_impl<S>,
-            hana::Sequence<S>::value &&
-            hana::IntegralConstant<N>::value
+            detail::capabilities<S>::Sequence &&
+            detail::capabilities_of<N>::IntegralConstant
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::remove_at(xs, n) requires 'xs' to be a Sequence");
 
-        static_assert(hana::IntegralConstant<N>::value,
+        static_assert(detail::capabilities_of<N>::IntegralConstant,
         "hana::remove_at(xs, n) requires 'n' to be an IntegralConstant");
     #endif
 
@@ -70,8 +71,8 @@ BOOST_HANA_NAMESPACE_BEGIN
             static_assert(n < len,
             "hana::remove_at(xs, n) requires 'n' to be in the bounds of the sequence");
             return remove_at_helper(static_cast<Xs&&>(xs),
-                                    std::make_index_sequence<n>{},
-                                    std::make_index_sequence<len - n - 1>{});
+                                    detail::make_index_sequence<n>{},
+                                    detail::make_index_sequence<len - n - 1>{});
         }
     };
 
@@ -12,12 +12,20 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/remove_if.hpp>
 
+#include <boost/hana/at.hpp>
 #include <boost/hana/concept/monad_plus.hpp>
+#include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
 #include <boost/hana/filter.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/not.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <cstddef>
+#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
@@ -26,11 +34,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto remove_if_t::operator()(Xs&& xs, Pred&& pred) const {
         using M = typename hana::tag_of<Xs>::type;
         using RemoveIf = BOOST_HANA_DISPATCH_IF(remove_if_impl<M>,
-            hana::MonadPlus<M>::value
+            detail::capabilities<M>::MonadPlus
         );
 
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            static_assert(hana::MonadPlus<M>::value,
+            static_assert(detail::capabilities<M>::MonadPlus,
             "hana::remove_if(xs, predicate) requires 'xs' to be a MonadPlus");
         #endif
 
@@ -47,6 +55,26 @@ BOOST_HANA_NAMESPACE_BEGIN
                         hana::compose(hana::not_, static_cast<Pred&&>(pred)));
         }
     };
+
+    template <typename S>
+    struct remove_if_impl<S, when<Sequence<S>::value>> {
+        template <typename Results, typename Xs, std::size_t ...i>
+        static constexpr auto remove_if_helper(Xs&& xs, std::index_sequence<i...>) {
+            return hana::make<S>(
+                hana::at_c<Results::template indices<false>[i]>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&&) {
+            using Results = decltype(hana::unpack(static_cast<Xs&&>(xs),
+                                     detail::make_predicate_results<Pred&&>{}));
+            return remove_if_impl::remove_if_helper<Results>(
+                static_cast<Xs&&>(xs),
+                std::make_index_sequence<Results::size - Results::count>{}
+            );
+        }
+    };
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_REMOVE_IF_HPP
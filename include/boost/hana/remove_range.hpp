@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/length.hpp>
 
@@ -31,19 +32,19 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto remove_range_t::operator()(Xs&& xs, From const& from, To const& to) const {
         using S = typename hana::tag_of<Xs>::type;
         using RemoveRange = BOOST_HANA_DISPATCH_IF(remove_range_impl<S>,
-            hana::Sequence<S>::value &&
-            hana::IntegralConstant<From>::value &&
-            hana::IntegralConstant<To>::value
+            detail::capabilities<S>::Sequence &&
+            detail::capabilities_of<From>::IntegralConstant &&
+            detail::capabilities_of<To>::IntegralConstant
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::remove_range(xs, from, to) requires 'xs' to be a Sequence");
 
-        static_assert(hana::IntegralConstant<From>::value,
+        static_assert(detail::capabilities_of<From>::IntegralConstant,
         "hana::remove_range(xs, from, to) requires 'from' to be an IntegralConstant");
 
-        static_assert(hana::IntegralConstant<To>::value,
+        static_assert(detail::capabilities_of<To>::IntegralConstant,
         "hana::remove_range(xs, from, to) requires 'to' to be an IntegralConstant");
     #endif
 
@@ -81,8 +82,8 @@ BOOST_HANA_NAMESPACE_BEGIN
             "hana::remove_range(xs, from, to) requires 'to <= length(xs)'");
 
             return remove_range_helper<to>(static_cast<Xs&&>(xs),
-                                           std::make_index_sequence<before>{},
-                                           std::make_index_sequence<after>{});
+                                           detail::make_index_sequence<before>{},
+                                           detail::make_index_sequence<after>{});
         }
     };
 
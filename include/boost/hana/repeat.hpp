@@ -15,25 +15,20 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/integral_constant.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/unroll.hpp>
 
 #include <cstddef>
-#include <utility>
 
 
 BOOST_HANA_NAMESPACE_BEGIN
     template <typename I, bool condition>
     struct repeat_impl<I, when<condition>> : default_ {
-        template <typename F, std::size_t ...i>
-        static constexpr void repeat_helper(F&& f, std::index_sequence<i...>) {
-            using Swallow = std::size_t[];
-            (void)Swallow{0, ((void)f(), i)...};
-        }
-
         template <typename N, typename F>
         static constexpr auto apply(N const&, F&& f) {
             static_assert(N::value >= 0, "hana::repeat(n, f) requires 'n' to be non-negative");
             constexpr std::size_t n = N::value;
-            repeat_helper(static_cast<F&&>(f), std::make_index_sequence<n>{});
+            detail::unroll<std::size_t, 0, n, BOOST_HANA_CONFIG_UNROLL_BUDGET>
+                ::without_index(f);
         }
     };
 
@@ -42,11 +37,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr void repeat_t::operator()(N const& n, F&& f) const {
         using I = typename hana::tag_of<N>::type;
         using Repeat = BOOST_HANA_DISPATCH_IF(repeat_impl<I>,
-            hana::IntegralConstant<I>::value
+            detail::capabilities<I>::IntegralConstant
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::IntegralConstant<I>::value,
+        static_assert(detail::capabilities<I>::IntegralConstant,
         "hana::repeat(n, f) requires 'n' to be an IntegralConstant");
     #endif
 
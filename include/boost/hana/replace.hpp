@@ -25,11 +25,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto replace_t::operator()(Xs&& xs, OldVal&& oldval, NewVal&& newval) const {
         using S = typename hana::tag_of<Xs>::type;
         using Replace = BOOST_HANA_DISPATCH_IF(replace_impl<S>,
-            hana::Functor<S>::value
+            detail::capabilities<S>::Functor
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Functor<S>::value,
+        static_assert(detail::capabilities<S>::Functor,
         "hana::replace(xs, oldval, newval) requires 'xs' to be a Functor");
     #endif
 
@@ -25,11 +25,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto replace_if_t::operator()(Xs&& xs, Pred&& pred, Value&& value) const {
         using S = typename hana::tag_of<Xs>::type;
         using ReplaceIf = BOOST_HANA_DISPATCH_IF(replace_if_impl<S>,
-            hana::Functor<S>::value
+            detail::capabilities<S>::Functor
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Functor<S>::value,
+        static_assert(detail::capabilities<S>::Functor,
         "hana::replace_if(xs, pred, value) requires 'xs' to be a Functor");
     #endif
 
@@ -28,19 +28,19 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename M>
     struct replicate_t {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::MonadPlus<M>::value,
+        static_assert(detail::capabilities<M>::MonadPlus,
         "hana::replicate<M>(x, n) requires 'M' to be a MonadPlus");
     #endif
 
         template <typename X, typename N>
         constexpr auto operator()(X&& x, N const& n) const {
             using Replicate = BOOST_HANA_DISPATCH_IF(replicate_impl<M>,
-                hana::MonadPlus<M>::value &&
-                hana::IntegralConstant<N>::value
+                detail::capabilities<M>::MonadPlus &&
+                detail::capabilities_of<N>::IntegralConstant
             );
 
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            static_assert(hana::IntegralConstant<N>::value,
+            static_assert(detail::capabilities_of<N>::IntegralConstant,
             "hana::replicate<M>(x, n) requires 'n' to be an IntegralConstant");
         #endif
 
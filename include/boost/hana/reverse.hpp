@@ -17,6 +17,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 #include <boost/hana/length.hpp>
 
 #include <cstddef>
@@ -29,11 +30,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto reverse_t::operator()(Xs&& xs) const {
         using S = typename hana::tag_of<Xs>::type;
         using Reverse = BOOST_HANA_DISPATCH_IF(reverse_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::reverse(xs) requires 'xs' to be a Sequence");
     #endif
 
@@ -53,7 +54,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename Xs>
         static constexpr auto apply(Xs&& xs) {
             constexpr std::size_t N = decltype(hana::length(xs))::value;
-            return reverse_helper(static_cast<Xs&&>(xs), std::make_index_sequence<N>{});
+            return reverse_helper(static_cast<Xs&&>(xs), detail::make_index_sequence<N>{});
         }
     };
 BOOST_HANA_NAMESPACE_END
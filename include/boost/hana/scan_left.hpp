@@ -31,11 +31,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto scan_left_t::operator()(Xs&& xs, F const& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using ScanLeft = BOOST_HANA_DISPATCH_IF(scan_left_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
 #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::scan_left(xs, f) requires 'xs' to be a Sequence");
 #endif
 
@@ -46,11 +46,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto scan_left_t::operator()(Xs&& xs, State&& state, F const& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using ScanLeft = BOOST_HANA_DISPATCH_IF(scan_left_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
 #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::scan_left(xs, state, f) requires 'xs' to be a Sequence");
 #endif
 
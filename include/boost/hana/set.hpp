@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/set.hpp>
 
 #include <boost/hana/at.hpp>
+#include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/concept/comparable.hpp>
 #include <boost/hana/concept/constant.hpp>
@@ -24,6 +25,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/detail/has_duplicates.hpp>
+#include <boost/hana/detail/hash_table.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/searchable.hpp>
@@ -32,15 +34,18 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/find_if.hpp>
 #include <boost/hana/fold_left.hpp>
 #include <boost/hana/fwd/any_of.hpp>
+#include <boost/hana/fwd/at_key.hpp>
 #include <boost/hana/fwd/core/to.hpp>
 #include <boost/hana/fwd/difference.hpp>
+#include <boost/hana/fwd/find.hpp>
 #include <boost/hana/fwd/intersection.hpp>
 #include <boost/hana/fwd/union.hpp>
 #include <boost/hana/insert.hpp>
 #include <boost/hana/is_subset.hpp>
 #include <boost/hana/length.hpp>
+#include <boost/hana/optional.hpp>
 #include <boost/hana/or.hpp>
-#include <boost/hana/remove.hpp>
+#include <boost/hana/remove_at.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/unpack.hpp>
 #include <boost/hana/value.hpp>
@@ -87,6 +92,43 @@ BOOST_HANA_NAMESPACE_BEGIN
         };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // Hash table
+    //
+    // The hash table of a set is not part of its type; it is computed on
+    // demand from the elements of the set the first time a lookup is
+    // performed, and it is then memoized by the compiler.
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // See `KeyAtIndex` in map.hpp for why `type_at` is not used here.
+        template <typename Storage>
+        struct SetKeyAtIndex {
+            template <std::size_t i>
+            using apply = decltype(hana::get_impl<i>(std::declval<Storage>()));
+        };
+
+        template <typename Set>
+        struct set_hash_table;
+
+        template <typename ...Xs>
+        struct set_hash_table<hana::set<Xs...>> {
+            using type = typename detail::make_hash_table<
+                detail::SetKeyAtIndex<hana::basic_tuple<Xs...>>::template apply, sizeof...(Xs)
+            >::type;
+        };
+
+        template <typename Set, typename Key>
+        struct set_find_index;
+
+        template <typename ...Xs, typename Key>
+        struct set_find_index<hana::set<Xs...>, Key> {
+            using type = typename detail::find_index<
+                typename set_hash_table<hana::set<Xs...>>::type,
+                Key, detail::SetKeyAtIndex<hana::basic_tuple<Xs...>>::template apply
+            >::type;
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // make<set_tag>
     //////////////////////////////////////////////////////////////////////////
@@ -162,6 +204,50 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    template <>
+    struct find_impl<set_tag> {
+        template <typename Xs>
+        static constexpr auto find_helper(Xs&&, ...) {
+            return hana::nothing;
+        }
+
+        template <typename Xs, std::size_t i>
+        static constexpr auto
+        find_helper(Xs&& xs, hana::optional<std::integral_constant<std::size_t, i>>) {
+            return hana::just(hana::at_c<i>(static_cast<Xs&&>(xs).storage));
+        }
+
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs&& xs, Key const&) {
+            using RawSet = typename detail::decay<Xs>::type;
+            using MaybeIndex = typename detail::set_find_index<RawSet, Key>::type;
+            return find_helper(static_cast<Xs&&>(xs), MaybeIndex{});
+        }
+    };
+
+    template <>
+    struct contains_impl<set_tag> {
+        template <typename Xs, typename Key>
+        static constexpr auto apply(Xs const&, Key const&) {
+            using RawSet = typename detail::decay<Xs>::type;
+            using MaybeIndex = typename detail::set_find_index<RawSet, Key>::type;
+            return hana::bool_c<!decltype(hana::is_nothing(MaybeIndex{}))::value>;
+        }
+    };
+
+    template <>
+    struct at_key_impl<set_tag> {
+        template <typename Xs, typename Key>
+        static constexpr decltype(auto) apply(Xs&& xs, Key const&) {
+            using RawSet = typename detail::decay<Xs>::type;
+            using MaybeIndex = typename detail::set_find_index<RawSet, Key>::type;
+            static_assert(!decltype(hana::is_nothing(MaybeIndex{}))::value,
+                "hana::at_key(set, key) requires the 'key' to be present in the 'set'");
+            constexpr std::size_t index = decltype(*MaybeIndex{}){}();
+            return hana::at_c<index>(static_cast<Xs&&>(xs).storage);
+        }
+    };
+
     template <>
     struct any_of_impl<set_tag> {
         template <typename Pred>
@@ -204,13 +290,31 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     // Conversions
     //////////////////////////////////////////////////////////////////////////
+    //
+    // Instead of inserting the elements one at a time, which would create
+    // a new set (and perform a lookup) for each element, we compute the
+    // indices of the unique elements in a single pass over a hash table
+    // and then create the resulting set directly.
     template <typename F>
     struct to_impl<set_tag, F, when<hana::Foldable<F>::value>> {
+        template <typename Storage, std::size_t ...i>
+        static constexpr auto make_helper(Storage&& storage, std::index_sequence<i...>) {
+            return set<typename detail::decay<
+                decltype(hana::get_impl<i>(static_cast<Storage&&>(storage)))
+            >::type...>{
+                hana::make_tuple(hana::get_impl<i>(static_cast<Storage&&>(storage))...)
+            };
+        }
+
         template <typename Xs>
-        static constexpr decltype(auto) apply(Xs&& xs) {
-            return hana::fold_left(static_cast<Xs&&>(xs),
-                                   hana::make_set(),
-                                   hana::insert);
+        static constexpr auto apply(Xs&& xs) {
+            using Storage = decltype(hana::unpack(static_cast<Xs&&>(xs), hana::make_basic_tuple));
+            using Indices = typename detail::unique_indices<
+                detail::SetKeyAtIndex<Storage>::template apply,
+                decltype(hana::length(xs))::value
+            >::type;
+            return make_helper(hana::unpack(static_cast<Xs&&>(xs), hana::make_basic_tuple),
+                               Indices{});
         }
     };
 
@@ -235,8 +339,10 @@ BOOST_HANA_NAMESPACE_BEGIN
 
         template <typename Xs, typename X>
         static constexpr auto apply(Xs&& xs, X&& x) {
-            constexpr bool c = hana::value<decltype(hana::contains(xs, x))>();
-            constexpr std::size_t size = std::remove_reference<Xs>::type::size;
+            using RawSet = typename detail::decay<Xs>::type;
+            using MaybeIndex = typename detail::set_find_index<RawSet, X>::type;
+            constexpr bool c = !decltype(hana::is_nothing(MaybeIndex{}))::value;
+            constexpr std::size_t size = RawSet::size;
             return insert_helper(static_cast<Xs&&>(xs), static_cast<X&&>(x),
                                  hana::bool_c<c>, std::make_index_sequence<size>{});
         }
@@ -247,50 +353,89 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct erase_key_impl<set_tag> {
-        template <typename Xs, typename X>
-        static constexpr decltype(auto) apply(Xs&& xs, X&& x) {
+        template <typename Xs>
+        static constexpr auto erase_key_helper(Xs&& xs, ...) {
+            return static_cast<Xs&&>(xs);
+        }
+
+        template <typename Xs, std::size_t i>
+        static constexpr auto
+        erase_key_helper(Xs&& xs, hana::optional<std::integral_constant<std::size_t, i>>) {
             return hana::unpack(
-                hana::remove(static_cast<Xs&&>(xs).storage,
-                             static_cast<X&&>(x)),
+                hana::remove_at_c<i>(static_cast<Xs&&>(xs).storage),
                 hana::make_set
             );
         }
+
+        template <typename Xs, typename X>
+        static constexpr auto apply(Xs&& xs, X const&) {
+            using RawSet = typename detail::decay<Xs>::type;
+            using MaybeIndex = typename detail::set_find_index<RawSet, X>::type;
+            return erase_key_helper(static_cast<Xs&&>(xs), MaybeIndex{});
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
-    // intersection
+    // Set-theoretic operations
+    //
+    // Like for `hana::map`, each element of the first set is looked up in
+    // the hash table of the second set in a single pass, and the resulting
+    // set is created at once from the elements to keep.
     //////////////////////////////////////////////////////////////////////////
     namespace detail {
-        template <typename Ys>
-        struct set_insert_if_contains {
-            Ys const& ys;
-
-            template <typename Result, typename Key>
-            static constexpr auto helper(Result&& result, Key&& key, hana::true_) {
-                return hana::insert(static_cast<Result&&>(result), static_cast<Key&&>(key));
-            }
+        template <bool Found, typename Xs, typename Ys>
+        struct set_lookup_results;
+
+        template <bool Found, typename ...X, typename ...Y>
+        struct set_lookup_results<Found, hana::set<X...>, hana::set<Y...>> {
+            using type = typename detail::lookup_results<
+                Found,
+                typename set_hash_table<hana::set<Y...>>::type,
+                SetKeyAtIndex<hana::basic_tuple<Y...>>::template apply,
+                SetKeyAtIndex<hana::basic_tuple<X...>>::template apply,
+                sizeof...(X)
+            >::type;
+        };
 
-            template <typename Result, typename Key>
-            static constexpr auto helper(Result&& result, Key&&, hana::false_) {
-                return static_cast<Result&&>(result);
+        template <bool Found>
+        struct set_select {
+            template <typename Results, typename Xs, typename Ys,
+                      std::size_t ...k, std::size_t ...j>
+            static constexpr auto
+            helper(Xs&& xs, Ys&& ys, std::index_sequence<k...>, std::index_sequence<j...>) {
+                return hana::make_set(
+                    hana::at_c<Results::template indices<true>[k]>(static_cast<Xs&&>(xs).storage)...,
+                    hana::at_c<j>(static_cast<Ys&&>(ys).storage)...
+                );
             }
 
-            template <typename Result, typename Key>
-            constexpr auto operator()(Result&& result, Key&& key) const {
-                constexpr bool keep = hana::value<decltype(hana::contains(ys, key))>();
-                return set_insert_if_contains::helper(static_cast<Result&&>(result),
-                                                      static_cast<Key&&>(key),
-                                                      hana::bool_c<keep>);
+            // Returns a set containing the elements of `xs` which are (or are
+            // not) in `ys`, followed by the elements at the `Extra` indices
+            // of `ys`.
+            template <typename Extra, typename Xs, typename Ys>
+            static constexpr auto apply(Xs&& xs, Ys&& ys) {
+                using Results = typename set_lookup_results<
+                    Found,
+                    typename detail::decay<Xs>::type,
+                    typename detail::decay<Ys>::type
+                >::type;
+                return helper<Results>(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
+                                       std::make_index_sequence<Results::count>{},
+                                       Extra{});
             }
         };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // intersection
+    //////////////////////////////////////////////////////////////////////////
     template <>
     struct intersection_impl<set_tag> {
         template <typename Xs, typename Ys>
         static constexpr auto apply(Xs&& xs, Ys const& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), hana::make_set(),
-                                   detail::set_insert_if_contains<Ys>{ys});
+            return detail::set_select<true>::template apply<std::index_sequence<>>(
+                static_cast<Xs&&>(xs), ys
+            );
         }
     };
 
@@ -301,8 +446,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct union_impl<set_tag> {
         template <typename Xs, typename Ys>
         static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
-                                   hana::insert);
+            constexpr std::size_t size = detail::decay<Ys>::type::size;
+            return detail::set_select<false>::template apply<std::make_index_sequence<size>>(
+                static_cast<Xs&&>(xs), static_cast<Ys&&>(ys)
+            );
         }
     };
 
@@ -312,9 +459,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <>
     struct difference_impl<set_tag> {
         template <typename Xs, typename Ys>
-        static constexpr auto apply(Xs&& xs, Ys&& ys) {
-            return hana::fold_left(static_cast<Ys&&>(ys), static_cast<Xs&&>(xs),
-                                   hana::erase_key);
+        static constexpr auto apply(Xs&& xs, Ys const& ys) {
+            return detail::set_select<false>::template apply<std::index_sequence<>>(
+                static_cast<Xs&&>(xs), ys
+            );
         }
     };
 BOOST_HANA_NAMESPACE_END
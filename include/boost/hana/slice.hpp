@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 #include <boost/hana/range.hpp>
 #include <boost/hana/unpack.hpp>
 
@@ -31,15 +32,15 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto slice_t::operator()(Xs&& xs, Indices&& indices) const {
         using S = typename hana::tag_of<Xs>::type;
         using Slice = BOOST_HANA_DISPATCH_IF(slice_impl<S>,
-            hana::Sequence<S>::value &&
-            hana::Foldable<Indices>::value
+            detail::capabilities<S>::Sequence &&
+            detail::capabilities_of<Indices>::Foldable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::slice(xs, indices) requires 'xs' to be a Sequence");
 
-        static_assert(hana::Foldable<Indices>::value,
+        static_assert(detail::capabilities_of<Indices>::Foldable,
         "hana::slice(xs, indices) requires 'indices' to be Foldable");
     #endif
 
@@ -70,7 +71,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename Xs, typename T, T from, T to>
         static constexpr auto apply(Xs&& xs, hana::range<T, from, to> const&) {
             return slice_impl::from_offset<from>(
-                static_cast<Xs&&>(xs), std::make_index_sequence<to - from>{}
+                static_cast<Xs&&>(xs), detail::make_index_sequence<to - from>{}
             );
         }
 
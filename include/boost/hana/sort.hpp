@@ -17,10 +17,13 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/array.hpp>
 #include <boost/hana/detail/nested_by.hpp> // required by fwd decl
 #include <boost/hana/length.hpp>
 #include <boost/hana/less.hpp>
 
+#include <cstddef>
 #include <utility> // std::declval, std::index_sequence
 
 
@@ -30,11 +33,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto sort_t::operator()(Xs&& xs, Predicate&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using Sort = BOOST_HANA_DISPATCH_IF(sort_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::sort(xs, predicate) requires 'xs' to be a Sequence");
     #endif
 
@@ -46,11 +49,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto sort_t::operator()(Xs&& xs) const {
         using S = typename hana::tag_of<Xs>::type;
         using Sort = BOOST_HANA_DISPATCH_IF(sort_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::sort(xs) requires 'xs' to be a Sequence");
     #endif
 
@@ -68,80 +71,188 @@ BOOST_HANA_NAMESPACE_BEGIN
             ));
         };
 
-        template <typename Pred, std::size_t Insert, bool IsInsertionPoint,
-                  typename Left,
-                  std::size_t ...Right>
-        struct insert;
-
-        // We did not find the insertion point; continue processing elements
-        // recursively.
-        template <
-            typename Pred, std::size_t Insert,
-            std::size_t ...Left,
-            std::size_t Right1, std::size_t Right2, std::size_t ...Right
-        >
-        struct insert<Pred, Insert, false,
-                      std::index_sequence<Left...>,
-                      Right1, Right2, Right...
-        > {
-            using type = typename insert<
-                Pred, Insert, (bool)Pred::template apply<Insert, Right2>::value,
-                std::index_sequence<Left..., Right1>,
-                Right2, Right...
-            >::type;
+        // The sort is a merge sort whose template recursion depth is
+        // logarithmic in the length of the sequence:
+        //
+        // 1. Short runs of elements are sorted by evaluating the predicate
+        //    on every pair of elements of the run in a single pack expansion,
+        //    and then sorting the indices of the run with a constexpr sort
+        //    that looks up the results of the predicate in that table.
+        //
+        // 2. Sorted runs are merged by splitting the longest of the two runs
+        //    at its middle element, finding the position of that element in
+        //    the other run with a binary search and then merging both halves
+        //    recursively. This performs O(n) predicate calls per merge, and
+        //    the recursion depth is O(log^2 n) instead of O(n).
+        //
+        // Both steps preserve the relative order of equivalent elements,
+        // which makes the sort stable.
+        template <std::size_t ...i>
+        struct sort_run {
+            static constexpr std::size_t size = sizeof...(i);
+            static constexpr std::size_t at[sizeof...(i) + 1] = {i..., 0}; // avoid empty array
         };
 
-        // We did not find the insertion point, but there is only one element
-        // left. We insert at the end of the list, and we're done.
-        template <typename Pred, std::size_t Insert, std::size_t ...Left, std::size_t Last>
-        struct insert<Pred, Insert, false, std::index_sequence<Left...>, Last> {
-            using type = std::index_sequence<Left..., Last, Insert>;
+        template <std::size_t ...i>
+        constexpr std::size_t sort_run<i...>::at[];
+
+        template <typename Run, std::size_t From, typename Indices>
+        struct sort_run_slice_impl;
+
+        template <typename Run, std::size_t From, std::size_t ...k>
+        struct sort_run_slice_impl<Run, From, std::index_sequence<k...>> {
+            using type = sort_run<Run::at[From + k]...>;
+        };
+
+        template <typename Run, std::size_t From, std::size_t To>
+        using sort_run_slice = typename sort_run_slice_impl<
+            Run, From, std::make_index_sequence<To - From>
+        >::type;
+
+        template <typename Left, typename Middle, typename Right>
+        struct sort_run_concat;
+
+        template <std::size_t ...l, std::size_t ...m, std::size_t ...r>
+        struct sort_run_concat<sort_run<l...>, sort_run<m...>, sort_run<r...>> {
+            using type = sort_run<l..., m..., r...>;
         };
 
-        // We found the insertion point, we're done.
-        template <typename Pred, std::size_t Insert, std::size_t ...Left, std::size_t ...Right>
-        struct insert<Pred, Insert, true, std::index_sequence<Left...>, Right...> {
-            using type = std::index_sequence<Left..., Insert, Right...>;
+        // Returns the number of elements at the beginning of the (sorted)
+        // `Run` that must be placed before the element at index `X` of the
+        // sequence. If `XIsFirst` is true, `X` comes from a run that precedes
+        // `Run` in the sequence, and elements equivalent to `X` must thus be
+        // placed after it. Otherwise, they must be placed before it.
+        template <typename Pred, typename Run, std::size_t X, bool XIsFirst,
+                  std::size_t Low, std::size_t High, bool = (Low < High)>
+        struct sort_bound {
+            static constexpr std::size_t value = Low;
+        };
+
+        template <typename Pred, typename Run, std::size_t X, bool XIsFirst,
+                  std::size_t Low, std::size_t High>
+        struct sort_bound<Pred, Run, X, XIsFirst, Low, High, true> {
+            static constexpr std::size_t Mid = Low + (High - Low) / 2;
+            static constexpr bool go_right = XIsFirst
+                ? static_cast<bool>(Pred::template apply<Run::at[Mid], X>::value)
+                : !static_cast<bool>(Pred::template apply<X, Run::at[Mid]>::value);
+
+            static constexpr std::size_t value = go_right
+                ? sort_bound<Pred, Run, X, XIsFirst, Mid + 1, High>::value
+                : sort_bound<Pred, Run, X, XIsFirst, Low, Mid>::value;
+        };
+
+        template <typename Pred, typename Left, typename Right,
+                  bool = (Left::size == 0 || Right::size == 0),
+                  bool = (Left::size >= Right::size)>
+        struct sort_merge;
+
+        template <typename Pred, typename Left, typename Right, bool LeftIsLonger>
+        struct sort_merge<Pred, Left, Right, true, LeftIsLonger> {
+            using type = typename sort_run_concat<Left, Right, sort_run<>>::type;
         };
 
+        template <typename Pred, typename Left, typename Right>
+        struct sort_merge<Pred, Left, Right, false, true> {
+            static constexpr std::size_t Mid = Left::size / 2;
+            static constexpr std::size_t Split = sort_bound<
+                Pred, Right, Left::at[Mid], true, 0, Right::size
+            >::value;
 
-        template <typename Pred, typename Result, std::size_t ...T>
-        struct insertion_sort_impl;
-
-        template <typename Pred,
-                  std::size_t Result1, std::size_t ...Result,
-                  std::size_t T, std::size_t ...Ts>
-        struct insertion_sort_impl<Pred, std::index_sequence<Result1, Result...>, T, Ts...> {
-            using type = typename insertion_sort_impl<
-                Pred,
-                typename insert<
-                    Pred, T, (bool)Pred::template apply<T, Result1>::value,
-                    std::index_sequence<>,
-                    Result1, Result...
-                >::type,
-                Ts...
+            using type = typename sort_run_concat<
+                typename sort_merge<Pred, sort_run_slice<Left, 0, Mid>,
+                                          sort_run_slice<Right, 0, Split>>::type,
+                sort_run<Left::at[Mid]>,
+                typename sort_merge<Pred, sort_run_slice<Left, Mid + 1, Left::size>,
+                                          sort_run_slice<Right, Split, Right::size>>::type
             >::type;
         };
 
-        template <typename Pred, std::size_t T, std::size_t ...Ts>
-        struct insertion_sort_impl<Pred, std::index_sequence<>, T, Ts...> {
-            using type = typename insertion_sort_impl<
-                Pred, std::index_sequence<T>, Ts...
+        template <typename Pred, typename Left, typename Right>
+        struct sort_merge<Pred, Left, Right, false, false> {
+            static constexpr std::size_t Mid = Right::size / 2;
+            static constexpr std::size_t Split = sort_bound<
+                Pred, Left, Right::at[Mid], false, 0, Left::size
+            >::value;
+
+            using type = typename sort_run_concat<
+                typename sort_merge<Pred, sort_run_slice<Left, 0, Split>,
+                                          sort_run_slice<Right, 0, Mid>>::type,
+                sort_run<Right::at[Mid]>,
+                typename sort_merge<Pred, sort_run_slice<Left, Split, Left::size>,
+                                          sort_run_slice<Right, Mid + 1, Right::size>>::type
             >::type;
         };
 
-        template <typename Pred, typename Result>
-        struct insertion_sort_impl<Pred, Result> {
-            using type = Result;
+        // The result of `pred(x_i, x_j)` is stored at index
+        // `i * (N - 1) + j - (j > i)` of the table; `pred(x_i, x_i)`
+        // is never needed, so it is not computed.
+        struct sort_table_less {
+            bool const* table;
+            std::size_t size;
+
+            constexpr bool operator()(std::size_t i, std::size_t j) const
+            { return table[i * (size - 1) + j - (j > i)]; }
         };
 
-        template <typename Pred, typename Indices>
-        struct sort_helper;
+        template <typename Pred, std::size_t From, std::size_t N,
+                  typename Pairs = std::make_index_sequence<N * (N - 1)>,
+                  typename Indices = std::make_index_sequence<N>>
+        struct sort_small_run;
+
+        template <typename Pred, std::size_t From, std::size_t N,
+                  std::size_t ...k, std::size_t ...i>
+        struct sort_small_run<Pred, From, N, std::index_sequence<k...>,
+                                             std::index_sequence<i...>>
+        {
+            static constexpr auto compute_indices() {
+                constexpr bool table[] = {false, // avoid empty array
+                    static_cast<bool>(Pred::template apply<
+                        From + k / (N - 1),
+                        From + k % (N - 1) + (k % (N - 1) >= k / (N - 1))
+                    >::value)...
+                };
+                detail::array<std::size_t, N> indices{};
+                detail::iota(indices.begin(), indices.end(), 0);
+                detail::sort(indices.begin(), indices.end(),
+                             sort_table_less{table + 1, N});
+                return indices;
+            }
+
+            static constexpr detail::array<std::size_t, N> indices = compute_indices();
+            using type = sort_run<(From + indices[i])...>;
+        };
+
+        // Runs of at most that many elements are sorted with a table of
+        // the results of the predicate.
+        constexpr std::size_t sort_small_run_max = 8;
+
+        template <typename Pred, std::size_t From, std::size_t To,
+                  bool = (To - From <= sort_small_run_max)>
+        struct merge_sort {
+            static constexpr std::size_t Mid = From + (To - From) / 2;
+            using type = typename sort_merge<Pred,
+                typename merge_sort<Pred, From, Mid>::type,
+                typename merge_sort<Pred, Mid, To>::type
+            >::type;
+        };
+
+        template <typename Pred, std::size_t From, std::size_t To>
+        struct merge_sort<Pred, From, To, true>
+            : sort_small_run<Pred, From, To - From>
+        { };
+
+        template <typename Run>
+        struct sort_run_to_index_sequence;
+
+        template <std::size_t ...i>
+        struct sort_run_to_index_sequence<sort_run<i...>> {
+            using type = std::index_sequence<i...>;
+        };
 
-        template <typename Pred, std::size_t ...i>
-        struct sort_helper<Pred, std::index_sequence<i...>> {
-            using type = typename insertion_sort_impl<
-                Pred, std::index_sequence<>, i...
+        template <typename Pred, std::size_t Len>
+        struct sort_helper {
+            using type = typename sort_run_to_index_sequence<
+                typename merge_sort<Pred, 0, Len>::type
             >::type;
         };
     } // end namespace detail
@@ -157,8 +268,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr auto apply(Xs&& xs, Pred const&) {
             constexpr std::size_t Len = decltype(hana::length(xs))::value;
             using Indices = typename detail::sort_helper<
-                detail::sort_predicate<Xs&&, Pred>,
-                std::make_index_sequence<Len>
+                detail::sort_predicate<Xs&&, Pred>, Len
             >::type;
 
             return apply_impl(static_cast<Xs&&>(xs), Indices{});
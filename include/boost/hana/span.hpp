@@ -18,8 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/detail/nested_by.hpp> // required by fwd decl
-#include <boost/hana/detail/first_unsatisfied_index.hpp>
-#include <boost/hana/length.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/unpack.hpp>
 
@@ -33,11 +32,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto span_t::operator()(Xs&& xs, Pred&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using Span = BOOST_HANA_DISPATCH_IF(span_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::span(xs, pred) requires 'xs' to be a Sequence");
     #endif
 
@@ -59,12 +58,10 @@ BOOST_HANA_NAMESPACE_BEGIN
 
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred&&) {
-            using FirstUnsatisfied = decltype(
-                hana::unpack(static_cast<Xs&&>(xs),
-                             detail::first_unsatisfied_index<Pred&&>{})
-            );
-            constexpr std::size_t breakpoint = FirstUnsatisfied::value;
-            constexpr std::size_t N = decltype(hana::length(xs))::value;
+            using Results = decltype(hana::unpack(static_cast<Xs&&>(xs),
+                                     detail::make_predicate_results<Pred&&>{}));
+            constexpr std::size_t breakpoint = Results::first_unsatisfied;
+            constexpr std::size_t N = Results::size;
             return span_helper(static_cast<Xs&&>(xs),
                                std::make_index_sequence<breakpoint>{},
                                std::make_index_sequence<N - breakpoint>{});
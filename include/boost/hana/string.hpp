@@ -16,6 +16,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/detail/algorithm.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/iterable.hpp>
@@ -32,14 +34,19 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/is_empty.hpp>
 #include <boost/hana/fwd/length.hpp>
 #include <boost/hana/fwd/less.hpp>
+#include <boost/hana/fwd/plus.hpp>
 #include <boost/hana/fwd/unpack.hpp>
+#include <boost/hana/fwd/zero.hpp>
 #include <boost/hana/if.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/optional.hpp>
+#include <boost/hana/tuple.hpp>
 #include <boost/hana/type.hpp>
 
 #include <utility>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 
 
@@ -287,6 +294,383 @@ BOOST_HANA_NAMESPACE_BEGIN
             return hana::type_c<String>;
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Monoid
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct plus_impl<string_tag, string_tag> {
+        template <char ...s1, char ...s2>
+        static constexpr auto
+        apply(string<s1...> const&, string<s2...> const&)
+        { return string<s1..., s2...>{}; }
+    };
+
+    template <>
+    struct zero_impl<string_tag> {
+        static constexpr auto apply()
+        { return string<>{}; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // String algorithms
+    //
+    // The characters (or the bounds) of the result are computed at once in
+    // a `constexpr` array, which is then expanded with a single index
+    // sequence, like in `drop_front_impl`. This keeps the number of
+    // instantiations independent of the number of characters.
+    //////////////////////////////////////////////////////////////////////////
+    namespace string_detail {
+        template <typename S>
+        struct is_string : std::false_type { };
+
+        template <char ...s>
+        struct is_string<string<s...>> : std::true_type { };
+
+        template <typename S>
+        struct chars_of;
+
+        template <char ...s>
+        struct chars_of<string<s...>> {
+            static constexpr std::size_t size = sizeof...(s);
+            static constexpr char const* get()
+            { return to_impl<char const*, string_tag>::apply(string<s...>{}); }
+        };
+
+        template <typename Chars, std::size_t first, std::size_t ...i>
+        constexpr string<Chars::get()[first + i]...>
+        substring(std::index_sequence<i...>)
+        { return {}; }
+
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        constexpr bool matches(char const* s, char const* pattern, std::size_t m) {
+            for (std::size_t i = 0; i != m; ++i)
+                if (s[i] != pattern[i])
+                    return false;
+            return true;
+        }
+
+        constexpr std::size_t search(char const* s, std::size_t n,
+                                     char const* pattern, std::size_t m,
+                                     std::size_t from)
+        {
+            for (std::size_t i = from; i + m <= n; ++i)
+                if (string_detail::matches(s + i, pattern, m))
+                    return i;
+            return npos;
+        }
+
+        // Number of non-overlapping occurrences of a non-empty pattern.
+        constexpr std::size_t count(char const* s, std::size_t n,
+                                    char const* pattern, std::size_t m)
+        {
+            std::size_t result = 0;
+            if (m == 0)
+                return result;
+            for (std::size_t i = string_detail::search(s, n, pattern, m, 0);
+                 i != npos; i = string_detail::search(s, n, pattern, m, i + m))
+                ++result;
+            return result;
+        }
+
+        template <std::size_t N>
+        constexpr std::size_t total_length(std::size_t const (&lengths)[N]) {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != N; ++i)
+                result += lengths[i];
+            return result;
+        }
+
+        template <std::size_t Size, std::size_t N>
+        constexpr detail::array<char, Size>
+        concat(char const* const (&strings)[N + 1], std::size_t const (&lengths)[N + 1]) {
+            detail::array<char, Size> result{};
+            std::size_t out = 0;
+            for (std::size_t i = 0; i != N; ++i)
+                for (std::size_t c = 0; c != lengths[i]; ++c)
+                    result[out++] = strings[i][c];
+            return result;
+        }
+
+        template <typename ...S>
+        struct concatenation {
+            static constexpr std::size_t size =
+                string_detail::total_length<sizeof...(S) + 1>({chars_of<S>::size..., 0});
+
+            using value_type = detail::array<char, size>;
+            static constexpr value_type value = string_detail::concat<size, sizeof...(S)>(
+                {chars_of<S>::get()..., nullptr}, {chars_of<S>::size..., 0}
+            );
+
+            static constexpr char const* get()
+            { return value.begin(); }
+        };
+
+        template <typename ...S>
+        constexpr typename concatenation<S...>::value_type concatenation<S...>::value;
+
+        template <std::size_t Size>
+        constexpr detail::array<char, Size>
+        replace(char const* s, std::size_t n, char const* oldval, std::size_t m,
+                char const* newval, std::size_t k)
+        {
+            detail::array<char, Size> result{};
+            std::size_t out = 0, i = 0;
+            for (std::size_t match = string_detail::search(s, n, oldval, m, 0);
+                 m != 0 && match != npos;
+                 match = string_detail::search(s, n, oldval, m, i))
+            {
+                for (; i != match; ++i)
+                    result[out++] = s[i];
+                for (std::size_t c = 0; c != k; ++c)
+                    result[out++] = newval[c];
+                i += m;
+            }
+            for (; i != n; ++i)
+                result[out++] = s[i];
+            return result;
+        }
+
+        template <typename S, typename OldVal, typename NewVal>
+        struct replacement {
+            static constexpr std::size_t occurrences = string_detail::count(
+                chars_of<S>::get(), chars_of<S>::size,
+                chars_of<OldVal>::get(), chars_of<OldVal>::size
+            );
+            static constexpr std::size_t size = chars_of<S>::size
+                - occurrences * chars_of<OldVal>::size
+                + occurrences * chars_of<NewVal>::size;
+
+            using value_type = detail::array<char, size>;
+            static constexpr value_type value = string_detail::replace<size>(
+                chars_of<S>::get(), chars_of<S>::size,
+                chars_of<OldVal>::get(), chars_of<OldVal>::size,
+                chars_of<NewVal>::get(), chars_of<NewVal>::size
+            );
+
+            static constexpr char const* get()
+            { return value.begin(); }
+        };
+
+        template <typename S, typename OldVal, typename NewVal>
+        constexpr typename replacement<S, OldVal, NewVal>::value_type
+        replacement<S, OldVal, NewVal>::value;
+
+        template <std::size_t N>
+        struct split_bounds {
+            detail::array<std::size_t, N> first;
+            detail::array<std::size_t, N> last;
+        };
+
+        template <std::size_t N>
+        constexpr split_bounds<N>
+        split(char const* s, std::size_t n, char const* separator, std::size_t m) {
+            split_bounds<N> bounds{};
+            std::size_t piece = 0, i = 0;
+            for (std::size_t match = string_detail::search(s, n, separator, m, 0);
+                 m != 0 && match != npos;
+                 match = string_detail::search(s, n, separator, m, i))
+            {
+                bounds.first[piece] = i;
+                bounds.last[piece++] = match;
+                i = match + m;
+            }
+            bounds.first[piece] = i;
+            bounds.last[piece] = n;
+            return bounds;
+        }
+
+        template <typename S, typename Separator>
+        struct splitting {
+            static constexpr std::size_t pieces = string_detail::count(
+                chars_of<S>::get(), chars_of<S>::size,
+                chars_of<Separator>::get(), chars_of<Separator>::size
+            ) + 1;
+
+            using bounds_type = split_bounds<pieces>;
+            static constexpr bounds_type bounds = string_detail::split<pieces>(
+                chars_of<S>::get(), chars_of<S>::size,
+                chars_of<Separator>::get(), chars_of<Separator>::size
+            );
+
+            template <std::size_t ...k>
+            static constexpr auto apply(std::index_sequence<k...>) {
+                return hana::make_tuple(
+                    string_detail::substring<chars_of<S>, bounds.first[k]>(
+                        std::make_index_sequence<bounds.last[k] - bounds.first[k]>{}
+                    )...
+                );
+            }
+        };
+
+        template <typename S, typename Separator>
+        constexpr typename splitting<S, Separator>::bounds_type
+        splitting<S, Separator>::bounds;
+
+        struct integer {
+            bool negative;
+            std::uintmax_t magnitude;
+            bool valid;
+        };
+
+        constexpr integer parse_integer(char const* s, std::size_t n) {
+            integer result{false, 0, false};
+            std::size_t i = 0;
+            if (i != n && s[i] == '-') {
+                result.negative = true;
+                ++i;
+            }
+            result.valid = i != n;
+            for (; i != n; ++i) {
+                if (s[i] < '0' || s[i] > '9')
+                    return integer{false, 0, false};
+                std::uintmax_t digit = static_cast<std::uintmax_t>(s[i] - '0');
+                if (result.magnitude > (std::numeric_limits<std::uintmax_t>::max() - digit) / 10)
+                    return integer{false, 0, false};
+                result.magnitude = result.magnitude * 10 + digit;
+            }
+            return result;
+        }
+
+        template <typename T>
+        constexpr bool is_representable(integer n) {
+            return n.negative
+                ? n.magnitude == 0 || (std::is_signed<T>::value &&
+                    n.magnitude - 1 <= static_cast<std::uintmax_t>(std::numeric_limits<T>::max()))
+                : n.magnitude <= static_cast<std::uintmax_t>(std::numeric_limits<T>::max());
+        }
+
+        template <typename T>
+        constexpr T integer_value(integer n) {
+            return !n.negative     ? static_cast<T>(n.magnitude)
+                 : n.magnitude == 0 ? T{0}
+                 : static_cast<T>(-static_cast<T>(n.magnitude - 1) - 1);
+        }
+    }
+
+    //! @cond
+    template <typename ...Strings>
+    constexpr auto string_concat_t::operator()(Strings const& ...) const {
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(detail::fast_and<string_detail::is_string<Strings>::value...>::value,
+        "hana::string_concat(s...) requires all its arguments to be hana::strings");
+    #endif
+
+        using Concatenation = string_detail::concatenation<Strings...>;
+        return string_detail::substring<Concatenation, 0>(
+            std::make_index_sequence<Concatenation::size>{});
+    }
+
+    template <typename S, typename Pattern>
+    constexpr auto string_find_t::operator()(S const&, Pattern const&) const {
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(string_detail::is_string<S>::value &&
+                      string_detail::is_string<Pattern>::value,
+        "hana::string_find(s, pattern) requires 's' and 'pattern' to be hana::strings");
+    #endif
+
+        constexpr std::size_t i = string_detail::search(
+            string_detail::chars_of<S>::get(), string_detail::chars_of<S>::size,
+            string_detail::chars_of<Pattern>::get(), string_detail::chars_of<Pattern>::size,
+            0
+        );
+        return hana::if_(hana::bool_c<i != string_detail::npos>,
+            hana::just(hana::size_c<i>),
+            hana::nothing
+        );
+    }
+
+    template <typename S, typename Separator>
+    constexpr auto string_split_t::operator()(S const&, Separator const&) const {
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(string_detail::is_string<S>::value &&
+                      string_detail::is_string<Separator>::value,
+        "hana::string_split(s, separator) requires 's' and 'separator' to be hana::strings");
+    #endif
+
+        static_assert(string_detail::chars_of<Separator>::size != 0,
+        "hana::string_split(s, separator) requires 'separator' not to be empty");
+
+        using Splitting = string_detail::splitting<S, Separator>;
+        return Splitting::apply(std::make_index_sequence<Splitting::pieces>{});
+    }
+
+    template <typename S, typename OldVal, typename NewVal>
+    constexpr auto
+    string_replace_t::operator()(S const&, OldVal const&, NewVal const&) const {
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(string_detail::is_string<S>::value &&
+                      string_detail::is_string<OldVal>::value &&
+                      string_detail::is_string<NewVal>::value,
+        "hana::string_replace(s, oldval, newval) requires 's', 'oldval' and "
+        "'newval' to be hana::strings");
+    #endif
+
+        static_assert(string_detail::chars_of<OldVal>::size != 0,
+        "hana::string_replace(s, oldval, newval) requires 'oldval' not to be empty");
+
+        using Replacement = string_detail::replacement<S, OldVal, NewVal>;
+        return string_detail::substring<Replacement, 0>(
+            std::make_index_sequence<Replacement::size>{});
+    }
+
+    template <typename S, typename Prefix>
+    constexpr auto starts_with_t::operator()(S const&, Prefix const&) const {
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(string_detail::is_string<S>::value &&
+                      string_detail::is_string<Prefix>::value,
+        "hana::starts_with(s, prefix) requires 's' and 'prefix' to be hana::strings");
+    #endif
+
+        using Chars = string_detail::chars_of<S>;
+        using PrefixChars = string_detail::chars_of<Prefix>;
+        return hana::bool_c<
+            PrefixChars::size <= Chars::size &&
+            string_detail::matches(Chars::get(), PrefixChars::get(), PrefixChars::size)
+        >;
+    }
+
+    template <typename S, typename Suffix>
+    constexpr auto ends_with_t::operator()(S const&, Suffix const&) const {
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(string_detail::is_string<S>::value &&
+                      string_detail::is_string<Suffix>::value,
+        "hana::ends_with(s, suffix) requires 's' and 'suffix' to be hana::strings");
+    #endif
+
+        using Chars = string_detail::chars_of<S>;
+        using SuffixChars = string_detail::chars_of<Suffix>;
+        return hana::bool_c<
+            SuffixChars::size <= Chars::size &&
+            string_detail::matches(Chars::get() + (Chars::size - SuffixChars::size),
+                                   SuffixChars::get(), SuffixChars::size)
+        >;
+    }
+
+    template <typename T>
+    template <typename S>
+    constexpr auto string_to_integral_t<T>::operator()(S const&) const {
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(string_detail::is_string<S>::value,
+        "hana::string_to_integral<T>(s) requires 's' to be a hana::string");
+    #endif
+
+        using Chars = string_detail::chars_of<S>;
+        constexpr string_detail::integer n =
+            string_detail::parse_integer(Chars::get(), Chars::size);
+
+        static_assert(n.valid,
+        "hana::string_to_integral<T>(s) requires 's' to be the decimal "
+        "representation of an integer");
+
+        static_assert(!n.valid || string_detail::is_representable<T>(n),
+        "hana::string_to_integral<T>(s) requires the integer represented "
+        "by 's' to be representable by 'T'");
+
+        return hana::integral_c<T, string_detail::integer_value<T>(n)>;
+    }
+    //! @endcond
 BOOST_HANA_NAMESPACE_END
 
 #endif // !BOOST_HANA_STRING_HPP
@@ -26,7 +26,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename M>
     struct sum_t {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Monoid<M>::value,
+        static_assert(detail::capabilities<M>::Monoid,
         "hana::sum<M> requires 'M' to be a Monoid");
     #endif
 
@@ -34,11 +34,11 @@ BOOST_HANA_NAMESPACE_BEGIN
         constexpr decltype(auto) operator()(Xs&& xs) const {
             using S = typename hana::tag_of<Xs>::type;
             using Sum = BOOST_HANA_DISPATCH_IF(sum_impl<S>,
-                hana::Foldable<S>::value
+                detail::capabilities<S>::Foldable
             );
 
         #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-            static_assert(hana::Foldable<S>::value,
+            static_assert(detail::capabilities<S>::Foldable,
             "hana::sum<M>(xs) requires 'xs' to be Foldable");
         #endif
 
@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/length.hpp>
 
@@ -31,15 +32,15 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto take_front_t::operator()(Xs&& xs, N const& n) const {
         using S = typename hana::tag_of<Xs>::type;
         using TakeFront = BOOST_HANA_DISPATCH_IF(take_front_impl<S>,
-            hana::Sequence<S>::value &&
-            hana::IntegralConstant<N>::value
+            detail::capabilities<S>::Sequence &&
+            detail::capabilities_of<N>::IntegralConstant
         );
 
 #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::take_front(xs, n) requires 'xs' to be a Sequence");
 
-        static_assert(hana::IntegralConstant<N>::value,
+        static_assert(detail::capabilities_of<N>::IntegralConstant,
         "hana::take_front(xs, n) requires 'n' to be an IntegralConstant");
 #endif
 
@@ -59,7 +60,7 @@ BOOST_HANA_NAMESPACE_BEGIN
             constexpr std::size_t n = N::value;
             constexpr std::size_t size = decltype(hana::length(xs))::value;
             return take_front_helper(static_cast<Xs&&>(xs),
-                        std::make_index_sequence<(n < size ? n : size)>{});
+                        detail::make_index_sequence<(n < size ? n : size)>{});
         }
     };
 
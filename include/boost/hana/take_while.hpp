@@ -15,7 +15,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/sequence.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
-#include <boost/hana/detail/first_unsatisfied_index.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/take_front.hpp>
 #include <boost/hana/unpack.hpp>
 
@@ -26,11 +27,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto take_while_t::operator()(Xs&& xs, Pred&& pred) const {
         using S = typename hana::tag_of<Xs>::type;
         using TakeWhile = BOOST_HANA_DISPATCH_IF(take_while_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::take_while(xs, pred) requires 'xs' to be a Sequence");
     #endif
 
@@ -43,11 +44,10 @@ BOOST_HANA_NAMESPACE_BEGIN
     struct take_while_impl<S, when<condition>> : default_ {
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred&&) {
-            using FirstUnsatisfied = decltype(
-                hana::unpack(static_cast<Xs&&>(xs),
-                             detail::first_unsatisfied_index<Pred&&>{})
-            );
-            return hana::take_front(static_cast<Xs&&>(xs), FirstUnsatisfied{});
+            using Results = decltype(hana::unpack(static_cast<Xs&&>(xs),
+                                     detail::make_predicate_results<Pred&&>{}));
+            return hana::take_front(static_cast<Xs&&>(xs),
+                                    hana::size_c<Results::first_unsatisfied>);
         }
     };
 BOOST_HANA_NAMESPACE_END
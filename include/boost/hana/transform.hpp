@@ -18,10 +18,16 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
 #include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/contiguous_elements.hpp>
+#include <boost/hana/detail/decay.hpp>
 #include <boost/hana/functional/always.hpp>
 #include <boost/hana/fwd/adjust_if.hpp>
 #include <boost/hana/unpack.hpp>
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 
 BOOST_HANA_NAMESPACE_BEGIN
     //! @cond
@@ -29,11 +35,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto transform_t::operator()(Xs&& xs, F&& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using Transform = BOOST_HANA_DISPATCH_IF(transform_impl<S>,
-            hana::Functor<S>::value
+            detail::capabilities<S>::Functor
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Functor<S>::value,
+        static_assert(detail::capabilities<S>::Functor,
         "hana::transform(xs, f) requires 'xs' to be a Functor");
     #endif
 
@@ -51,6 +57,32 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
     };
 
+    namespace detail {
+        // Whether transforming `Xs` with `f` can be done with a loop. This
+        // is the case when the elements of both `Xs` and the result are
+        // stored contiguously, and the result can be default constructed
+        // before the transformed elements are assigned to it.
+        template <typename Xs, typename F,
+                  bool = contiguous_elements<typename decay<Xs>::type>::value>
+        struct transform_loop {
+            static constexpr bool value = false;
+        };
+
+        template <typename Xs, typename F>
+        struct transform_loop<Xs, F, true> {
+            using Element = decltype(detail::contiguous_at(std::declval<Xs>(), 0));
+            using R = decltype(std::declval<F&>()(std::declval<Element>()));
+            using U = typename decay<R>::type;
+            using Result = typename contiguous_elements<
+                typename decay<Xs>::type
+            >::template rebind<U>;
+
+            static constexpr bool value = contiguous_elements<Result>::value &&
+                                          std::is_trivially_default_constructible<U>::value &&
+                                          std::is_assignable<U&, R>::value;
+        };
+    }
+
     template <typename S>
     struct transform_impl<S, when<Sequence<S>::value>> {
         //! @cond
@@ -65,11 +97,27 @@ BOOST_HANA_NAMESPACE_BEGIN
         //! @endcond
 
         template <typename Xs, typename F>
-        static constexpr auto apply(Xs&& xs, F&& f) {
+        static constexpr auto helper(Xs&& xs, F&& f, hana::false_) {
             // We use a pointer to workaround a Clang 3.5 ICE
             return hana::unpack(static_cast<Xs&&>(xs),
                                 transformer<decltype(&f)>{&f});
         }
+
+        template <typename Xs, typename F>
+        static constexpr auto helper(Xs&& xs, F&& f, hana::true_) {
+            using Result = typename detail::transform_loop<Xs, F>::Result;
+            using Contiguous = detail::contiguous_elements<Result>;
+            Result result{};
+            for (std::size_t i = 0; i != Contiguous::size; ++i)
+                Contiguous::data(result)[i] = f(detail::contiguous_at(static_cast<Xs&&>(xs), i));
+            return result;
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            return helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                          hana::bool_c<detail::transform_loop<Xs, F>::value>);
+        }
     };
 BOOST_HANA_NAMESPACE_END
 
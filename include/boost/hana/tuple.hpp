@@ -15,10 +15,13 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/basic_tuple.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/config.hpp>
+#include <boost/hana/detail/array_storage.hpp>
+#include <boost/hana/detail/contiguous_elements.hpp>
 #include <boost/hana/detail/decay.hpp>
 #include <boost/hana/detail/fast_and.hpp>
 #include <boost/hana/detail/index_if.hpp>
 #include <boost/hana/detail/intrinsics.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 #include <boost/hana/detail/operators/adl.hpp>
 #include <boost/hana/detail/operators/comparable.hpp>
 #include <boost/hana/detail/operators/iterable.hpp>
@@ -50,6 +53,28 @@ BOOST_HANA_NAMESPACE_BEGIN
         }
 
         struct from_index_sequence_t { };
+
+        // Homogeneous tuples of `array_storage`able types store their
+        // elements in an array, and other tuples use a `basic_tuple`. The
+        // elements are all the same if and only if rotating them by one
+        // yields the same list, which is checked with a single `is_same`.
+        template <typename ...Xn>
+        struct tuple_storage {
+            static constexpr bool contiguous = false;
+            using type = basic_tuple<Xn...>;
+        };
+
+        template <typename X, typename ...Xn>
+        struct tuple_storage<X, X, Xn...> {
+            static constexpr bool contiguous =
+                std::is_same<basic_tuple<X, Xn...>, basic_tuple<Xn..., X>>::value &&
+                detail::is_array_storable<X>::value;
+
+            using type = typename std::conditional<contiguous,
+                detail::array_storage<X, sizeof...(Xn) + 2>,
+                basic_tuple<X, X, Xn...>
+            >::type;
+        };
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -69,7 +94,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         : detail::operators::adl<tuple<Xn...>>
         , detail::iterable_operators<tuple<Xn...>>
     {
-        basic_tuple<Xn...> storage_;
+        typename detail::tuple_storage<Xn...>::type storage_;
         using hana_tag = tuple_tag;
 
     private:
@@ -105,7 +130,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         >::type>
         constexpr tuple(tuple<Yn...> const& other)
             : tuple(detail::from_index_sequence_t{},
-                    std::make_index_sequence<sizeof...(Xn)>{},
+                    detail::make_index_sequence<sizeof...(Xn)>{},
                     other.storage_)
         { }
 
@@ -114,7 +139,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         >::type>
         constexpr tuple(tuple<Yn...>&& other)
             : tuple(detail::from_index_sequence_t{},
-                    std::make_index_sequence<sizeof...(Xn)>{},
+                    detail::make_index_sequence<sizeof...(Xn)>{},
                     static_cast<tuple<Yn...>&&>(other).storage_)
         { }
 
@@ -127,7 +152,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         >::type>
         constexpr tuple(tuple const& other)
             : tuple(detail::from_index_sequence_t{},
-                    std::make_index_sequence<sizeof...(Xn)>{},
+                    detail::make_index_sequence<sizeof...(Xn)>{},
                     other.storage_)
         { }
 
@@ -143,7 +168,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         >::type>
         constexpr tuple(tuple&& other)
             : tuple(detail::from_index_sequence_t{},
-                    std::make_index_sequence<sizeof...(Xn)>{},
+                    detail::make_index_sequence<sizeof...(Xn)>{},
                     static_cast<tuple&&>(other).storage_)
         { }
 
@@ -153,7 +178,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         >::type>
         constexpr tuple& operator=(tuple<Yn...> const& other) {
             detail::assign(this->storage_, other.storage_,
-                           std::make_index_sequence<sizeof...(Xn)>{});
+                           detail::make_index_sequence<sizeof...(Xn)>{});
             return *this;
         }
 
@@ -162,7 +187,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         >::type>
         constexpr tuple& operator=(tuple<Yn...>&& other) {
             detail::assign(this->storage_, static_cast<tuple<Yn...>&&>(other).storage_,
-                           std::make_index_sequence<sizeof...(Xn)>{});
+                           detail::make_index_sequence<sizeof...(Xn)>{});
             return *this;
         }
     };
@@ -188,6 +213,28 @@ BOOST_HANA_NAMESPACE_BEGIN
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename ...Xn>
+        struct contiguous_elements<hana::tuple<Xn...>, typename std::enable_if<
+            detail::tuple_storage<Xn...>::contiguous
+        >::type> {
+            using Storage = typename detail::tuple_storage<Xn...>::type;
+
+            static constexpr bool value = true;
+            using value_type = typename Storage::value_type;
+            static constexpr std::size_t size = Storage::size;
+
+            template <typename U>
+            using rebind = hana::tuple<typename std::conditional<true, U, Xn>::type...>;
+
+            static constexpr value_type* data(hana::tuple<Xn...>& xs)
+            { return xs.storage_.elems_; }
+
+            static constexpr value_type const* data(hana::tuple<Xn...> const& xs)
+            { return xs.storage_.elems_; }
+        };
+    }
+
     template <>
     struct unpack_impl<tuple_tag> {
         template <typename F>
@@ -235,7 +282,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         template <typename Xs, typename N>
         static constexpr auto apply(Xs&& xs, N const&) {
             constexpr std::size_t len = decltype(hana::length(xs))::value;
-            return helper<N::value>(static_cast<Xs&&>(xs), std::make_index_sequence<
+            return helper<N::value>(static_cast<Xs&&>(xs), detail::make_index_sequence<
                 N::value < len ? len - N::value : 0
             >{});
         }
@@ -28,7 +28,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename S>
     struct unfold_right_t {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::unfold_right<S> requires 'S' to be a Sequence");
     #endif
 
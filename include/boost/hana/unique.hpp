@@ -28,11 +28,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto unique_t::operator()(Xs&& xs) const {
         using S = typename hana::tag_of<Xs>::type;
         using Unique = BOOST_HANA_DISPATCH_IF(unique_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::unique(xs) requires 'xs' to be a Sequence");
     #endif
 
@@ -43,11 +43,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto unique_t::operator()(Xs&& xs, Predicate&& predicate) const {
         using S = typename hana::tag_of<Xs>::type;
         using Unique = BOOST_HANA_DISPATCH_IF(unique_impl<S>,
-            hana::Sequence<S>::value
+            detail::capabilities<S>::Sequence
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Sequence<S>::value,
+        static_assert(detail::capabilities<S>::Sequence,
         "hana::unique(xs, predicate) requires 'xs' to be a Sequence");
     #endif
 
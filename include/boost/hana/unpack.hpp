@@ -19,6 +19,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/concept/struct.hpp>
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/make_index_sequence.hpp>
 #include <boost/hana/first.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/fwd/fold_left.hpp>
@@ -36,11 +37,11 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr decltype(auto) unpack_t::operator()(Xs&& xs, F&& f) const {
         using S = typename hana::tag_of<Xs>::type;
         using Unpack = BOOST_HANA_DISPATCH_IF(unpack_impl<S>,
-            hana::Foldable<S>::value
+            detail::capabilities<S>::Foldable
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Foldable<S>::value,
+        static_assert(detail::capabilities<S>::Foldable,
         "hana::unpack(xs, f) requires 'xs' to be Foldable");
     #endif
 
@@ -72,7 +73,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
             constexpr std::size_t N = decltype(hana::length(xs))::value;
             return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
-                                 std::make_index_sequence<N>{});
+                                 detail::make_index_sequence<N>{});
         }
     };
 
@@ -88,7 +89,7 @@ BOOST_HANA_NAMESPACE_BEGIN
         static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
             return unpack_impl::unpack_helper(static_cast<Xs&&>(xs),
                                               static_cast<F&&>(f),
-                                              std::make_index_sequence<N>{});
+                                              detail::make_index_sequence<N>{});
         }
     };
 
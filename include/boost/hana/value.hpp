@@ -34,11 +34,11 @@ BOOST_HANA_NAMESPACE_BEGIN
         >::type;
         using C = typename hana::tag_of<RawT>::type;
         using Value = BOOST_HANA_DISPATCH_IF(
-            value_impl<C>, hana::Constant<C>::value
+            value_impl<C>, detail::capabilities<C>::Constant
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Constant<C>::value,
+        static_assert(detail::capabilities<C>::Constant,
         "hana::value<T>() requires 'T' to be a Constant");
     #endif
 
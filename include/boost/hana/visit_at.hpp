@@ -0,0 +1,144 @@
+/*!
+@file
+Defines `boost::hana::visit_at` and `boost::hana::visit_at_unchecked`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_VISIT_AT_HPP
+#define BOOST_HANA_VISIT_AT_HPP
+
+#include <boost/hana/fwd/visit_at.hpp>
+
+#include <boost/hana/at.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/iterable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/length.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace detail {
+        // When `xs` is empty, there is no element to call `f` with, so the
+        // return type is that of `otherwise`, which is always called.
+        template <typename Xs, typename F, typename Otherwise>
+        constexpr decltype(auto)
+        visit_at_checked(hana::true_, Xs&&, std::size_t, F&&, Otherwise&& otherwise)
+        { return static_cast<Otherwise&&>(otherwise)(); }
+
+        template <typename Xs, typename F, typename Otherwise>
+        constexpr decltype(auto)
+        visit_at_checked(hana::false_, Xs&& xs, std::size_t i, F&& f, Otherwise&& otherwise) {
+            using R = decltype(hana::visit_at_unchecked(static_cast<Xs&&>(xs), i,
+                                                        static_cast<F&&>(f)));
+            static_assert(std::is_same<
+                R, decltype(static_cast<Otherwise&&>(otherwise)())
+            >::value,
+            "hana::visit_at(xs, i, f, otherwise) requires 'otherwise' to return "
+            "the same type as 'f'");
+
+            constexpr std::size_t length = decltype(hana::length(xs))::value;
+            if (i < length)
+                return hana::visit_at_unchecked(static_cast<Xs&&>(xs), i, static_cast<F&&>(f));
+            else
+                return static_cast<Otherwise&&>(otherwise)();
+        }
+    }
+
+    //! @cond
+    template <typename Xs, typename F>
+    constexpr decltype(auto)
+    visit_at_unchecked_t::operator()(Xs&& xs, std::size_t i, F&& f) const {
+        using It = typename hana::tag_of<Xs>::type;
+        using VisitAt = BOOST_HANA_DISPATCH_IF(visit_at_impl<It>,
+            detail::capabilities<It>::Iterable && detail::capabilities<It>::Foldable
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(detail::capabilities<It>::Iterable,
+        "hana::visit_at_unchecked(xs, i, f) requires 'xs' to be an Iterable");
+
+        static_assert(detail::capabilities<It>::Foldable,
+        "hana::visit_at_unchecked(xs, i, f) requires 'xs' to be a Foldable");
+    #endif
+
+        return VisitAt::apply(static_cast<Xs&&>(xs), i, static_cast<F&&>(f));
+    }
+
+    template <typename Xs, typename F, typename Otherwise>
+    constexpr decltype(auto)
+    visit_at_t::operator()(Xs&& xs, std::size_t i, F&& f, Otherwise&& otherwise) const {
+        using It = typename hana::tag_of<Xs>::type;
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(detail::capabilities<It>::Iterable,
+        "hana::visit_at(xs, i, f, otherwise) requires 'xs' to be an Iterable");
+
+        static_assert(detail::capabilities<It>::Foldable,
+        "hana::visit_at(xs, i, f, otherwise) requires 'xs' to be a Foldable");
+    #endif
+
+        constexpr std::size_t length = decltype(hana::length(xs))::value;
+        return detail::visit_at_checked(hana::bool_c<length == 0>,
+                                        static_cast<Xs&&>(xs), i,
+                                        static_cast<F&&>(f),
+                                        static_cast<Otherwise&&>(otherwise));
+    }
+    //! @endcond
+
+    namespace detail {
+        template <typename R, typename Xs, typename F, typename Indices>
+        struct visit_at_table;
+
+        template <typename R, typename Xs, typename F, std::size_t ...k>
+        struct visit_at_table<R, Xs, F, std::index_sequence<k...>> {
+            template <std::size_t n>
+            static constexpr R call(Xs&& xs, F&& f) {
+                return static_cast<F&&>(f)(hana::at_c<n>(static_cast<Xs&&>(xs)));
+            }
+
+            using function_pointer = R (*)(Xs&&, F&&);
+            static constexpr function_pointer value[] = {&call<k>...};
+        };
+
+        template <typename R, typename Xs, typename F, std::size_t ...k>
+        constexpr typename visit_at_table<R, Xs, F, std::index_sequence<k...>>::function_pointer
+        visit_at_table<R, Xs, F, std::index_sequence<k...>>::value[];
+    }
+
+    template <typename It, bool condition>
+    struct visit_at_impl<It, when<condition>> : default_ {
+        template <typename Xs, typename F, std::size_t ...k>
+        static constexpr decltype(auto)
+        visit_at_helper(Xs&& xs, std::size_t i, F&& f, std::index_sequence<k...>) {
+            using R = decltype(std::declval<F>()(hana::at_c<0>(std::declval<Xs>())));
+            static_assert(detail::fast_and<std::is_same<
+                R, decltype(std::declval<F>()(hana::at_c<k>(std::declval<Xs>())))
+            >::value...>::value,
+            "hana::visit_at_unchecked(xs, i, f) requires 'f' to return the same type "
+            "for all the elements of 'xs'");
+
+            using Table = detail::visit_at_table<R, Xs, F, std::index_sequence<k...>>;
+            return Table::value[i](static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, std::size_t i, F&& f) {
+            constexpr std::size_t length = decltype(hana::length(xs))::value;
+            static_assert(length != 0,
+            "hana::visit_at_unchecked(xs, i, f) requires 'xs' to be non-empty");
+            return visit_at_helper(static_cast<Xs&&>(xs), i, static_cast<F&&>(f),
+                                   std::make_index_sequence<length>{});
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_VISIT_AT_HPP
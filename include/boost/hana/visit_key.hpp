@@ -0,0 +1,120 @@
+/*!
+@file
+Defines `boost::hana::visit_key`.
+
+@copyright Louis Dionne 2013-2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_VISIT_KEY_HPP
+#define BOOST_HANA_VISIT_KEY_HPP
+
+#include <boost/hana/fwd/visit_key.hpp>
+
+#include <boost/hana/accessors.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/concept/searchable.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/dispatch.hpp>
+#include <boost/hana/detail/perfect_hash.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/second.hpp>
+#include <boost/hana/unpack.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+
+BOOST_HANA_NAMESPACE_BEGIN
+    namespace detail {
+        inline char const* runtime_string_data(char const* s) { return s; }
+
+        inline std::size_t runtime_string_size(char const* s) {
+            std::size_t n = 0;
+            while (s[n] != '\0')
+                ++n;
+            return n;
+        }
+
+        template <typename String>
+        auto runtime_string_data(String const& s) -> decltype(s.data())
+        { return s.data(); }
+
+        template <typename String>
+        auto runtime_string_size(String const& s) -> decltype(s.size())
+        { return s.size(); }
+    }
+
+    //! @cond
+    template <typename Xs, typename Key, typename F, typename Otherwise>
+    decltype(auto) visit_key_t::operator()(Xs&& xs, Key const& key, F&& f, Otherwise&& otherwise) const {
+        using S = typename hana::tag_of<Xs>::type;
+        using VisitKey = BOOST_HANA_DISPATCH_IF(visit_key_impl<S>,
+            detail::capabilities<S>::Searchable
+        );
+
+    #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+        static_assert(detail::capabilities<S>::Searchable,
+        "hana::visit_key(xs, key, f, otherwise) requires 'xs' to be a Searchable");
+    #endif
+
+        return VisitKey::apply(static_cast<Xs&&>(xs),
+                               detail::runtime_string_data(key),
+                               detail::runtime_string_size(key),
+                               static_cast<F&&>(f),
+                               static_cast<Otherwise&&>(otherwise));
+    }
+    //! @endcond
+
+    template <typename S, bool condition>
+    struct visit_key_impl<S, when<condition>> : default_ {
+        template <typename ...Args>
+        static constexpr auto apply(Args&& ...) = delete;
+    };
+
+    template <typename S>
+    struct visit_key_impl<S, when<hana::Struct<S>::value>> {
+        // A Struct without members has no key to find, and no member to
+        // call `f` with.
+        template <typename Accessors, typename Visit, typename Otherwise>
+        static decltype(auto) helper(hana::true_, Accessors const&, char const*,
+                                     std::size_t, Visit&, Otherwise&& otherwise)
+        { return static_cast<Otherwise&&>(otherwise)(); }
+
+        template <typename Accessors, typename Visit, typename Otherwise>
+        static decltype(auto) helper(hana::false_, Accessors const& accessors, char const* key,
+                                     std::size_t length, Visit& visit, Otherwise&& otherwise)
+        {
+            using Hash = decltype(hana::unpack(accessors, detail::perfect_hash_of_keys{}));
+            using Result = decltype(hana::visit_at_unchecked(accessors, 0, visit));
+            static_assert(std::is_same<
+                Result, decltype(static_cast<Otherwise&&>(otherwise)())
+            >::value,
+            "hana::visit_key(xs, key, f, otherwise) requires 'otherwise' to "
+            "return the same type as 'f'");
+
+            std::size_t const index = Hash::find(key, length);
+            if (index == Hash::N)
+                return static_cast<Otherwise&&>(otherwise)();
+            return hana::visit_at_unchecked(accessors, index, visit);
+        }
+
+        template <typename X, typename F, typename Otherwise>
+        static decltype(auto) apply(X&& x, char const* key, std::size_t length,
+                                    F&& f, Otherwise&& otherwise)
+        {
+            auto accessors = hana::accessors<S>();
+            auto visit = [&](auto const& accessor) -> decltype(auto) {
+                return static_cast<F&&>(f)(hana::second(accessor)(static_cast<X&&>(x)));
+            };
+            constexpr bool empty = decltype(hana::length(accessors))::value == 0;
+            return helper(hana::bool_c<empty>, accessors, key, length, visit,
+                          static_cast<Otherwise&&>(otherwise));
+        }
+    };
+BOOST_HANA_NAMESPACE_END
+
+#endif // !BOOST_HANA_VISIT_KEY_HPP
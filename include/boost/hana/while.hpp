@@ -31,11 +31,11 @@ BOOST_HANA_NAMESPACE_BEGIN
         using Cond = decltype(pred(state));
         using Bool = typename hana::tag_of<Cond>::type;
         using While = BOOST_HANA_DISPATCH_IF(while_impl<Bool>,
-            hana::Logical<Bool>::value
+            detail::capabilities<Bool>::Logical
         );
 
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Logical<Bool>::value,
+        static_assert(detail::capabilities<Bool>::Logical,
         "hana::while_(pred, state, f) requires 'pred(state)' to be a Logical");
     #endif
 
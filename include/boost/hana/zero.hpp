@@ -26,13 +26,13 @@ BOOST_HANA_NAMESPACE_BEGIN
     template <typename M>
     struct zero_t {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
-        static_assert(hana::Monoid<M>::value,
+        static_assert(detail::capabilities<M>::Monoid,
         "hana::zero<M>() requires 'M' to be a Monoid");
     #endif
 
         constexpr decltype(auto) operator()() const {
             using Zero = BOOST_HANA_DISPATCH_IF(zero_impl<M>,
-                hana::Monoid<M>::value
+                detail::capabilities<M>::Monoid
             );
 
             return Zero::apply();
@@ -26,7 +26,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     constexpr auto zip_t::operator()(Xs&& xs, Ys&& ...ys) const {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
         static_assert(detail::fast_and<
-            hana::Sequence<Xs>::value, hana::Sequence<Ys>::value...
+            detail::capabilities_of<Xs>::Sequence, detail::capabilities_of<Ys>::Sequence...
         >::value,
         "hana::zip(xs, ys...) requires 'xs' and 'ys...' to be Sequences");
     #endif
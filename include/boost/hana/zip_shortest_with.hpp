@@ -32,7 +32,7 @@ BOOST_HANA_NAMESPACE_BEGIN
     zip_shortest_with_t::operator()(F&& f, Xs&& xs, Ys&& ...ys) const {
     #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
         static_assert(detail::fast_and<
-            hana::Sequence<Xs>::value, hana::Sequence<Ys>::value...
+            detail::capabilities_of<Xs>::Sequence, detail::capabilities_of<Ys>::Sequence...
         >::value,
         "hana::zip_shortest_with(f, xs, ys...) requires 'xs' and 'ys...' to be Sequences");
     #endif
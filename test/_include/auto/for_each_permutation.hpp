@@ -0,0 +1,75 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_FOR_EACH_PERMUTATION_HPP
+#define BOOST_HANA_TEST_AUTO_FOR_EACH_PERMUTATION_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/for_each_permutation.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include "test_case.hpp"
+
+#include <vector>
+
+
+namespace for_each_permutation_test {
+    struct f {
+        template <typename P>
+        constexpr void operator()(P const&) const { }
+    };
+}
+
+TestCase test_for_each_permutation{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+
+    // Make sure the permutations are visited in lexicographical order
+    {
+        auto check = [](auto xs, std::vector<std::vector<int>> expected) {
+            std::vector<std::vector<int>> seen{};
+            hana::for_each_permutation(xs, [&](auto perm) {
+                hana::unpack(perm, [&](auto ...x) {
+                    seen.push_back(std::vector<int>{x...});
+                });
+            });
+            BOOST_HANA_RUNTIME_CHECK(seen == expected);
+        };
+
+        check(MAKE_TUPLE(), {{}});
+        check(MAKE_TUPLE(0), {{0}});
+        check(MAKE_TUPLE(0, 1), {{0, 1}, {1, 0}});
+        check(MAKE_TUPLE(0, 1, 2), {
+            {0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}
+        });
+    }
+
+    // Make sure it works with heterogeneous sequences
+    {
+        int calls = 0;
+        hana::for_each_permutation(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{}),
+        [&](auto perm) {
+            ++calls;
+            BOOST_HANA_CONSTANT_CHECK(hana::equal(
+                hana::unpack(perm, [](auto ...x) { return MAKE_TUPLE(x...); }),
+                perm
+            ));
+        });
+        BOOST_HANA_RUNTIME_CHECK(calls == 24);
+    }
+
+    // Make sure for_each_permutation is constexpr when used with a constexpr
+    // function and constexpr arguments.
+#ifndef MAKE_TUPLE_NO_CONSTEXPR
+    {
+        constexpr int i = (hana::for_each_permutation(
+            MAKE_TUPLE(1, 2, 3), for_each_permutation_test::f{}), 0);
+        (void)i;
+    }
+#endif
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_FOR_EACH_PERMUTATION_HPP
@@ -0,0 +1,81 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_FOR_EACH_PRODUCT_HPP
+#define BOOST_HANA_TEST_AUTO_FOR_EACH_PRODUCT_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/for_each_product.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include "test_case.hpp"
+
+#include <vector>
+
+
+namespace for_each_product_test {
+    struct f {
+        template <typename X>
+        constexpr void operator()(X const&) const { }
+    };
+}
+
+TestCase test_for_each_product{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+
+    // Make sure the product is visited in the order of `cartesian_product`
+    {
+        auto check = [](auto xs, std::vector<std::vector<int>> expected) {
+            std::vector<std::vector<int>> seen{};
+            hana::for_each_product(xs, [&](auto product) {
+                hana::unpack(product, [&](auto ...x) {
+                    seen.push_back(std::vector<int>{x...});
+                });
+            });
+            BOOST_HANA_RUNTIME_CHECK(seen == expected);
+        };
+
+        check(MAKE_TUPLE(MAKE_TUPLE(0)), {{0}});
+        check(MAKE_TUPLE(MAKE_TUPLE(0, 1)), {{0}, {1}});
+        check(MAKE_TUPLE(MAKE_TUPLE(0, 1), MAKE_TUPLE(2)), {{0, 2}, {1, 2}});
+        check(MAKE_TUPLE(MAKE_TUPLE(0, 1), MAKE_TUPLE(2, 3, 4)), {
+            {0, 2}, {0, 3}, {0, 4}, {1, 2}, {1, 3}, {1, 4}
+        });
+        check(MAKE_TUPLE(MAKE_TUPLE(0, 1), MAKE_TUPLE(2), MAKE_TUPLE(3, 4)), {
+            {0, 2, 3}, {0, 2, 4}, {1, 2, 3}, {1, 2, 4}
+        });
+    }
+
+    // Make sure the function is never called when the product is empty
+    {
+        struct undefined { };
+        hana::for_each_product(MAKE_TUPLE(), undefined{});
+        hana::for_each_product(MAKE_TUPLE(MAKE_TUPLE()), undefined{});
+        hana::for_each_product(MAKE_TUPLE(MAKE_TUPLE(ct_eq<0>{}), MAKE_TUPLE()), undefined{});
+    }
+
+    // Make sure it works with heterogeneous sequences
+    {
+        int calls = 0;
+        hana::for_each_product(MAKE_TUPLE(
+            MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}),
+            MAKE_TUPLE(ct_eq<2>{}, ct_eq<3>{}, ct_eq<4>{})
+        ), [&](auto) { ++calls; });
+        BOOST_HANA_RUNTIME_CHECK(calls == 6);
+    }
+
+    // Make sure for_each_product is constexpr when used with a constexpr
+    // function and constexpr arguments.
+#ifndef MAKE_TUPLE_NO_CONSTEXPR
+    {
+        constexpr int i = (hana::for_each_product(
+            MAKE_TUPLE(MAKE_TUPLE(1, 2), MAKE_TUPLE(3, 4)), for_each_product_test::f{}), 0);
+        (void)i;
+    }
+#endif
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_FOR_EACH_PRODUCT_HPP
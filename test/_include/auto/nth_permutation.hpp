@@ -0,0 +1,89 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_NTH_PERMUTATION_HPP
+#define BOOST_HANA_TEST_AUTO_NTH_PERMUTATION_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/nth_permutation.hpp>
+#include <boost/hana/permutations.hpp>
+
+#include <laws/base.hpp>
+#include "test_case.hpp"
+
+
+TestCase test_nth_permutation{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::nth_permutation<0>(MAKE_TUPLE()),
+        MAKE_TUPLE()
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::nth_permutation<0>(MAKE_TUPLE(ct_eq<0>{})),
+        MAKE_TUPLE(ct_eq<0>{})
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::nth_permutation<0>(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{})),
+        MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{})
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::nth_permutation<1>(MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{})),
+        MAKE_TUPLE(ct_eq<1>{}, ct_eq<0>{})
+    ));
+
+    // Permutations are in lexicographical order of the indices
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<0>(xs),
+            MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<1>(xs),
+            MAKE_TUPLE(ct_eq<0>{}, ct_eq<2>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<2>(xs),
+            MAKE_TUPLE(ct_eq<1>{}, ct_eq<0>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<3>(xs),
+            MAKE_TUPLE(ct_eq<1>{}, ct_eq<2>{}, ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<4>(xs),
+            MAKE_TUPLE(ct_eq<2>{}, ct_eq<0>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<5>(xs),
+            MAKE_TUPLE(ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+    }
+
+    // Make sure the order matches that of `permutations`
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{});
+        auto perms = hana::permutations(xs);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<0>(xs), hana::at_c<0>(perms)));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<7>(xs), hana::at_c<7>(perms)));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<13>(xs), hana::at_c<13>(perms)));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<22>(xs), hana::at_c<22>(perms)));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::nth_permutation<23>(xs),
+            MAKE_TUPLE(ct_eq<3>{}, ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+    }
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_NTH_PERMUTATION_HPP
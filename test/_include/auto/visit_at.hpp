@@ -0,0 +1,103 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HANA_TEST_AUTO_VISIT_AT_HPP
+#define BOOST_HANA_TEST_AUTO_VISIT_AT_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include "test_case.hpp"
+#include <laws/base.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+TestCase test_visit_at{[]{
+    namespace hana = boost::hana;
+    using hana::test::ct_eq;
+
+    auto to_int = [](auto x) { return static_cast<int>(x); };
+    auto out_of_bounds = [] { return -1; };
+
+    // Make sure the element at the given index is visited
+    {
+        auto xs = MAKE_TUPLE(0, '\1', 2.0, 3L);
+        for (std::size_t i = 0; i != 4; ++i) {
+            BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, i, to_int, out_of_bounds) == static_cast<int>(i));
+            BOOST_HANA_RUNTIME_CHECK(hana::visit_at_unchecked(xs, i, to_int) == static_cast<int>(i));
+        }
+
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(MAKE_TUPLE(0), 0, to_int, out_of_bounds) == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at_unchecked(MAKE_TUPLE(0), 0, to_int) == 0);
+    }
+
+    // Make sure `otherwise` is called when the index is out of bounds
+    {
+        auto xs = MAKE_TUPLE(0, '\1', 2.0);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 3, to_int, out_of_bounds) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 1000, to_int, out_of_bounds) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, static_cast<std::size_t>(-1), to_int, out_of_bounds) == -1);
+    }
+
+    // Make sure `otherwise` is always called when the sequence is empty,
+    // even though `f` could not be called with any element
+    {
+        auto f = [](auto) -> void {};
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(MAKE_TUPLE(), 0, f, out_of_bounds) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(MAKE_TUPLE(), 1, f, out_of_bounds) == -1);
+    }
+
+    // Make sure it works with heterogeneous sequences
+    {
+        auto xs = MAKE_TUPLE(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto f = [](auto x) {
+            return hana::equal(x, ct_eq<0>{}) ? 0 :
+                   hana::equal(x, ct_eq<1>{}) ? 1 : 2;
+        };
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 0, f, out_of_bounds) == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 1, f, out_of_bounds) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 2, f, out_of_bounds) == 2);
+    }
+
+    // Make sure the elements are passed as returned by `at`, and that
+    // references can be returned
+    {
+        auto xs = MAKE_TUPLE(0, 1, 2);
+        int& x1 = hana::visit_at_unchecked(xs, 1, [](int& x) -> int& { return x; });
+        x1 = 10;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(xs) == 10);
+
+        auto is_rvalue = [](auto&& x) {
+            return std::is_rvalue_reference<decltype(x)>::value;
+        };
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::visit_at_unchecked(xs, 0, is_rvalue) ==
+            is_rvalue(hana::at_c<0>(xs))
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::visit_at_unchecked(std::move(xs), 0, is_rvalue) ==
+            is_rvalue(hana::at_c<0>(std::move(xs)))
+        );
+    }
+
+    // Make sure visit_at is constexpr when used with a constexpr function
+    // and constexpr arguments.
+#ifndef MAKE_TUPLE_NO_CONSTEXPR
+    {
+        struct f { constexpr int operator()(int x) const { return x; } };
+        struct otherwise { constexpr int operator()() const { return -1; } };
+        static_assert(hana::visit_at_unchecked(MAKE_TUPLE(0, 1, 2), 1, f{}) == 1, "");
+        static_assert(hana::visit_at(MAKE_TUPLE(0, 1, 2), 2, f{}, otherwise{}) == 2, "");
+        static_assert(hana::visit_at(MAKE_TUPLE(0, 1, 2), 3, f{}, otherwise{}) == -1, "");
+        static_assert(hana::visit_at(MAKE_TUPLE(), 0, f{}, otherwise{}) == -1, "");
+    }
+#endif
+}};
+
+#endif // !BOOST_HANA_TEST_AUTO_VISIT_AT_HPP
@@ -0,0 +1,69 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/visit_key.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (std::string, last_name),
+        (int, age)
+    );
+};
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+int main() {
+    auto to_string = hana::overload(
+        [](std::string const& s) { return s; },
+        [](int i) { return std::to_string(i); }
+    );
+    auto not_found = [] { return std::string{"?"}; };
+
+    // lookup
+    {
+        Person john{"John", "Doe", 30};
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(john, "name", to_string, not_found) == "John");
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(john, "last_name", to_string, not_found) == "Doe");
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(john, "age", to_string, not_found) == "30");
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(john, std::string{"age"}, to_string, not_found) == "30");
+
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(john, "", to_string, not_found) == "?");
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(john, "nam", to_string, not_found) == "?");
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(john, "names", to_string, not_found) == "?");
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(john, "Age", to_string, not_found) == "?");
+    }
+
+    // the members are passed by reference
+    {
+        Person john{"John", "Doe", 30};
+        auto set_age = hana::overload(
+            [](int& age) { age = 31; return true; },
+            [](std::string&) { return false; }
+        );
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(john, "age", set_age, [] { return false; }));
+        BOOST_HANA_RUNTIME_CHECK(john.age == 31);
+        BOOST_HANA_RUNTIME_CHECK(!hana::visit_key(john, "name", set_age, [] { return false; }));
+        BOOST_HANA_RUNTIME_CHECK(john.name == "John");
+
+        Person const& cjohn = john;
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(cjohn, "name", to_string, not_found) == "John");
+    }
+
+    // no members
+    {
+        Empty empty{};
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(empty, "", to_string, not_found) == "?");
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(empty, "name", to_string, not_found) == "?");
+    }
+}
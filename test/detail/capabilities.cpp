@@ -0,0 +1,46 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/capabilities.hpp>
+
+#include <boost/hana/concept/comparable.hpp>
+#include <boost/hana/concept/foldable.hpp>
+#include <boost/hana/concept/integral_constant.hpp>
+#include <boost/hana/concept/sequence.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+struct undefined { };
+
+int main() {
+    using Tuple = hana::detail::capabilities<hana::tuple_tag>;
+    static_assert(Tuple::Sequence, "");
+    static_assert(Tuple::Foldable, "");
+    static_assert(Tuple::Comparable, "");
+    static_assert(!Tuple::IntegralConstant, "");
+
+    using Int = hana::detail::capabilities<hana::integral_constant_tag<int>>;
+    static_assert(Int::IntegralConstant, "");
+    static_assert(Int::Comparable, "");
+    static_assert(!Int::Sequence, "");
+    static_assert(!Int::Foldable, "");
+
+    using Undefined = hana::detail::capabilities<undefined>;
+    static_assert(!Undefined::Sequence, "");
+    static_assert(!Undefined::Foldable, "");
+
+    // The record of a type is the record of its tag
+    static_assert(std::is_same<
+        hana::detail::capabilities_of<hana::tuple<int, char>>,
+        hana::detail::capabilities<hana::tuple_tag>
+    >{}, "");
+    static_assert(std::is_same<
+        hana::detail::capabilities_of<hana::int_<1>>,
+        hana::detail::capabilities<hana::integral_constant_tag<int>>
+    >{}, "");
+}
@@ -0,0 +1,32 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/make_index_sequence.hpp>
+
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+static_assert(std::is_same<
+    hana::detail::make_index_sequence<0>,
+    std::index_sequence<>
+>{}, "");
+
+static_assert(std::is_same<
+    hana::detail::make_index_sequence<1>,
+    std::index_sequence<0>
+>{}, "");
+
+static_assert(std::is_same<
+    hana::detail::make_index_sequence<4>,
+    std::index_sequence<0, 1, 2, 3>
+>{}, "");
+
+static_assert(std::is_same<
+    hana::detail::make_index_sequence<1000>,
+    std::make_index_sequence<1000>
+>{}, "");
+
+int main() { }
@@ -0,0 +1,58 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/perfect_hash.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/string.hpp>
+
+#include <cstddef>
+#include <string>
+namespace hana = boost::hana;
+
+
+template <int i>
+using key = hana::string<'k', 'e', 'y', static_cast<char>('0' + i / 10), static_cast<char>('0' + i % 10)>;
+
+template <typename Hash>
+std::size_t find(std::string const& s) {
+    return Hash::find(s.data(), s.size());
+}
+
+int main() {
+    // The table can be queried at compile-time
+    {
+        using Hash = hana::detail::string_perfect_hash<
+            hana::string<'a'>, hana::string<>, hana::string<'a', 'b'>
+        >;
+        static_assert(Hash::N == 3, "");
+        static_assert(Hash::find("a", 1) == 0, "");
+        static_assert(Hash::find("", 0) == 1, "");
+        static_assert(Hash::find("ab", 2) == 2, "");
+        static_assert(Hash::find("b", 1) == 3, "");
+        static_assert(Hash::find("abc", 3) == 3, "");
+    }
+
+    // Every key is found at its own index, and other strings are not found
+    {
+        using Hash = hana::detail::string_perfect_hash<
+            key<0>, key<1>, key<2>, key<3>, key<4>, key<5>, key<6>, key<7>,
+            key<8>, key<9>, key<10>, key<11>, key<12>, key<13>, key<14>, key<15>,
+            key<16>, key<17>, key<18>, key<19>, key<20>, key<21>, key<22>, key<23>,
+            key<24>, key<25>, key<26>, key<27>, key<28>, key<29>, key<30>, key<31>,
+            key<32>
+        >;
+        for (int i = 0; i != 33; ++i) {
+            std::string k = "key" + std::to_string(i / 10) + std::to_string(i % 10);
+            BOOST_HANA_RUNTIME_CHECK(find<Hash>(k) == static_cast<std::size_t>(i));
+        }
+        for (int i = 33; i != 100; ++i) {
+            std::string k = "key" + std::to_string(i / 10) + std::to_string(i % 10);
+            BOOST_HANA_RUNTIME_CHECK(find<Hash>(k) == Hash::N);
+        }
+        BOOST_HANA_RUNTIME_CHECK(find<Hash>("key") == Hash::N);
+        BOOST_HANA_RUNTIME_CHECK(find<Hash>("key000") == Hash::N);
+        BOOST_HANA_RUNTIME_CHECK(find<Hash>("") == Hash::N);
+    }
+}
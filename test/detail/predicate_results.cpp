@@ -0,0 +1,74 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/predicate_results.hpp>
+
+#include <boost/hana/bool.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+struct x { };
+
+struct is_even {
+    template <int i>
+    constexpr auto operator()(x<i> const&) const
+    { return hana::bool_c<i % 2 == 0>; }
+};
+
+using MakeResults = hana::detail::make_predicate_results<is_even>;
+
+int main() {
+    {
+        using R = decltype(MakeResults{}());
+        static_assert(R::size == 0, "");
+        static_assert(R::first_satisfied == 0, "");
+        static_assert(R::first_unsatisfied == 0, "");
+        static_assert(R::count == 0, "");
+        static_assert(R::indices<true>.size() == 0, "");
+        static_assert(R::indices<false>.size() == 0, "");
+    }
+
+    {
+        using R = decltype(MakeResults{}(x<0>{}));
+        static_assert(R::size == 1, "");
+        static_assert(R::first_satisfied == 0, "");
+        static_assert(R::first_unsatisfied == 1, "");
+        static_assert(R::count == 1, "");
+        static_assert(R::indices<true>[0] == 0, "");
+        static_assert(R::indices<false>.size() == 0, "");
+    }
+
+    {
+        using R = decltype(MakeResults{}(x<1>{}));
+        static_assert(R::first_satisfied == 1, "");
+        static_assert(R::first_unsatisfied == 0, "");
+        static_assert(R::count == 0, "");
+        static_assert(R::indices<false>[0] == 0, "");
+    }
+
+    {
+        using R = decltype(MakeResults{}(x<1>{}, x<3>{}, x<4>{}, x<6>{}, x<7>{}));
+        static_assert(R::size == 5, "");
+        static_assert(R::first_satisfied == 2, "");
+        static_assert(R::first_unsatisfied == 0, "");
+        static_assert(R::count == 2, "");
+
+        static_assert(R::indices<true>.size() == 2, "");
+        static_assert(R::indices<true>[0] == 2, "");
+        static_assert(R::indices<true>[1] == 3, "");
+
+        static_assert(R::indices<false>.size() == 3, "");
+        static_assert(R::indices<false>[0] == 0, "");
+        static_assert(R::indices<false>[1] == 1, "");
+        static_assert(R::indices<false>[2] == 4, "");
+    }
+
+    {
+        using R = decltype(MakeResults{}(x<0>{}, x<2>{}, x<5>{}, x<8>{}));
+        static_assert(R::first_satisfied == 0, "");
+        static_assert(R::first_unsatisfied == 2, "");
+        static_assert(R::count == 3, "");
+    }
+}
@@ -0,0 +1,28 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/detail/type_at.hpp>
+
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <int>
+struct x;
+
+static_assert(std::is_same<hana::detail::type_at<0, x<0>>, x<0>>{}, "");
+
+static_assert(std::is_same<hana::detail::type_at<0, x<0>, x<1>, x<2>>, x<0>>{}, "");
+static_assert(std::is_same<hana::detail::type_at<1, x<0>, x<1>, x<2>>, x<1>>{}, "");
+static_assert(std::is_same<hana::detail::type_at<2, x<0>, x<1>, x<2>>, x<2>>{}, "");
+
+// The same type may appear several times in the pack
+static_assert(std::is_same<hana::detail::type_at<1, x<0>, x<0>, x<1>>, x<0>>{}, "");
+static_assert(std::is_same<hana::detail::type_at<2, x<0>, x<0>, x<1>>, x<1>>{}, "");
+
+// References and cv-qualifiers are preserved
+static_assert(std::is_same<hana::detail::type_at<0, x<0>&, x<1> const>, x<0>&>{}, "");
+static_assert(std::is_same<hana::detail::type_at<1, x<0>&, x<1> const>, x<1> const>{}, "");
+
+int main() { }
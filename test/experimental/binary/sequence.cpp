@@ -0,0 +1,87 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/experimental/binary.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/ext/std/tuple.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <cstring>
+#include <tuple>
+namespace hana = boost::hana;
+
+
+template <typename T>
+void put(char*& out, T const& t) {
+    std::memcpy(out, &t, sizeof(T));
+    out += sizeof(T);
+}
+
+template <std::size_t N>
+bool equal_bytes(char const (&actual)[N], char const (&expected)[N]) {
+    return std::memcmp(actual, expected, N) == 0;
+}
+
+int main() {
+    // Empty elements are not encoded
+    {
+        using Tuple = hana::tuple<int, hana::int_<3>, char, hana::tuple<>, double>;
+        static_assert(hana::experimental::binary_size<Tuple> ==
+            sizeof(int) + sizeof(char) + sizeof(double), "");
+
+        Tuple tuple{1, {}, 'x', {}, 2.5};
+        char buffer[hana::experimental::binary_size<Tuple>];
+        char* end = hana::experimental::binary_encode(tuple, buffer);
+        BOOST_HANA_RUNTIME_CHECK(end == buffer + sizeof(buffer));
+
+        char expected[sizeof(buffer)];
+        char* out = expected;
+        put(out, 1); put(out, 'x'); put(out, 2.5);
+        BOOST_HANA_RUNTIME_CHECK(equal_bytes(buffer, expected));
+
+        Tuple decoded{};
+        hana::experimental::binary_decode(buffer, decoded);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(decoded) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<2>(decoded) == 'x');
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<4>(decoded) == 2.5);
+    }
+
+    // Sequences are encoded recursively, whatever their layout
+    {
+        using Tuple = hana::tuple<std::array<short, 3>, std::tuple<char, int>, hana::tuple<double>>;
+        static_assert(hana::experimental::binary_size<Tuple> ==
+            3 * sizeof(short) + sizeof(char) + sizeof(int) + sizeof(double), "");
+
+        Tuple tuple{{{1, 2, 3}}, std::tuple<char, int>{'x', 4}, hana::make_tuple(5.5)};
+        char buffer[hana::experimental::binary_size<Tuple>];
+        hana::experimental::binary_encode(tuple, buffer);
+
+        char expected[sizeof(buffer)];
+        char* out = expected;
+        put(out, short{1}); put(out, short{2}); put(out, short{3});
+        put(out, 'x'); put(out, 4); put(out, 5.5);
+        BOOST_HANA_RUNTIME_CHECK(equal_bytes(buffer, expected));
+
+        Tuple decoded{};
+        hana::experimental::binary_decode(buffer, decoded);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(decoded)[2] == 3);
+        BOOST_HANA_RUNTIME_CHECK(std::get<0>(hana::at_c<1>(decoded)) == 'x');
+        BOOST_HANA_RUNTIME_CHECK(std::get<1>(hana::at_c<1>(decoded)) == 4);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(hana::at_c<2>(decoded)) == 5.5);
+    }
+
+    // Trivially copyable objects are encoded as they are
+    {
+        static_assert(hana::experimental::binary_size<long> == sizeof(long), "");
+        char buffer[sizeof(long)];
+        hana::experimental::binary_encode(42l, buffer);
+        long decoded = 0;
+        hana::experimental::binary_decode(buffer, decoded);
+        BOOST_HANA_RUNTIME_CHECK(decoded == 42l);
+    }
+}
@@ -0,0 +1,117 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/binary.hpp>
+
+#include <cstring>
+namespace hana = boost::hana;
+
+
+struct Padded {
+    BOOST_HANA_DEFINE_STRUCT(Padded,
+        (char, a),
+        (int, b),
+        (int, c),
+        (char, d),
+        (char, e),
+        (double, f)
+    );
+};
+
+struct Nested {
+    BOOST_HANA_DEFINE_STRUCT(Nested,
+        (short, head),
+        (Padded, padded),
+        (short, tail)
+    );
+};
+
+// `hidden` is not part of the encoding, and the members are not reflected
+// in the order in which they are declared.
+struct Adapted {
+    int x;
+    int hidden;
+    char y;
+    double z;
+};
+
+BOOST_HANA_ADAPT_STRUCT(Adapted, z, y, x);
+
+template <typename T>
+void put(char*& out, T const& t) {
+    std::memcpy(out, &t, sizeof(T));
+    out += sizeof(T);
+}
+
+template <std::size_t N>
+bool equal_bytes(char const (&actual)[N], char const (&expected)[N]) {
+    return std::memcmp(actual, expected, N) == 0;
+}
+
+int main() {
+    static_assert(hana::experimental::binary_size<Padded> ==
+        3 * sizeof(char) + 2 * sizeof(int) + sizeof(double), "");
+    static_assert(hana::experimental::binary_size<Nested> ==
+        2 * sizeof(short) + hana::experimental::binary_size<Padded>, "");
+    static_assert(hana::experimental::binary_size<Adapted> ==
+        sizeof(double) + sizeof(char) + sizeof(int), "");
+
+    // The members are written without padding, in the order of the accessors
+    {
+        Padded padded{'a', 1, 2, 'd', 'e', 3.5};
+        char buffer[hana::experimental::binary_size<Padded>];
+        char* end = hana::experimental::binary_encode(padded, buffer);
+        BOOST_HANA_RUNTIME_CHECK(end == buffer + sizeof(buffer));
+
+        char expected[sizeof(buffer)];
+        char* out = expected;
+        put(out, 'a'); put(out, 1); put(out, 2); put(out, 'd'); put(out, 'e'); put(out, 3.5);
+        BOOST_HANA_RUNTIME_CHECK(equal_bytes(buffer, expected));
+
+        Padded decoded{};
+        char const* in_end = hana::experimental::binary_decode(buffer, decoded);
+        BOOST_HANA_RUNTIME_CHECK(in_end == buffer + sizeof(buffer));
+        BOOST_HANA_RUNTIME_CHECK(decoded.a == 'a' && decoded.b == 1 && decoded.c == 2);
+        BOOST_HANA_RUNTIME_CHECK(decoded.d == 'd' && decoded.e == 'e' && decoded.f == 3.5);
+    }
+
+    // Nested Structs are encoded recursively
+    {
+        Nested nested{7, {'a', 1, 2, 'd', 'e', 3.5}, 8};
+        char buffer[hana::experimental::binary_size<Nested>];
+        hana::experimental::binary_encode(nested, buffer);
+
+        char expected[sizeof(buffer)];
+        char* out = expected;
+        put(out, short{7});
+        put(out, 'a'); put(out, 1); put(out, 2); put(out, 'd'); put(out, 'e'); put(out, 3.5);
+        put(out, short{8});
+        BOOST_HANA_RUNTIME_CHECK(equal_bytes(buffer, expected));
+
+        Nested decoded{};
+        hana::experimental::binary_decode(buffer, decoded);
+        BOOST_HANA_RUNTIME_CHECK(decoded.head == 7 && decoded.tail == 8);
+        BOOST_HANA_RUNTIME_CHECK(decoded.padded.b == 1 && decoded.padded.f == 3.5);
+    }
+
+    // Structs whose layout does not follow their accessors
+    {
+        Adapted adapted{1, 99, 'y', 2.5};
+        char buffer[hana::experimental::binary_size<Adapted>];
+        hana::experimental::binary_encode(adapted, buffer);
+
+        char expected[sizeof(buffer)];
+        char* out = expected;
+        put(out, 2.5); put(out, 'y'); put(out, 1);
+        BOOST_HANA_RUNTIME_CHECK(equal_bytes(buffer, expected));
+
+        Adapted decoded{0, 42, '\0', 0.0};
+        hana::experimental::binary_decode(buffer, decoded);
+        BOOST_HANA_RUNTIME_CHECK(decoded.x == 1 && decoded.y == 'y' && decoded.z == 2.5);
+        BOOST_HANA_RUNTIME_CHECK(decoded.hidden == 42);
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/format.hpp>
+
+#include <cstdio>
+#include <limits>
+#include <string>
+namespace hana = boost::hana;
+using hana::experimental::format;
+
+
+std::string printf_format(double x) {
+    char buffer[512];
+    int n = std::snprintf(buffer, sizeof(buffer), x < 1e15 && x > -1e15 ? "%f" : "%e", x);
+    return std::string(buffer, static_cast<std::size_t>(n));
+}
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(format(0.0) == "0.000000");
+    BOOST_HANA_RUNTIME_CHECK(format(-0.0) == "-0.000000");
+    BOOST_HANA_RUNTIME_CHECK(format(1.5) == "1.500000");
+    BOOST_HANA_RUNTIME_CHECK(format(-2.25f) == "-2.250000");
+    BOOST_HANA_RUNTIME_CHECK(format(0.1f) == "0.100000");
+    BOOST_HANA_RUNTIME_CHECK(format(0.0000004) == "0.000000");
+    BOOST_HANA_RUNTIME_CHECK(format(0.0000006) == "0.000001");
+    BOOST_HANA_RUNTIME_CHECK(format(0.9999996) == "1.000000");
+    BOOST_HANA_RUNTIME_CHECK(format(1e20) == "1.000000e+20");
+    BOOST_HANA_RUNTIME_CHECK(format(-1.5e300) == "-1.500000e+300");
+
+    double const inf = std::numeric_limits<double>::infinity();
+    BOOST_HANA_RUNTIME_CHECK(format(inf) == "inf");
+    BOOST_HANA_RUNTIME_CHECK(format(-inf) == "-inf");
+    BOOST_HANA_RUNTIME_CHECK(format(std::numeric_limits<double>::quiet_NaN()) == "nan");
+
+    // same as printf, including ties which are rounded to even
+    double const values[] = {
+        0.5, 0.0000005, 0.0000015, 0.0000025, 3.14159265358979, 123456.789,
+        491702.6953125, 99999999999999.99, 1e15, 9.9999999e20,
+        std::numeric_limits<double>::max(), std::numeric_limits<double>::min(),
+        std::numeric_limits<double>::denorm_min()
+    };
+    for (double x : values) {
+        BOOST_HANA_RUNTIME_CHECK(format(x) == printf_format(x));
+        BOOST_HANA_RUNTIME_CHECK(format(-x) == printf_format(-x));
+        BOOST_HANA_RUNTIME_CHECK(format(x).size() <= hana::experimental::max_formatted_size<double>);
+    }
+
+    // the largest output
+    BOOST_HANA_RUNTIME_CHECK(format(-999999999999999.9).size() ==
+                             hana::experimental::max_formatted_size<double>);
+}
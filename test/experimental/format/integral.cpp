@@ -0,0 +1,61 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/format.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+namespace hana = boost::hana;
+using hana::experimental::format;
+
+
+template <typename T>
+void check_limits() {
+    BOOST_HANA_RUNTIME_CHECK(format(std::numeric_limits<T>::max()) ==
+                             std::to_string(std::numeric_limits<T>::max()));
+    BOOST_HANA_RUNTIME_CHECK(format(std::numeric_limits<T>::min()) ==
+                             std::to_string(std::numeric_limits<T>::min()));
+    BOOST_HANA_RUNTIME_CHECK(format(std::numeric_limits<T>::max()).size() <=
+                             hana::experimental::max_formatted_size<T>);
+    BOOST_HANA_RUNTIME_CHECK(format(std::numeric_limits<T>::min()).size() <=
+                             hana::experimental::max_formatted_size<T>);
+}
+
+int main() {
+    BOOST_HANA_RUNTIME_CHECK(format(0) == "0");
+    BOOST_HANA_RUNTIME_CHECK(format(7) == "7");
+    BOOST_HANA_RUNTIME_CHECK(format(-7) == "-7");
+    BOOST_HANA_RUNTIME_CHECK(format(10) == "10");
+    BOOST_HANA_RUNTIME_CHECK(format(99) == "99");
+    BOOST_HANA_RUNTIME_CHECK(format(100) == "100");
+    BOOST_HANA_RUNTIME_CHECK(format(-1234567) == "-1234567");
+    BOOST_HANA_RUNTIME_CHECK(format(1000000000u) == "1000000000");
+
+    // every number of digits
+    std::uint64_t x = 1;
+    for (int digits = 1; digits <= 19; ++digits, x *= 10) {
+        BOOST_HANA_RUNTIME_CHECK(format(x) == std::to_string(x));
+        BOOST_HANA_RUNTIME_CHECK(format(x - 1) == std::to_string(x - 1));
+        BOOST_HANA_RUNTIME_CHECK(format(x + 1) == std::to_string(x + 1));
+    }
+
+    check_limits<int>();
+    check_limits<unsigned>();
+    check_limits<short>();
+    check_limits<unsigned short>();
+    check_limits<long>();
+    check_limits<unsigned long>();
+    check_limits<long long>();
+    check_limits<unsigned long long>();
+    check_limits<std::int8_t>();
+    check_limits<std::uint8_t>();
+
+    // characters and bools are not numbers
+    BOOST_HANA_RUNTIME_CHECK(format('x') == "x");
+    BOOST_HANA_RUNTIME_CHECK(format(true, false) == "truefalse");
+    static_assert(hana::experimental::max_formatted_size<char, bool> == 6, "");
+}
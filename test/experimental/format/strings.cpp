@@ -0,0 +1,52 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/format.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+using hana::experimental::format;
+using hana::experimental::format_to;
+
+
+int main() {
+    auto abc = BOOST_HANA_STRING("abc");
+    auto de = BOOST_HANA_STRING("de");
+    auto empty = BOOST_HANA_STRING("");
+
+    // compile-time strings
+    {
+        BOOST_HANA_RUNTIME_CHECK(format() == "");
+        BOOST_HANA_RUNTIME_CHECK(format(empty) == "");
+        BOOST_HANA_RUNTIME_CHECK(format(abc) == "abc");
+        BOOST_HANA_RUNTIME_CHECK(format(abc, de, empty, abc) == "abcdeabc");
+        BOOST_HANA_RUNTIME_CHECK(format(abc, 1, de, abc, 2, empty) == "abc1deabc2");
+        static_assert(hana::experimental::max_formatted_size<decltype(abc), decltype(de)> == 5, "");
+        static_assert(hana::experimental::max_formatted_size<> == 0, "");
+    }
+
+    // runtime strings
+    {
+        std::string s = "std::string";
+        char const* p = "pointer";
+        char array[] = "array";
+        BOOST_HANA_RUNTIME_CHECK(format(s, ' ', p, ' ', array, ' ', "literal") ==
+                                 "std::string pointer array literal");
+        BOOST_HANA_RUNTIME_CHECK(format(std::string{}, abc, std::string{}) == "abc");
+        static_assert(hana::experimental::max_formatted_size<char[6]> == 5, "");
+    }
+
+    // format_to writes exactly the characters, and nothing past them
+    {
+        char buffer[32];
+        for (char& c : buffer)
+            c = '#';
+        char* end = format_to(buffer, abc, -12, de, 'x');
+        BOOST_HANA_RUNTIME_CHECK(end == buffer + 9);
+        BOOST_HANA_RUNTIME_CHECK(std::string(buffer, end) == "abc-12dex");
+        BOOST_HANA_RUNTIME_CHECK(*end == '#');
+    }
+}
@@ -0,0 +1,27 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    using hana::experimental::to_json;
+
+    BOOST_HANA_RUNTIME_CHECK(to_json(hana::make_tuple()) == "[]");
+    BOOST_HANA_RUNTIME_CHECK(to_json(hana::make_tuple(1)) == "[1]");
+    BOOST_HANA_RUNTIME_CHECK(to_json(hana::make_tuple(1, "two", 3.5, false)) ==
+                             R"([1,"two",3.5,false])");
+    BOOST_HANA_RUNTIME_CHECK(to_json(hana::make_tuple(hana::make_tuple(), hana::make_tuple(1, 2))) ==
+                             "[[],[1,2]]");
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::array<int, 3>{{1, 2, 3}}) == "[1,2,3]");
+    BOOST_HANA_RUNTIME_CHECK(to_json(hana::make_tuple(std::array<std::string, 2>{{"a", "b"}})) ==
+                             R"([["a","b"]])");
+}
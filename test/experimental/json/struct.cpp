@@ -0,0 +1,63 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Shape {
+    BOOST_HANA_DEFINE_STRUCT(Shape,
+        (std::string, name),
+        (hana::tuple<Point, Point>, corners),
+        (Empty, style),
+        (bool, filled)
+    );
+};
+
+namespace ns {
+    struct Adapted {
+        double value;
+        std::string label;
+    };
+}
+
+BOOST_HANA_ADAPT_STRUCT(ns::Adapted, label, value);
+
+int main() {
+    using hana::experimental::to_json;
+
+    BOOST_HANA_RUNTIME_CHECK(to_json(Empty{}) == "{}");
+    BOOST_HANA_RUNTIME_CHECK(to_json(Point{1, -2}) == R"({"x":1,"y":-2})");
+    BOOST_HANA_RUNTIME_CHECK(to_json(ns::Adapted{0.5, "half"}) == R"({"label":"half","value":0.5})");
+
+    Shape shape{"box", hana::make_tuple(Point{0, 0}, Point{3, 4}), {}, true};
+    BOOST_HANA_RUNTIME_CHECK(to_json(shape) ==
+        R"({"name":"box","corners":[{"x":0,"y":0},{"x":3,"y":4}],"style":{},"filled":true})");
+
+    // Reusing the output
+    {
+        std::string out;
+        hana::experimental::write_json(out, Point{1, 2});
+        out.clear();
+        hana::experimental::write_json(out, Point{3, 4});
+        BOOST_HANA_RUNTIME_CHECK(out == R"({"x":3,"y":4})");
+    }
+}
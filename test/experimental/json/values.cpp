@@ -0,0 +1,79 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/string.hpp>
+
+#include <clocale>
+#include <limits>
+#include <string>
+namespace hana = boost::hana;
+
+
+int main() {
+    using hana::experimental::to_json;
+
+    // integers
+    BOOST_HANA_RUNTIME_CHECK(to_json(0) == "0");
+    BOOST_HANA_RUNTIME_CHECK(to_json(42) == "42");
+    BOOST_HANA_RUNTIME_CHECK(to_json(-42) == "-42");
+    BOOST_HANA_RUNTIME_CHECK(to_json(42u) == "42");
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::numeric_limits<long long>::min()) ==
+                             std::to_string(std::numeric_limits<long long>::min()));
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::numeric_limits<unsigned long long>::max()) ==
+                             std::to_string(std::numeric_limits<unsigned long long>::max()));
+    BOOST_HANA_RUNTIME_CHECK(to_json(static_cast<signed char>(-128)) == "-128");
+    BOOST_HANA_RUNTIME_CHECK(to_json(static_cast<unsigned short>(65535)) == "65535");
+
+    // booleans
+    BOOST_HANA_RUNTIME_CHECK(to_json(true) == "true");
+    BOOST_HANA_RUNTIME_CHECK(to_json(false) == "false");
+
+    // floating points
+    BOOST_HANA_RUNTIME_CHECK(to_json(1.5) == "1.5");
+    BOOST_HANA_RUNTIME_CHECK(to_json(-0.25f) == "-0.25");
+    BOOST_HANA_RUNTIME_CHECK(to_json(0.1) == "0.10000000000000001");
+    BOOST_HANA_RUNTIME_CHECK(to_json(2.5l) == "2.5");
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::numeric_limits<double>::infinity()) == "null");
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::numeric_limits<double>::quiet_NaN()) == "null");
+
+    // strings and characters
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"abc"}) == R"("abc")");
+    BOOST_HANA_RUNTIME_CHECK(to_json("abc") == R"("abc")");
+    BOOST_HANA_RUNTIME_CHECK(to_json(static_cast<char const*>("abc")) == R"("abc")");
+    BOOST_HANA_RUNTIME_CHECK(to_json(BOOST_HANA_STRING("abc")) == R"("abc")");
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::string{}) == R"("")");
+    BOOST_HANA_RUNTIME_CHECK(to_json('x') == R"("x")");
+
+    // escaping
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"a\"b\\c"}) == R"("a\"b\\c")");
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"\n\t\r"}) == R"("\n\t\r")");
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"\x01z\x1f", 3}) == R"("\u0001z\u001f")");
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"a\0b", 3}) == R"("a\u0000b")");
+    BOOST_HANA_RUNTIME_CHECK(to_json('"') == R"("\"")");
+    BOOST_HANA_RUNTIME_CHECK(to_json(std::string{"caf\xc3\xa9"}) == "\"caf\xc3\xa9\"");
+
+    // write_json appends to its output
+    {
+        std::string out = "x=";
+        hana::experimental::write_json(out, 1);
+        BOOST_HANA_RUNTIME_CHECK(out == "x=1");
+    }
+
+    // the decimal point is always a '.', whatever the locale
+    {
+        char const* locales[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8",
+                                 "fr_FR.utf8", "fr_FR", "German", "French"};
+        for (char const* locale : locales) {
+            if (std::setlocale(LC_NUMERIC, locale) != nullptr)
+                break;
+        }
+        BOOST_HANA_RUNTIME_CHECK(to_json(1.5) == "1.5");
+        BOOST_HANA_RUNTIME_CHECK(to_json(-0.25f) == "-0.25");
+        BOOST_HANA_RUNTIME_CHECK(to_json(2.5l) == "2.5");
+        BOOST_HANA_RUNTIME_CHECK(to_json(1e300) == "1.0000000000000001e+300");
+        std::setlocale(LC_NUMERIC, "C");
+    }
+}
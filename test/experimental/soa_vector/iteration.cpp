@@ -0,0 +1,85 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+namespace hana = boost::hana;
+
+
+struct Sample {
+    BOOST_HANA_DEFINE_STRUCT(Sample,
+        (int, key),
+        (double, value),
+        (char, flag),
+        (bool, even)
+    );
+};
+
+int main() {
+    hana::experimental::soa_vector<Sample> samples;
+    for (int i = 0; i != 8; ++i)
+        samples.push_back({i, i * 0.5, i % 2 ? 'y' : 'n', i % 2 == 0});
+
+    // iterators
+    {
+        BOOST_HANA_RUNTIME_CHECK(std::distance(samples.begin(), samples.end()) == 8);
+        BOOST_HANA_RUNTIME_CHECK(samples.end() - samples.begin() == 8);
+        BOOST_HANA_RUNTIME_CHECK(samples.begin() < samples.end());
+        BOOST_HANA_RUNTIME_CHECK(samples.cbegin() == samples.begin());
+
+        auto it = samples.begin();
+        ++it; it++; it += 3; --it; it -= 1;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(*it, BOOST_HANA_STRING("key")) == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(it[2], BOOST_HANA_STRING("key")) == 5);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(*(2 + it), BOOST_HANA_STRING("key")) == 5);
+
+        int keys = 0;
+        for (auto sample : samples)
+            keys += hana::at_key(sample, BOOST_HANA_STRING("key"));
+        BOOST_HANA_RUNTIME_CHECK(keys == 28);
+
+        auto flagged = std::count_if(samples.begin(), samples.end(), [](auto sample) {
+            return hana::at_key(sample, BOOST_HANA_STRING("flag")) == 'y';
+        });
+        BOOST_HANA_RUNTIME_CHECK(flagged == 4);
+    }
+
+    // columns
+    {
+        auto values = samples.column(BOOST_HANA_STRING("value"));
+        BOOST_HANA_RUNTIME_CHECK(values.size() == 8);
+        BOOST_HANA_RUNTIME_CHECK(std::accumulate(values.begin(), values.end(), 0.0) == 14.0);
+        for (double& value : values)
+            value *= 2;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(samples[3], BOOST_HANA_STRING("value")) == 3.0);
+
+        auto const& csamples = samples;
+        auto keys = csamples.column(BOOST_HANA_STRING("key"));
+        BOOST_HANA_RUNTIME_CHECK(keys.data() + 8 == keys.end());
+        BOOST_HANA_RUNTIME_CHECK(std::is_sorted(keys.begin(), keys.end()));
+    }
+
+    // columns of bools
+    {
+        auto even = samples.column(BOOST_HANA_STRING("even"));
+        BOOST_HANA_RUNTIME_CHECK(even.size() == 8);
+        BOOST_HANA_RUNTIME_CHECK(std::count(even.begin(), even.end(), true) == 4);
+        for (bool& e : even)
+            e = !e;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(samples[1], BOOST_HANA_STRING("even")));
+        BOOST_HANA_RUNTIME_CHECK(std::find(even.begin(), even.end(), true) - even.begin() == 1);
+
+        auto const& csamples = samples;
+        auto ceven = csamples.column(BOOST_HANA_STRING("even"));
+        BOOST_HANA_RUNTIME_CHECK(ceven.end() - ceven.begin() == 8);
+        BOOST_HANA_RUNTIME_CHECK(ceven[3] && !ceven[4]);
+    }
+}
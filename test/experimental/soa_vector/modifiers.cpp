@@ -0,0 +1,139 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (std::string, name),
+        (std::unique_ptr<int>, payload)
+    );
+};
+
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (int, x),
+        (int, y)
+    );
+};
+
+struct Throws {
+    static bool enabled;
+    int value;
+
+    explicit Throws(int v) : value{v} { }
+    Throws(Throws const& other) : value{other.value} {
+        if (enabled)
+            throw 0;
+    }
+    Throws& operator=(Throws const&) = default;
+};
+bool Throws::enabled = false;
+
+struct Guarded {
+    BOOST_HANA_DEFINE_STRUCT(Guarded,
+        (int, before),
+        (Throws, throws),
+        (int, after)
+    );
+};
+
+template <typename Records>
+int id(Records& records, std::size_t i) {
+    return hana::at_key(records[i], BOOST_HANA_STRING("id"));
+}
+
+int main() {
+    hana::experimental::soa_vector<Record> records;
+    BOOST_HANA_RUNTIME_CHECK(records.empty());
+    BOOST_HANA_RUNTIME_CHECK(records.size() == 0);
+
+    // push_back moves the members of rvalues
+    records.reserve(10);
+    for (int i = 0; i != 10; ++i)
+        records.push_back(Record{i, std::to_string(i), std::make_unique<int>(i * i)});
+    BOOST_HANA_RUNTIME_CHECK(!records.empty());
+    BOOST_HANA_RUNTIME_CHECK(records.size() == 10);
+    for (std::size_t i = 0; i != 10; ++i) {
+        BOOST_HANA_RUNTIME_CHECK(id(records, i) == static_cast<int>(i));
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_key(records[i], BOOST_HANA_STRING("payload")) ==
+                                 static_cast<int>(i * i));
+    }
+
+    // erase a single element
+    {
+        auto it = records.erase(records.begin() + 2);
+        BOOST_HANA_RUNTIME_CHECK(it == records.begin() + 2);
+        BOOST_HANA_RUNTIME_CHECK(records.size() == 9);
+        BOOST_HANA_RUNTIME_CHECK(id(records, 1) == 1);
+        BOOST_HANA_RUNTIME_CHECK(id(records, 2) == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(records[2], BOOST_HANA_STRING("name")) == "3");
+        BOOST_HANA_RUNTIME_CHECK(*hana::at_key(records[2], BOOST_HANA_STRING("payload")) == 9);
+    }
+
+    // erase a range
+    {
+        auto it = records.erase(records.begin() + 1, records.begin() + 4);
+        BOOST_HANA_RUNTIME_CHECK(it == records.begin() + 1);
+        BOOST_HANA_RUNTIME_CHECK(records.size() == 6);
+        BOOST_HANA_RUNTIME_CHECK(id(records, 0) == 0);
+        BOOST_HANA_RUNTIME_CHECK(id(records, 1) == 5);
+        BOOST_HANA_RUNTIME_CHECK(id(records, 5) == 9);
+    }
+
+    // pop_back
+    records.pop_back();
+    BOOST_HANA_RUNTIME_CHECK(records.size() == 5);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_key(records.back(), BOOST_HANA_STRING("id")) == 8);
+    BOOST_HANA_RUNTIME_CHECK(hana::at_key(records.front(), BOOST_HANA_STRING("id")) == 0);
+
+    // push_back copies lvalues
+    {
+        hana::experimental::soa_vector<Point> points;
+        Point p{1, 2};
+        points.push_back(p);
+        points.push_back(p);
+        BOOST_HANA_RUNTIME_CHECK(points.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(points[1], BOOST_HANA_STRING("y")) == 2);
+    }
+
+    // push_back leaves all the columns with the same size when copying
+    // a member throws
+    {
+        hana::experimental::soa_vector<Guarded> guarded;
+        Guarded g{1, Throws{2}, 3};
+        guarded.push_back(g);
+
+        Throws::enabled = true;
+        bool thrown = false;
+        try { guarded.push_back(g); } catch (int) { thrown = true; }
+        Throws::enabled = false;
+
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+        BOOST_HANA_RUNTIME_CHECK(guarded.size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(guarded.column(BOOST_HANA_STRING("before")).size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(guarded.column(BOOST_HANA_STRING("throws")).size() == 1);
+        BOOST_HANA_RUNTIME_CHECK(guarded.column(BOOST_HANA_STRING("after")).size() == 1);
+
+        guarded.push_back(Guarded{4, Throws{5}, 6});
+        BOOST_HANA_RUNTIME_CHECK(guarded.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(guarded[1], BOOST_HANA_STRING("before")) == 4);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(guarded[1], BOOST_HANA_STRING("after")) == 6);
+    }
+
+    // clear
+    records.clear();
+    BOOST_HANA_RUNTIME_CHECK(records.empty());
+}
@@ -0,0 +1,88 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/struct.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/soa_vector.hpp>
+#include <boost/hana/keys.hpp>
+#include <boost/hana/members.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age)
+    );
+};
+
+struct Flagged {
+    BOOST_HANA_DEFINE_STRUCT(Flagged,
+        (int, id),
+        (bool, flag)
+    );
+};
+
+int main() {
+    using Vector = hana::experimental::soa_vector<Person>;
+    Vector people;
+    people.push_back({"John", 30});
+    people.push_back({"Jane", 40});
+
+    static_assert(hana::Struct<Vector::reference>::value, "");
+    static_assert(hana::Struct<Vector::const_reference>::value, "");
+
+    // The members of a row are references into the columns
+    {
+        auto row = people[1];
+        auto age = BOOST_HANA_STRING("age");
+        static_assert(std::is_same<decltype(hana::at_key(row, age)), int&>{}, "");
+        hana::at_key(row, age) = 41;
+        BOOST_HANA_RUNTIME_CHECK(people.column(BOOST_HANA_STRING("age"))[1] == 41);
+    }
+
+    // bool members are references too, not proxies like std::vector<bool>
+    {
+        hana::experimental::soa_vector<Flagged> flagged;
+        flagged.push_back({1, false});
+        flagged.push_back({2, true});
+
+        auto flag = BOOST_HANA_STRING("flag");
+        static_assert(std::is_same<decltype(hana::at_key(flagged[0], flag)), bool&>{}, "");
+        hana::at_key(flagged[0], flag) = true;
+        BOOST_HANA_RUNTIME_CHECK(flagged.column(flag)[0]);
+        BOOST_HANA_RUNTIME_CHECK(&hana::at_key(flagged[1], flag) == &flagged.column(flag)[1]);
+
+        auto const& cflagged = flagged;
+        static_assert(std::is_same<decltype(hana::at_key(cflagged[0], flag)), bool const&>{}, "");
+    }
+
+    // The rows of a const soa_vector are read-only
+    {
+        Vector const& cpeople = people;
+        auto row = cpeople[0];
+        auto name = BOOST_HANA_STRING("name");
+        static_assert(std::is_same<decltype(hana::at_key(row, name)), std::string const&>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(row, name) == "John");
+    }
+
+    // Rows have the member names of the Struct
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::keys(people[0]),
+        hana::make_tuple(BOOST_HANA_STRING("name"), BOOST_HANA_STRING("age"))
+    ));
+    BOOST_HANA_RUNTIME_CHECK(hana::members(people[0]) == hana::make_tuple(std::string{"John"}, 30));
+
+    // Rows are compared by their members
+    BOOST_HANA_RUNTIME_CHECK(hana::equal(people[0], people[0]));
+    BOOST_HANA_RUNTIME_CHECK(!hana::equal(people[0], people[1]));
+}
@@ -0,0 +1,38 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types_map.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+using hana::experimental::type_pair;
+using hana::experimental::types_map;
+
+
+template <int> struct k;
+template <int> struct v;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_key(types_map<type_pair<k<0>, v<0>>>{}, hana::type_c<k<0>>),
+        hana::type_c<v<0>>
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_key(types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>>{}, hana::type_c<k<0>>),
+        hana::type_c<v<0>>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_key(types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>>{}, hana::type_c<k<1>>),
+        hana::type_c<v<1>>
+    ));
+
+    using Map = types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>, type_pair<k<2>, v<1>>>;
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_key(Map{}, hana::type_c<k<2>>),
+        hana::type_c<v<1>>
+    ));
+}
@@ -0,0 +1,35 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/experimental/types_map.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+using hana::experimental::type_pair;
+using hana::experimental::types_map;
+
+
+template <int> struct k;
+template <int> struct v;
+struct undefined { };
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(types_map<>{}, undefined{})));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(types_map<>{}, hana::type_c<k<0>>)));
+
+    using Map = types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<0>>, type_pair<k<2>, v<2>>>;
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(Map{}, hana::type_c<k<0>>));
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(Map{}, hana::type_c<k<1>>));
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(Map{}, hana::type_c<k<2>>));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(Map{}, hana::type_c<k<999>>)));
+
+    // values are not keys
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(Map{}, hana::type_c<v<0>>)));
+
+    // keys that are not types are never contained
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(Map{}, hana::int_c<0>)));
+}
@@ -0,0 +1,50 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types_map.hpp>
+#include <boost/hana/not.hpp>
+namespace hana = boost::hana;
+using hana::experimental::type_pair;
+using hana::experimental::types_map;
+
+
+template <int> struct k;
+template <int> struct v;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(types_map<>{}, types_map<>{}));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        types_map<>{},
+        types_map<type_pair<k<0>, v<0>>>{}
+    )));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        types_map<type_pair<k<0>, v<0>>>{},
+        types_map<type_pair<k<0>, v<0>>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        types_map<type_pair<k<0>, v<0>>>{},
+        types_map<type_pair<k<0>, v<1>>>{}
+    )));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        types_map<type_pair<k<0>, v<0>>>{},
+        types_map<type_pair<k<1>, v<0>>>{}
+    )));
+
+    // the order of the associations does not matter
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>>{},
+        types_map<type_pair<k<1>, v<1>>, type_pair<k<0>, v<0>>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>>{},
+        types_map<type_pair<k<1>, v<0>>, type_pair<k<0>, v<1>>>{}
+    )));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>>{},
+        types_map<type_pair<k<0>, v<0>>>{}
+    )));
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types_map.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+using hana::experimental::type_pair;
+using hana::experimental::types_map;
+
+
+template <int> struct k;
+template <int> struct v;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(types_map<>{}, hana::make_pair(hana::type_c<k<0>>, hana::type_c<v<0>>)),
+        types_map<type_pair<k<0>, v<0>>>{}
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(types_map<type_pair<k<0>, v<0>>>{},
+                     hana::make_pair(hana::type_c<k<1>>, hana::type_c<v<1>>)),
+        types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>>{}
+    ));
+
+    // inserting a key that is already present leaves the map unchanged
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>>{},
+                     hana::make_pair(hana::type_c<k<1>>, hana::type_c<v<999>>)),
+        types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>>{}
+    ));
+}
@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types.hpp>
+#include <boost/hana/experimental/types_map.hpp>
+#include <boost/hana/keys.hpp>
+namespace hana = boost::hana;
+using hana::experimental::type_pair;
+using hana::experimental::types;
+using hana::experimental::types_map;
+
+
+template <int> struct k;
+template <int> struct v;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::keys(types_map<>{}),
+        types<>{}
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::keys(types_map<type_pair<k<0>, v<0>>>{}),
+        types<k<0>>{}
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::keys(types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>>{}),
+        types<k<0>, k<1>>{}
+    ));
+}
@@ -0,0 +1,68 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types_map.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+using hana::experimental::type_pair;
+using hana::experimental::types_map;
+
+
+template <int> struct k;
+template <int> struct v;
+
+using Map = types_map<type_pair<k<0>, v<0>>, type_pair<k<1>, v<1>>, type_pair<k<2>, v<2>>>;
+
+int main() {
+    // find
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(types_map<>{}, hana::type_c<k<0>>),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(Map{}, hana::type_c<k<1>>),
+        hana::just(hana::type_c<v<1>>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(Map{}, hana::type_c<k<999>>),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(Map{}, hana::int_c<0>),
+        hana::nothing
+    ));
+
+    // find_if
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(types_map<>{}, hana::equal.to(hana::type_c<k<0>>)),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(Map{}, hana::equal.to(hana::type_c<k<2>>)),
+        hana::just(hana::type_c<v<2>>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(Map{}, hana::equal.to(hana::type_c<k<999>>)),
+        hana::nothing
+    ));
+
+    // any_of
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(
+        hana::any_of(types_map<>{}, hana::equal.to(hana::type_c<k<0>>))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(
+        hana::any_of(Map{}, hana::equal.to(hana::type_c<k<0>>))
+    );
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(
+        hana::any_of(Map{}, hana::equal.to(hana::type_c<v<0>>))
+    ));
+}
@@ -0,0 +1,30 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types_set.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+using hana::experimental::types_set;
+
+
+template <int> struct x;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_key(types_set<x<0>>{}, hana::type_c<x<0>>),
+        hana::type_c<x<0>>
+    ));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_key(types_set<x<0>, x<1>, x<2>>{}, hana::type_c<x<0>>),
+        hana::type_c<x<0>>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::at_key(types_set<x<0>, x<1>, x<2>>{}, hana::type_c<x<2>>),
+        hana::type_c<x<2>>
+    ));
+}
@@ -0,0 +1,36 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types_set.hpp>
+#include <boost/hana/not.hpp>
+namespace hana = boost::hana;
+using hana::experimental::types_set;
+
+
+template <int> struct x;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(types_set<>{}, types_set<>{}));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(types_set<>{}, types_set<x<0>>{})));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(types_set<x<0>>{}, types_set<>{})));
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(types_set<x<0>>{}, types_set<x<0>>{}));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(types_set<x<0>>{}, types_set<x<1>>{})));
+
+    // the order of the elements does not matter
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        types_set<x<0>, x<1>, x<2>>{},
+        types_set<x<2>, x<0>, x<1>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        types_set<x<0>, x<1>, x<2>>{},
+        types_set<x<0>, x<1>>{}
+    )));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        types_set<x<0>, x<1>, x<2>>{},
+        types_set<x<0>, x<1>, x<3>>{}
+    )));
+}
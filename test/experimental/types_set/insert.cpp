@@ -0,0 +1,31 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types_set.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+using hana::experimental::types_set;
+
+
+template <int> struct x;
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(types_set<>{}, hana::type_c<x<0>>),
+        types_set<x<0>>{}
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(types_set<x<0>>{}, hana::type_c<x<1>>),
+        types_set<x<0>, x<1>>{}
+    ));
+
+    // inserting an element that is already present leaves the set unchanged
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::insert(types_set<x<0>, x<1>>{}, hana::type_c<x<0>>),
+        types_set<x<0>, x<1>>{}
+    ));
+}
@@ -0,0 +1,59 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/types_set.hpp>
+#include <boost/hana/find.hpp>
+#include <boost/hana/find_if.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/type.hpp>
+namespace hana = boost::hana;
+using hana::experimental::types_set;
+
+
+template <int> struct x;
+
+int main() {
+    // find
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(types_set<>{}, hana::type_c<x<0>>),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(types_set<x<0>, x<1>, x<2>>{}, hana::type_c<x<1>>),
+        hana::just(hana::type_c<x<1>>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find(types_set<x<0>, x<1>, x<2>>{}, hana::type_c<x<999>>),
+        hana::nothing
+    ));
+
+    // find_if
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(types_set<>{}, hana::equal.to(hana::type_c<x<0>>)),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(types_set<x<0>, x<1>, x<2>>{}, hana::equal.to(hana::type_c<x<2>>)),
+        hana::just(hana::type_c<x<2>>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::find_if(types_set<x<0>, x<1>, x<2>>{}, hana::equal.to(hana::type_c<x<999>>)),
+        hana::nothing
+    ));
+
+    // any_of
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(
+        hana::any_of(types_set<>{}, hana::equal.to(hana::type_c<x<0>>))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(
+        hana::any_of(types_set<x<0>, x<1>>{}, hana::equal.to(hana::type_c<x<1>>))
+    );
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(
+        hana::any_of(types_set<x<0>, x<1>>{}, hana::equal.to(hana::type_c<x<999>>))
+    ));
+}
@@ -0,0 +1,62 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/value_hash.hpp>
+#include <boost/hana/ext/std/tuple.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <tuple>
+#include <unordered_map>
+namespace hana = boost::hana;
+using hana::experimental::value_hash;
+using hana::experimental::value_equal;
+
+
+int main() {
+    // hana::tuple
+    {
+        auto x = hana::make_tuple(1, 'a', 2u, 3.5, std::string{"x"});
+        auto y = x;
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) == value_hash{}(y));
+        hana::at_c<1>(y) = 'b';
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) != value_hash{}(y));
+        y = x;
+        hana::at_c<4>(y) = "y";
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) != value_hash{}(y));
+    }
+
+    // empty elements are skipped
+    {
+        auto x = hana::make_tuple(1, hana::int_c<2>, 3);
+        auto y = hana::make_tuple(1, hana::int_c<2>, 3);
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) == value_hash{}(y));
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(hana::make_tuple()) == value_hash{}(hana::make_tuple()));
+    }
+
+    // nested Sequences and std::tuple
+    {
+        auto x = hana::make_tuple(std::make_tuple(1, 2, 3), hana::make_tuple(4, 5));
+        auto y = x;
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) == value_hash{}(y));
+        std::get<0>(hana::at_c<0>(y)) = 10;
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) != value_hash{}(y));
+        y = x;
+        hana::at_c<1>(hana::at_c<1>(y)) = 50;
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) != value_hash{}(y));
+    }
+
+    // as the hash of an unordered container
+    {
+        using Key = hana::tuple<int, int, std::string>;
+        std::unordered_map<Key, int, value_hash, value_equal> map;
+        for (int i = 0; i != 100; ++i)
+            map[Key{i, i * i, std::to_string(i)}] = i;
+        for (int i = 0; i != 100; ++i)
+            BOOST_HANA_RUNTIME_CHECK((map.at(Key{i, i * i, std::to_string(i)}) == i));
+        BOOST_HANA_RUNTIME_CHECK((map.count(Key{1, 2, "1"}) == 0));
+    }
+}
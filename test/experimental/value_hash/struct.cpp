@@ -0,0 +1,128 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/adapt_struct.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/define_struct.hpp>
+#include <boost/hana/experimental/value_hash.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <unordered_set>
+namespace hana = boost::hana;
+using hana::experimental::value_hash;
+using hana::experimental::value_equal;
+
+
+enum class Color { red, green };
+
+struct Padded {
+    BOOST_HANA_DEFINE_STRUCT(Padded,
+        (char, a),
+        (int, b),
+        (Color, c),
+        (char, d),
+        (double, e)
+    );
+};
+
+struct Nested {
+    BOOST_HANA_DEFINE_STRUCT(Nested,
+        (short, head),
+        (Padded, padded),
+        (std::string, name),
+        (short, tail)
+    );
+};
+
+struct Empty {
+    BOOST_HANA_DEFINE_STRUCT(Empty);
+};
+
+// A Struct with an unreflected member between its reflected members
+struct Partial {
+    int a;
+    int hidden;
+    int b;
+};
+BOOST_HANA_ADAPT_STRUCT(Partial, a, b);
+
+struct Key {
+    BOOST_HANA_DEFINE_STRUCT(Key,
+        (int, id),
+        (std::string, name)
+    );
+};
+
+namespace std {
+    template <>
+    struct hash<Key> : value_hash { };
+}
+
+int main() {
+    // equal values have equal hashes, even with indeterminate padding
+    {
+        Padded x, y;
+        std::memset(&x, 0x00, sizeof(x));
+        std::memset(&y, 0xff, sizeof(y));
+        x.a = y.a = 'a'; x.b = y.b = 1; x.c = y.c = Color::green;
+        x.d = y.d = 'd'; x.e = y.e = 2.5;
+        BOOST_HANA_RUNTIME_CHECK(value_equal{}(x, y));
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) == value_hash{}(y));
+
+        y.b = 2;
+        BOOST_HANA_RUNTIME_CHECK(!value_equal{}(x, y));
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) != value_hash{}(y));
+    }
+
+    // floating point members are hashed by value
+    {
+        Padded x{'a', 1, Color::red, 'd', 0.0};
+        Padded y{'a', 1, Color::red, 'd', -0.0};
+        BOOST_HANA_RUNTIME_CHECK(value_equal{}(x, y));
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) == value_hash{}(y));
+    }
+
+    // nested Structs and members hashed with std::hash
+    {
+        Nested x{1, {'a', 2, Color::red, 'd', 3.5}, "x", 4};
+        Nested y = x;
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) == value_hash{}(y));
+
+        y.name = "y";
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) != value_hash{}(y));
+        y = x;
+        y.padded.d = 'e';
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) != value_hash{}(y));
+        y = x;
+        y.tail = 5;
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) != value_hash{}(y));
+    }
+
+    // Structs without members
+    {
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(Empty{}) == value_hash{}(Empty{}));
+    }
+
+    // unreflected members are not part of the value
+    {
+        Partial x{1, 2, 3}, y{1, 20, 3};
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) == value_hash{}(y));
+        y.b = 30;
+        BOOST_HANA_RUNTIME_CHECK(value_hash{}(x) != value_hash{}(y));
+    }
+
+    // usable as the hash of unordered containers, and to specialize std::hash
+    {
+        std::unordered_set<Key, std::hash<Key>, value_equal> keys;
+        keys.insert(Key{1, "one"});
+        keys.insert(Key{2, "two"});
+        keys.insert(Key{1, "one"});
+        BOOST_HANA_RUNTIME_CHECK(keys.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(keys.count(Key{2, "two"}) == 1);
+        BOOST_HANA_RUNTIME_CHECK(keys.count(Key{2, "one"}) == 0);
+    }
+}
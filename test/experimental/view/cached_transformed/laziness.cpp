@@ -0,0 +1,49 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/drop_front.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+struct counting_twice {
+    int* calls;
+    int operator()(int x) const { ++*calls; return 2 * x; }
+};
+
+int main() {
+    {
+        int calls = 0;
+        auto storage = hana::make_tuple(1, 2, 3);
+        auto transformed = hana::experimental::cached_transformed(storage, counting_twice{&calls});
+
+        // Make sure we do not evaluate the function unless required
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+
+        // Make sure we evaluate the function at most once per element
+
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(transformed) == 4);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(transformed) == 4);
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::to<hana::tuple_tag>(transformed) == hana::make_tuple(2, 4, 6)
+        );
+        BOOST_HANA_RUNTIME_CHECK(calls == 3);
+
+        // Views of a cached view share its results
+        auto dropped = hana::drop_front(transformed, hana::size_c<1>);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(dropped) == 6);
+        auto incremented = hana::transform(transformed, [](int x) { return x + 1; });
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::to<hana::tuple_tag>(incremented) == hana::make_tuple(3, 5, 7)
+        );
+        BOOST_HANA_RUNTIME_CHECK(calls == 3);
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <laws/base.hpp>
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+
+
+int main() {
+    auto container = ::seq;
+    auto f = hana::test::_injection<0>{};
+
+    {
+        auto storage = container();
+        auto reversed = hana::experimental::reversed(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(reversed, f),
+            f()
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{});
+        auto reversed = hana::experimental::reversed(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(reversed, f),
+            f(ct_eq<0>{})
+        ));
+    }
+
+    {
+        auto storage = container(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{});
+        auto reversed = hana::experimental::reversed(storage);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(reversed, f),
+            f(ct_eq<2>{}, ct_eq<1>{}, ct_eq<0>{})
+        ));
+
+        // reversing twice yields the original order
+        auto rereversed = hana::experimental::reversed(reversed);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::unpack(rereversed, f),
+            f(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+    }
+}
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/experimental/view.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/is_empty.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/not.hpp>
+
+#include <support/seq.hpp>
+namespace hana = boost::hana;
+
+
+template <int> struct undefined { };
+
+int main() {
+    auto container = ::seq;
+
+    {
+        auto storage1 = container();
+        auto storage2 = container();
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(zipped), hana::size_c<0>));
+        BOOST_HANA_CONSTANT_CHECK(hana::is_empty(zipped));
+    }
+
+    {
+        auto storage1 = container(undefined<0>{}, undefined<1>{});
+        auto storage2 = container(undefined<2>{}, undefined<3>{});
+        auto zipped = hana::experimental::zipped(storage1, storage2);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::length(zipped), hana::size_c<2>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::is_empty(zipped)));
+    }
+}
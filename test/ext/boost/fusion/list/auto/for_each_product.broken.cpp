@@ -0,0 +1,10 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#if 0
+#include "_specs.hpp"
+#include <auto/for_each_product.hpp>
+#endif
+
+int main() { }
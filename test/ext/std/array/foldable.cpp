@@ -4,6 +4,11 @@
 
 #include <boost/hana/ext/std/array.hpp>
 
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
 #include <boost/hana/tuple.hpp>
 
 #include <laws/foldable.hpp>
@@ -26,4 +31,21 @@ int main() {
     );
 
     hana::test::TestFoldable<hana::ext::std::array_tag>{int_arrays};
+
+    // Folds keeping the same state type and for_each are done with a loop
+    {
+        std::array<int, 4> xs{{1, 2, 3, 4}};
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::fold_left(xs, 0, [](int s, int x) { return s * 10 + x; }) == 1234
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::fold_left(xs, [](int s, int x) { return s * 10 + x; }) == 1234
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::fold_left(xs, hana::make_tuple(), hana::append) == hana::make_tuple(1, 2, 3, 4)
+        );
+
+        hana::for_each(xs, [](int& x) { x *= 2; });
+        BOOST_HANA_RUNTIME_CHECK(xs == array<2, 4, 6, 8>());
+    }
 }
@@ -0,0 +1,37 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/ext/std/array.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/visit_at.hpp>
+
+#include <array>
+#include <cstddef>
+namespace hana = boost::hana;
+
+
+struct square {
+    constexpr int operator()(int x) const { return x * x; }
+};
+
+struct otherwise {
+    constexpr int operator()() const { return -1; }
+};
+
+int main() {
+    std::array<int, 4> xs{{0, 1, 2, 3}};
+    for (std::size_t i = 0; i != 4; ++i) {
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, i, square{}, otherwise{}) == static_cast<int>(i * i));
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_at_unchecked(xs, i, square{}) == static_cast<int>(i * i));
+    }
+    BOOST_HANA_RUNTIME_CHECK(hana::visit_at(xs, 4, square{}, otherwise{}) == -1);
+
+    hana::visit_at_unchecked(xs, 2, [](int& x) { x = 20; });
+    BOOST_HANA_RUNTIME_CHECK(xs[2] == 20);
+
+    constexpr std::array<int, 3> ys{{3, 4, 5}};
+    static_assert(hana::visit_at_unchecked(ys, 1, square{}) == 16, "");
+    static_assert(hana::visit_at(ys, 3, square{}, otherwise{}) == -1, "");
+}
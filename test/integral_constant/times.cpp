@@ -12,6 +12,17 @@ namespace hana = boost::hana;
 void function() { }
 void function_index(...) { }
 
+int runtime_total = 0;
+void add_index(int i) { runtime_total += i; }
+
+struct takes_int {
+    int* last;
+    void operator()(int i) const {
+        BOOST_HANA_RUNTIME_CHECK(i == *last + 1);
+        *last = i;
+    }
+};
+
 int main() {
     // times member function
     {
@@ -58,4 +69,65 @@ int main() {
             ++current;
         });
     }
+
+    // times past the unroll budget
+    {
+        int counter = 0;
+        hana::int_c<1000>.times([&] { ++counter; });
+        BOOST_HANA_RUNTIME_CHECK(counter == 1000);
+
+        counter = 0;
+        hana::int_c<3>.times.unrolled_by<1>([&] { ++counter; });
+        BOOST_HANA_RUNTIME_CHECK(counter == 3);
+
+        counter = 0;
+        hana::int_c<100>.times.unrolled_by<8>([&] { ++counter; });
+        BOOST_HANA_RUNTIME_CHECK(counter == 100);
+
+        counter = 0;
+        hana::int_c<96>.times.unrolled_by<8>([&] { ++counter; });
+        BOOST_HANA_RUNTIME_CHECK(counter == 96);
+
+        counter = 0;
+        hana::int_c<10>.times.unrolled_by<8>.unrolled_by<3>([&] { ++counter; });
+        BOOST_HANA_RUNTIME_CHECK(counter == 10);
+
+        auto z = hana::int_c<100>.times.unrolled_by<8>;
+        z(function);
+    }
+
+    // times.with_index past the unroll budget
+    {
+        // Functions that need the indices at compile-time still get
+        // integral_constants, in order.
+        int current = 0;
+        hana::int_c<100>.times.unrolled_by<8>.with_index([&](auto i) {
+            static_assert(hana::is_an<hana::integral_constant_tag<int>>(i), "");
+            BOOST_HANA_RUNTIME_CHECK(hana::value(i) == current);
+            ++current;
+        });
+        BOOST_HANA_RUNTIME_CHECK(current == 100);
+
+        current = 0;
+        hana::int_c<200>.times.with_index([&](auto i) {
+            BOOST_HANA_RUNTIME_CHECK(hana::value(i) == current);
+            ++current;
+        });
+        BOOST_HANA_RUNTIME_CHECK(current == 200);
+
+        // Functions that accept a runtime index are called with a runtime
+        // index, in order.
+        int last = -1;
+        hana::int_c<100>.times.unrolled_by<8>.with_index(takes_int{&last});
+        BOOST_HANA_RUNTIME_CHECK(last == 99);
+
+        last = -1;
+        hana::int_c<1000>.times.with_index(takes_int{&last});
+        BOOST_HANA_RUNTIME_CHECK(last == 999);
+
+        hana::int_c<100>.times.unrolled_by<8>.with_index(add_index);
+        BOOST_HANA_RUNTIME_CHECK(runtime_total == 99 * 100 / 2);
+
+        hana::int_c<5>.times.unrolled_by<2>.with_index(function_index);
+    }
 }
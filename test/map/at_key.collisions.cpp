@@ -146,4 +146,27 @@ int main() {
             hana::int_c<42>
         ));
     }
+
+    {
+        auto map = hana::make_map(
+            hana::make_pair(key1, key1),
+            hana::make_pair(hana::int_c<56>, hana::int_c<56>),
+            hana::make_pair(key2, key2)
+        );
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_key(map, key1),
+            key1
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_key(map, hana::int_c<56>),
+            hana::int_c<56>
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::at_key(map, key2),
+            key2
+        ));
+    }
 }
@@ -0,0 +1,64 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/difference.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/symmetric_difference.hpp>
+
+#include <laws/base.hpp>
+#include <support/minimal_product.hpp>
+namespace hana = boost::hana;
+
+
+template <int i>
+auto key() { return hana::test::ct_eq<i>{}; }
+
+template <int i>
+auto val() { return hana::test::ct_eq<-i>{}; }
+
+template <int i, int j>
+auto p() { return ::minimal_product(key<i>(), val<j>()); }
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::difference(hana::make_map(), hana::make_map()),
+        hana::make_map()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::difference(hana::make_map(p<1, 1>()), hana::make_map()),
+        hana::make_map(p<1, 1>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::difference(hana::make_map(), hana::make_map(p<1, 1>())),
+        hana::make_map()
+    ));
+
+    // Only the keys matter, not the values
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::difference(hana::make_map(p<1, 1>()), hana::make_map(p<1, 2>())),
+        hana::make_map()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::difference(hana::make_map(p<1, 1>()), hana::make_map(p<2, 2>())),
+        hana::make_map(p<1, 1>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::difference(
+            hana::make_map(p<1, 1>(), p<2, 2>(), p<3, 3>()),
+            hana::make_map(p<4, 4>(), p<2, 5>(), p<5, 5>(), p<1, 6>())
+        ),
+        hana::make_map(p<3, 3>())
+    ));
+
+    // symmetric_difference is defined in terms of difference and union_
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::symmetric_difference(
+            hana::make_map(p<1, 1>(), p<2, 2>(), p<3, 3>()),
+            hana::make_map(p<4, 4>(), p<2, 5>(), p<5, 5>(), p<1, 6>())
+        ),
+        hana::make_map(p<3, 3>(), p<4, 4>(), p<5, 5>())
+    ));
+}
@@ -0,0 +1,78 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/union.hpp>
+
+#include <laws/base.hpp>
+#include <support/minimal_product.hpp>
+
+#include <string>
+namespace hana = boost::hana;
+
+
+template <int i>
+auto key() { return hana::test::ct_eq<i>{}; }
+
+template <int i>
+auto val() { return hana::test::ct_eq<-i>{}; }
+
+template <int i, int j>
+auto p() { return ::minimal_product(key<i>(), val<j>()); }
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::union_(hana::make_map(), hana::make_map()),
+        hana::make_map()
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::union_(hana::make_map(p<1, 1>()), hana::make_map()),
+        hana::make_map(p<1, 1>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::union_(hana::make_map(), hana::make_map(p<1, 1>())),
+        hana::make_map(p<1, 1>())
+    ));
+
+    // When a key is in both maps, the value of the second map is kept
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::union_(hana::make_map(p<1, 1>()), hana::make_map(p<1, 2>())),
+        hana::make_map(p<1, 2>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::union_(hana::make_map(p<1, 1>()), hana::make_map(p<2, 2>())),
+        hana::make_map(p<1, 1>(), p<2, 2>())
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::union_(
+            hana::make_map(p<1, 1>(), p<2, 2>(), p<3, 3>()),
+            hana::make_map(p<4, 4>(), p<2, 5>(), p<5, 5>(), p<1, 6>())
+        ),
+        hana::make_map(p<1, 6>(), p<2, 5>(), p<3, 3>(), p<4, 4>(), p<5, 5>())
+    ));
+
+    // With runtime values
+    {
+        auto xs = hana::make_map(
+            hana::make_pair(hana::type_c<int>, std::string{"int"}),
+            hana::make_pair(hana::type_c<char>, std::string{"char"})
+        );
+        auto ys = hana::make_map(
+            hana::make_pair(hana::type_c<char>, std::string{"CHAR"}),
+            hana::make_pair(hana::type_c<void>, std::string{"void"})
+        );
+        auto zs = hana::union_(xs, ys);
+        BOOST_HANA_RUNTIME_CHECK(zs[hana::type_c<int>] == "int");
+        BOOST_HANA_RUNTIME_CHECK(zs[hana::type_c<char>] == "CHAR");
+        BOOST_HANA_RUNTIME_CHECK(zs[hana::type_c<void>] == "void");
+
+        auto moved = hana::union_(std::move(xs), std::move(ys));
+        BOOST_HANA_RUNTIME_CHECK(moved == zs);
+    }
+}
@@ -0,0 +1,95 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/visit_key.hpp>
+
+#include <string>
+#include <utility>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto identity = [](int x) { return x; };
+    auto not_found = [] { return -1; };
+
+    // no keys
+    {
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(hana::make_map(), "", identity, not_found) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(hana::make_map(), "a", identity, not_found) == -1);
+    }
+
+    // single key
+    {
+        auto map = hana::make_map(hana::make_pair(BOOST_HANA_STRING("a"), 0));
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "a", identity, not_found) == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "", identity, not_found) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "b", identity, not_found) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "aa", identity, not_found) == -1);
+    }
+
+    // many keys, with the empty string and keys that are prefixes of others
+    {
+        auto map = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING(""), 0),
+            hana::make_pair(BOOST_HANA_STRING("a"), 1),
+            hana::make_pair(BOOST_HANA_STRING("ab"), 2),
+            hana::make_pair(BOOST_HANA_STRING("abc"), 3),
+            hana::make_pair(BOOST_HANA_STRING("b"), 4),
+            hana::make_pair(BOOST_HANA_STRING("ba"), 5),
+            hana::make_pair(BOOST_HANA_STRING("hello world"), 6)
+        );
+        char const* keys[] = {"", "a", "ab", "abc", "b", "ba", "hello world"};
+        for (int i = 0; i != 7; ++i) {
+            BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, keys[i], identity, not_found) == i);
+            BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, std::string{keys[i]}, identity, not_found) == i);
+        }
+
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "abcd", identity, not_found) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "c", identity, not_found) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "hello", identity, not_found) == -1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, std::string("a\0", 2), identity, not_found) == -1);
+    }
+
+    // the values are passed by reference, and with the map's value category
+    {
+        auto map = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("x"), 0),
+            hana::make_pair(BOOST_HANA_STRING("y"), 1)
+        );
+        hana::visit_key(map, "y", [](int& y) { y = 10; }, [] { });
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(map, BOOST_HANA_STRING("x")) == 0);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_key(map, BOOST_HANA_STRING("y")) == 10);
+
+        auto const& cmap = map;
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(cmap, "y", [](int const& y) { return y; }, not_found) == 10);
+
+        auto moved = hana::visit_key(hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("s"), std::string{"abc"})
+        ), "s", [](std::string&& s) { return std::move(s); }, [] { return std::string{}; });
+        BOOST_HANA_RUNTIME_CHECK(moved == "abc");
+    }
+
+    // heterogeneous values
+    {
+        auto map = hana::make_map(
+            hana::make_pair(BOOST_HANA_STRING("int"), 1),
+            hana::make_pair(BOOST_HANA_STRING("string"), std::string{"two"}),
+            hana::make_pair(BOOST_HANA_STRING("double"), 3.5)
+        );
+        auto size = hana::overload(
+            [](std::string const& s) { return static_cast<int>(s.size()); },
+            [](auto x) { return static_cast<int>(x); }
+        );
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "int", size, not_found) == 1);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "string", size, not_found) == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "double", size, not_found) == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::visit_key(map, "float", size, not_found) == -1);
+    }
+}
@@ -0,0 +1,66 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/is_a.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/value.hpp>
+
+#include <vector>
+namespace hana = boost::hana;
+
+
+struct push_back {
+    std::vector<long>* v;
+    void operator()(long i) const { v->push_back(i); }
+};
+
+template <long from, long to>
+std::vector<long> expected() {
+    std::vector<long> v;
+    for (long i = from; i != to; ++i)
+        v.push_back(i);
+    return v;
+}
+
+int main() {
+    // Within the unroll budget, the function gets integral_constants
+    {
+        std::vector<long> v;
+        hana::for_each(hana::make_range(hana::long_c<-3>, hana::long_c<4>), [&](auto i) {
+            static_assert(hana::is_an<hana::integral_constant_tag<long>>(i), "");
+            v.push_back(hana::value(i));
+        });
+        BOOST_HANA_RUNTIME_CHECK(v == (expected<-3, 4>()));
+
+        hana::for_each(hana::make_range(hana::long_c<0>, hana::long_c<0>), [](auto) {
+            BOOST_HANA_RUNTIME_CHECK(false);
+        });
+    }
+
+    // Past the unroll budget, functions that need compile-time indices
+    // still get integral_constants, in order
+    {
+        std::vector<long> v;
+        hana::for_each(hana::make_range(hana::long_c<-50>, hana::long_c<250>), [&](auto i) {
+            static_assert(hana::is_an<hana::integral_constant_tag<long>>(i), "");
+            v.push_back(hana::value(i));
+        });
+        BOOST_HANA_RUNTIME_CHECK(v == (expected<-50, 250>()));
+    }
+
+    // Past the unroll budget, functions accepting a runtime index are
+    // called from a loop, in order
+    {
+        std::vector<long> v;
+        hana::for_each(hana::make_range(hana::long_c<-50>, hana::long_c<2000>), push_back{&v});
+        BOOST_HANA_RUNTIME_CHECK(v == (expected<-50, 2000>()));
+
+        v.clear();
+        hana::for_each(hana::make_range(hana::long_c<7>, hana::long_c<263>), push_back{&v});
+        BOOST_HANA_RUNTIME_CHECK(v == (expected<7, 263>()));
+    }
+}
@@ -0,0 +1,133 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at_key.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/core/to.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/erase_key.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/insert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/length.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+struct A { };
+struct B { };
+struct C { };
+
+struct the_hash;
+
+namespace boost { namespace hana {
+    template <>
+    struct hash_impl<A> {
+        static constexpr auto apply(A const&) {
+            return hana::type_c<the_hash>;
+        }
+    };
+
+    template <>
+    struct hash_impl<B> {
+        static constexpr auto apply(B const&) {
+            return hana::type_c<the_hash>;
+        }
+    };
+
+    template <>
+    struct hash_impl<C> {
+        static constexpr auto apply(C const&) {
+            return hana::type_c<the_hash>;
+        }
+    };
+
+    template <>
+    struct equal_impl<A, A> {
+        static constexpr auto apply(A const&, A const&) {
+            return hana::true_c;
+        }
+    };
+
+    template <>
+    struct equal_impl<B, B> {
+        static constexpr auto apply(B const&, B const&) {
+            return hana::true_c;
+        }
+    };
+
+    template <>
+    struct equal_impl<C, C> {
+        static constexpr auto apply(C const&, C const&) {
+            return hana::true_c;
+        }
+    };
+}}
+
+int main() {
+    constexpr auto a = A{};
+    constexpr auto b = B{};
+    constexpr auto c = C{};
+
+    // ensure the hashes actually collide
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::hash(a), hana::hash(b)));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::hash(a), hana::hash(c)));
+
+    // make_set
+    {
+        auto set = hana::make_set(a, hana::int_c<56>, b);
+
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, a));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, b));
+        BOOST_HANA_CONSTANT_CHECK(hana::contains(set, hana::int_c<56>));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(set, c)));
+        BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(set, hana::int_c<42>)));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(set, a), a));
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(hana::at_key(set, b), b));
+    }
+
+    // insert
+    {
+        auto set = hana::insert(hana::make_set(a, hana::int_c<56>), b);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            set,
+            hana::make_set(a, b, hana::int_c<56>)
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::insert(set, a),
+            set
+        ));
+    }
+
+    // erase_key
+    {
+        auto set = hana::make_set(a, hana::int_c<56>, b, c);
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::erase_key(set, b),
+            hana::make_set(a, hana::int_c<56>, c)
+        ));
+    }
+
+    // to<set_tag>
+    {
+        auto set = hana::to_set(hana::make_tuple(
+            a, b, hana::int_c<56>, a, c, b, hana::int_c<56>, c
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::length(set),
+            hana::size_c<4>
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            set,
+            hana::make_set(a, b, c, hana::int_c<56>)
+        ));
+    }
+}
@@ -9,6 +9,7 @@
 #include <laws/foldable.hpp>
 #include <laws/hashable.hpp>
 #include <laws/iterable.hpp>
+#include <laws/monoid.hpp>
 #include <laws/orderable.hpp>
 #include <laws/searchable.hpp>
 namespace hana = boost::hana;
@@ -76,4 +77,16 @@ int main() {
 
         hana::test::TestSearchable<hana::string_tag>{strings, keys};
     }
+
+    // Monoid
+    {
+        auto strings = hana::make_tuple(
+            BOOST_HANA_STRING(""),
+            BOOST_HANA_STRING("a"),
+            BOOST_HANA_STRING("ab"),
+            BOOST_HANA_STRING("ba")
+        );
+
+        hana::test::TestMonoid<hana::string_tag>{strings};
+    }
 }
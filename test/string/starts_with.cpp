@@ -0,0 +1,34 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto abc = BOOST_HANA_STRING("abc");
+    auto empty = BOOST_HANA_STRING("");
+
+    // starts_with
+    BOOST_HANA_CONSTANT_CHECK(hana::starts_with(empty, empty));
+    BOOST_HANA_CONSTANT_CHECK(hana::starts_with(abc, empty));
+    BOOST_HANA_CONSTANT_CHECK(hana::starts_with(abc, BOOST_HANA_STRING("a")));
+    BOOST_HANA_CONSTANT_CHECK(hana::starts_with(abc, BOOST_HANA_STRING("ab")));
+    BOOST_HANA_CONSTANT_CHECK(hana::starts_with(abc, abc));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::starts_with(abc, BOOST_HANA_STRING("b"))));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::starts_with(abc, BOOST_HANA_STRING("abcd"))));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::starts_with(empty, abc)));
+
+    // ends_with
+    BOOST_HANA_CONSTANT_CHECK(hana::ends_with(empty, empty));
+    BOOST_HANA_CONSTANT_CHECK(hana::ends_with(abc, empty));
+    BOOST_HANA_CONSTANT_CHECK(hana::ends_with(abc, BOOST_HANA_STRING("c")));
+    BOOST_HANA_CONSTANT_CHECK(hana::ends_with(abc, BOOST_HANA_STRING("bc")));
+    BOOST_HANA_CONSTANT_CHECK(hana::ends_with(abc, abc));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::ends_with(abc, BOOST_HANA_STRING("b"))));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::ends_with(abc, BOOST_HANA_STRING("0abc"))));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::ends_with(empty, abc)));
+}
@@ -0,0 +1,48 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/plus.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_concat(),
+        BOOST_HANA_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_concat(BOOST_HANA_STRING("")),
+        BOOST_HANA_STRING("")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_concat(BOOST_HANA_STRING("abc")),
+        BOOST_HANA_STRING("abc")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_concat(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING(""), BOOST_HANA_STRING("c")),
+        BOOST_HANA_STRING("abc")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_concat(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("b"),
+                            BOOST_HANA_STRING("c"), BOOST_HANA_STRING("d"),
+                            BOOST_HANA_STRING("e"), BOOST_HANA_STRING("f")),
+        BOOST_HANA_STRING("abcdef")
+    ));
+
+    // The same string can be concatenated with itself
+    auto abc = BOOST_HANA_STRING("abc");
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_concat(abc, abc, abc),
+        BOOST_HANA_STRING("abcabcabc")
+    ));
+
+    // Monoid
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::plus(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("cd")),
+        BOOST_HANA_STRING("abcd")
+    ));
+}
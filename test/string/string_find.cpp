@@ -0,0 +1,50 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/optional.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_find(BOOST_HANA_STRING(""), BOOST_HANA_STRING("")),
+        hana::just(hana::size_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_find(BOOST_HANA_STRING("abc"), BOOST_HANA_STRING("")),
+        hana::just(hana::size_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_find(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a")),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_find(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("abc")),
+        hana::just(hana::size_c<0>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_find(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("bca")),
+        hana::just(hana::size_c<1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_find(BOOST_HANA_STRING("aab"), BOOST_HANA_STRING("ab")),
+        hana::just(hana::size_c<1>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_find(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("c")),
+        hana::just(hana::size_c<2>)
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_find(BOOST_HANA_STRING("abcabc"), BOOST_HANA_STRING("abd")),
+        hana::nothing
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_find(BOOST_HANA_STRING("ab"), BOOST_HANA_STRING("abc")),
+        hana::nothing
+    ));
+}
@@ -0,0 +1,56 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto ab = BOOST_HANA_STRING("ab");
+    auto x = BOOST_HANA_STRING("x");
+    auto empty = BOOST_HANA_STRING("");
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_replace(empty, ab, x),
+        empty
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_replace(BOOST_HANA_STRING("cd"), ab, x),
+        BOOST_HANA_STRING("cd")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_replace(ab, ab, x),
+        x
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_replace(BOOST_HANA_STRING("abcabab"), ab, x),
+        BOOST_HANA_STRING("xcxx")
+    ));
+
+    // replacements can be longer, shorter or empty
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_replace(BOOST_HANA_STRING("a.b.c"), BOOST_HANA_STRING("."), BOOST_HANA_STRING("::")),
+        BOOST_HANA_STRING("a::b::c")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_replace(BOOST_HANA_STRING("a::b::c"), BOOST_HANA_STRING("::"), BOOST_HANA_STRING(".")),
+        BOOST_HANA_STRING("a.b.c")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_replace(BOOST_HANA_STRING("xaxbx"), x, empty),
+        ab
+    ));
+
+    // occurrences do not overlap, and replacements are not searched again
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_replace(BOOST_HANA_STRING("aaa"), BOOST_HANA_STRING("aa"), BOOST_HANA_STRING("b")),
+        BOOST_HANA_STRING("ba")
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_replace(BOOST_HANA_STRING("aa"), BOOST_HANA_STRING("a"), BOOST_HANA_STRING("aa")),
+        BOOST_HANA_STRING("aaaa")
+    ));
+}
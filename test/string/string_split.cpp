@@ -0,0 +1,46 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+int main() {
+    auto comma = BOOST_HANA_STRING(",");
+
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_split(BOOST_HANA_STRING(""), comma),
+        hana::make_tuple(BOOST_HANA_STRING(""))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_split(BOOST_HANA_STRING("abc"), comma),
+        hana::make_tuple(BOOST_HANA_STRING("abc"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_split(BOOST_HANA_STRING(","), comma),
+        hana::make_tuple(BOOST_HANA_STRING(""), BOOST_HANA_STRING(""))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_split(BOOST_HANA_STRING("a,bc,d"), comma),
+        hana::make_tuple(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("bc"), BOOST_HANA_STRING("d"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_split(BOOST_HANA_STRING(",a,,b,"), comma),
+        hana::make_tuple(BOOST_HANA_STRING(""), BOOST_HANA_STRING("a"), BOOST_HANA_STRING(""),
+                         BOOST_HANA_STRING("b"), BOOST_HANA_STRING(""))
+    ));
+
+    // multi-character separators do not overlap
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_split(BOOST_HANA_STRING("a---b"), BOOST_HANA_STRING("--")),
+        hana::make_tuple(BOOST_HANA_STRING("a"), BOOST_HANA_STRING("-b"))
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::string_split(BOOST_HANA_STRING("a::b"), BOOST_HANA_STRING(":::")),
+        hana::make_tuple(BOOST_HANA_STRING("a::b"))
+    ));
+}
@@ -0,0 +1,68 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstdint>
+#include <type_traits>
+namespace hana = boost::hana;
+
+
+template <typename T, typename S>
+constexpr auto parse(S s) { return hana::string_to_integral<T>(s); }
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(parse<int>(BOOST_HANA_STRING("0")), hana::int_c<0>));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(parse<int>(BOOST_HANA_STRING("-0")), hana::int_c<0>));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(parse<int>(BOOST_HANA_STRING("7")), hana::int_c<7>));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(parse<int>(BOOST_HANA_STRING("00123")), hana::int_c<123>));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(parse<int>(BOOST_HANA_STRING("-45")), hana::int_c<-45>));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(parse<unsigned>(BOOST_HANA_STRING("42")), hana::uint_c<42>));
+
+    // the limits of the underlying type
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        parse<signed char>(BOOST_HANA_STRING("127")),
+        hana::integral_c<signed char, 127>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        parse<signed char>(BOOST_HANA_STRING("-128")),
+        hana::integral_c<signed char, -128>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        parse<std::int64_t>(BOOST_HANA_STRING("-9223372036854775808")),
+        hana::integral_c<std::int64_t, INT64_MIN>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        parse<std::uint64_t>(BOOST_HANA_STRING("18446744073709551615")),
+        hana::integral_c<std::uint64_t, UINT64_MAX>
+    ));
+
+    // the type of the result is the requested one
+    auto one = parse<long>(BOOST_HANA_STRING("1"));
+    static_assert(decltype(one)::value == 1L, "");
+    static_assert(std::is_same<decltype(one)::value_type, long>::value, "");
+
+    // strings and integral constants are unrelated, so comparing them is
+    // always false instead of trying to embed them into a common type
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        BOOST_HANA_STRING("1"), hana::int_c<1>
+    )));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::equal(
+        hana::int_c<1>, BOOST_HANA_STRING("1")
+    )));
+    BOOST_HANA_CONSTANT_CHECK(hana::contains(
+        hana::make_tuple(BOOST_HANA_STRING("a"), hana::int_c<1>),
+        hana::int_c<1>
+    ));
+    BOOST_HANA_CONSTANT_CHECK(hana::not_(hana::contains(
+        hana::make_tuple(BOOST_HANA_STRING("1")),
+        hana::int_c<1>
+    )));
+}
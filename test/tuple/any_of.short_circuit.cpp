@@ -0,0 +1,57 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/all_of.hpp>
+#include <boost/hana/any_of.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/none_of.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+// The predicate must not be called past the first element that
+// determines the result of the search.
+
+int main() {
+    int calls = 0;
+
+    // homogeneous tuple
+    {
+        auto xs = hana::make_tuple(1, 2, 3, 4, 5, 6);
+
+        calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(hana::any_of(xs, [&](int x) { ++calls; return x == 1; }));
+        BOOST_HANA_RUNTIME_CHECK(calls == 1);
+
+        calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(hana::any_of(xs, [&](int x) { ++calls; return x == 3; }));
+        BOOST_HANA_RUNTIME_CHECK(calls == 3);
+
+        calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(!hana::any_of(xs, [&](int x) { ++calls; return x == 7; }));
+        BOOST_HANA_RUNTIME_CHECK(calls == 6);
+
+        calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(!hana::all_of(xs, [&](int x) { ++calls; return x != 2; }));
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+
+        calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(!hana::none_of(xs, [&](int x) { ++calls; return x == 2; }));
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+    }
+
+    // heterogeneous tuple
+    {
+        auto xs = hana::make_tuple(1, 2.0, 'x', 4L);
+        auto is_two = [&](auto x) { ++calls; return x == 2; };
+
+        calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(hana::any_of(xs, is_two));
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+
+        calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(!hana::all_of(xs, [&](auto x) { ++calls; return x == 1; }));
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+    }
+}
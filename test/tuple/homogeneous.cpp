@@ -0,0 +1,185 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/append.hpp>
+#include <boost/hana/assert.hpp>
+#include <boost/hana/at.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/fold_left.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not_equal.hpp>
+#include <boost/hana/transform.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/unpack.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+namespace hana = boost::hana;
+
+
+template <typename Xs>
+constexpr bool contiguous = hana::detail::contiguous_elements<Xs>::value;
+
+struct Empty { };
+struct Point { int x, y; };
+constexpr bool operator==(Point a, Point b) { return a.x == b.x && a.y == b.y; }
+constexpr bool operator!=(Point a, Point b) { return !(a == b); }
+
+struct NoAssign {
+    int x;
+    NoAssign& operator=(NoAssign const&) = delete;
+};
+
+struct make_no_assign {
+    constexpr NoAssign operator()(int x) const { return NoAssign{x}; }
+};
+
+struct plus {
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const { return x + y; }
+};
+
+struct times_ten_plus {
+    constexpr int operator()(int x, int y) const { return x * 10 + y; }
+};
+
+struct twice {
+    template <typename X>
+    constexpr auto operator()(X x) const { return x * 2; }
+};
+
+struct to_double {
+    constexpr double operator()(int x) const { return x + 0.5; }
+};
+
+int main() {
+    // Only tuples of a single trivially copyable and non-empty type are
+    // stored contiguously.
+    {
+        static_assert(contiguous<hana::tuple<int, int>>, "");
+        static_assert(contiguous<hana::tuple<int, int, int, int>>, "");
+        static_assert(contiguous<hana::tuple<Point, Point>>, "");
+        static_assert(contiguous<hana::tuple<int*, int*>>, "");
+
+        static_assert(!contiguous<hana::tuple<>>, "");
+        static_assert(!contiguous<hana::tuple<int>>, "");
+        static_assert(!contiguous<hana::tuple<int, long>>, "");
+        static_assert(!contiguous<hana::tuple<int, int, long>>, "");
+        static_assert(!contiguous<hana::tuple<long, int, int>>, "");
+        static_assert(!contiguous<hana::tuple<int, int const>>, "");
+        static_assert(!contiguous<hana::tuple<int const, int const>>, "");
+        static_assert(!contiguous<hana::tuple<int&, int&>>, "");
+        static_assert(!contiguous<hana::tuple<Empty, Empty>>, "");
+        static_assert(!contiguous<hana::tuple<hana::int_<1>, hana::int_<1>>>, "");
+        static_assert(!contiguous<hana::tuple<std::string, std::string>>, "");
+
+        // The empty base optimization still applies to empty types
+        static_assert(sizeof(hana::tuple<Empty, Empty, int>) == sizeof(int), "");
+    }
+
+    // Construction, access and assignment
+    {
+        constexpr hana::tuple<int, int, int> xs{1, 2, 3};
+        static_assert(hana::at_c<0>(xs) == 1, "");
+        static_assert(hana::at_c<1>(xs) == 2, "");
+        static_assert(hana::at_c<2>(xs) == 3, "");
+
+        constexpr hana::tuple<int, int> zeros{};
+        static_assert(hana::at_c<0>(zeros) == 0, "");
+        static_assert(hana::at_c<1>(zeros) == 0, "");
+
+        constexpr hana::tuple<long, long> converted{xs[hana::int_c<0>], 2};
+        static_assert(hana::at_c<0>(converted) == 1, "");
+
+        hana::tuple<int, int> ys{1, 2};
+        ys = hana::make_tuple(3l, 4l);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ys) == 3);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(ys) == 4);
+
+        ys = hana::tuple<int, long>{5, 6};
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(ys) == 5);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(ys) == 6);
+
+        hana::tuple<int, long> zs{ys};
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<0>(zs) == 5);
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(zs) == 6);
+
+        hana::at_c<1>(ys) = 7;
+        BOOST_HANA_RUNTIME_CHECK(hana::at_c<1>(ys) == 7);
+        static_assert(std::is_same<decltype(hana::at_c<1>(std::move(ys))), int&&>::value, "");
+
+        BOOST_HANA_RUNTIME_CHECK(hana::unpack(ys, plus{}) == 12);
+    }
+
+    // fold_left
+    {
+        constexpr hana::tuple<int, int, int> xs{1, 2, 3};
+        static_assert(hana::fold_left(xs, 0, plus{}) == 6, "");
+        static_assert(hana::fold_left(xs, times_ten_plus{}) == 123, "");
+        static_assert(hana::fold_left(xs, 0.5, plus{}) == 6.5, "");
+
+        // The type of the state changes, so the fold is unrolled
+        static_assert(hana::fold_left(xs, 'a', plus{}) == 'a' + 6, "");
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::fold_left(xs, hana::make_tuple(), hana::append) == xs
+        );
+    }
+
+    // for_each
+    {
+        hana::tuple<int, int, int> xs{1, 2, 3};
+        int sum = 0;
+        hana::for_each(xs, [&](int x) { sum += x; });
+        BOOST_HANA_RUNTIME_CHECK(sum == 6);
+
+        hana::for_each(xs, [](int& x) { x *= 10; });
+        BOOST_HANA_RUNTIME_CHECK(xs == hana::make_tuple(10, 20, 30));
+
+        int order = 0;
+        hana::for_each(xs, [&](int x) { order = order * 100 + x; });
+        BOOST_HANA_RUNTIME_CHECK(order == 102030);
+    }
+
+    // transform
+    {
+        constexpr hana::tuple<int, int, int> xs{1, 2, 3};
+        static_assert(hana::transform(xs, twice{}) == hana::make_tuple(2, 4, 6), "");
+        static_assert(std::is_same<
+            decltype(hana::transform(xs, to_double{})),
+            hana::tuple<double, double, double>
+        >::value, "");
+        static_assert(hana::transform(xs, to_double{}) == hana::make_tuple(1.5, 2.5, 3.5), "");
+
+        // The result is not stored contiguously
+        BOOST_HANA_RUNTIME_CHECK(
+            hana::transform(xs, [](int x) { return std::to_string(x); })
+                == hana::make_tuple(std::string{"1"}, std::string{"2"}, std::string{"3"})
+        );
+
+        // The result is stored contiguously, but its elements can't be
+        // assigned, so it is constructed from the transformed elements
+        static_assert(contiguous<hana::tuple<NoAssign, NoAssign, NoAssign>>, "");
+        constexpr auto ys = hana::transform(xs, make_no_assign{});
+        static_assert(hana::at_c<0>(ys).x == 1, "");
+        static_assert(hana::at_c<1>(ys).x == 2, "");
+        static_assert(hana::at_c<2>(ys).x == 3, "");
+    }
+
+    // equal
+    {
+        constexpr hana::tuple<int, int, int> xs{1, 2, 3};
+        static_assert(xs == hana::make_tuple(1, 2, 3), "");
+        static_assert(xs == hana::make_tuple(1l, 2l, 3l), "");
+        static_assert(xs == hana::make_tuple(1, 2l, 3), "");
+        static_assert(xs != hana::make_tuple(1, 2, 4), "");
+        static_assert(xs != hana::make_tuple(0, 2, 3), "");
+        BOOST_HANA_CONSTANT_CHECK(hana::not_equal(xs, hana::make_tuple(1, 2)));
+
+        constexpr hana::tuple<Point, Point> ps{Point{1, 2}, Point{3, 4}};
+        static_assert(ps == hana::make_tuple(Point{1, 2}, Point{3, 4}), "");
+        static_assert(ps != hana::make_tuple(Point{1, 2}, Point{3, 5}), "");
+    }
+}
@@ -0,0 +1,77 @@
+// Copyright Louis Dionne 2013-2016
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/equal.hpp>
+#include <boost/hana/less.hpp>
+#include <boost/hana/sort.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <support/equivalence_class.hpp>
+namespace hana = boost::hana;
+using hana::test::ct_eq;
+using hana::test::ct_ord;
+
+
+// The auto/sort.hpp tests only sort very short sequences. Here, we sort
+// sequences that are long enough to be split into several runs that must
+// then be merged together.
+int main() {
+    // Sequences sorted in reverse order
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(hana::make_tuple(
+            ct_ord<19>{}, ct_ord<18>{}, ct_ord<17>{}, ct_ord<16>{}, ct_ord<15>{},
+            ct_ord<14>{}, ct_ord<13>{}, ct_ord<12>{}, ct_ord<11>{}, ct_ord<10>{},
+            ct_ord<9>{}, ct_ord<8>{}, ct_ord<7>{}, ct_ord<6>{}, ct_ord<5>{},
+            ct_ord<4>{}, ct_ord<3>{}, ct_ord<2>{}, ct_ord<1>{}, ct_ord<0>{}
+        )),
+        hana::make_tuple(
+            ct_ord<0>{}, ct_ord<1>{}, ct_ord<2>{}, ct_ord<3>{}, ct_ord<4>{},
+            ct_ord<5>{}, ct_ord<6>{}, ct_ord<7>{}, ct_ord<8>{}, ct_ord<9>{},
+            ct_ord<10>{}, ct_ord<11>{}, ct_ord<12>{}, ct_ord<13>{}, ct_ord<14>{},
+            ct_ord<15>{}, ct_ord<16>{}, ct_ord<17>{}, ct_ord<18>{}, ct_ord<19>{}
+        )
+    ));
+
+    // Sequences in no particular order, with duplicates
+    BOOST_HANA_CONSTANT_CHECK(hana::equal(
+        hana::sort(hana::make_tuple(
+            ct_ord<7>{}, ct_ord<3>{}, ct_ord<11>{}, ct_ord<0>{}, ct_ord<3>{},
+            ct_ord<15>{}, ct_ord<2>{}, ct_ord<9>{}, ct_ord<14>{}, ct_ord<1>{},
+            ct_ord<6>{}, ct_ord<12>{}, ct_ord<0>{}, ct_ord<8>{}, ct_ord<5>{},
+            ct_ord<13>{}, ct_ord<4>{}, ct_ord<10>{}
+        )),
+        hana::make_tuple(
+            ct_ord<0>{}, ct_ord<0>{}, ct_ord<1>{}, ct_ord<2>{}, ct_ord<3>{},
+            ct_ord<3>{}, ct_ord<4>{}, ct_ord<5>{}, ct_ord<6>{}, ct_ord<7>{},
+            ct_ord<8>{}, ct_ord<9>{}, ct_ord<10>{}, ct_ord<11>{}, ct_ord<12>{},
+            ct_ord<13>{}, ct_ord<14>{}, ct_ord<15>{}
+        )
+    ));
+
+    // Stability must be preserved across runs
+    {
+        auto pred = [](auto x, auto y) {
+            return hana::less(x.unwrap, y.unwrap);
+        };
+        auto a = [](auto z) { return ::equivalence_class(ct_eq<999>{}, z); };
+        auto b = [](auto z) { return ::equivalence_class(ct_eq<888>{}, z); };
+
+        BOOST_HANA_CONSTANT_CHECK(hana::equal(
+            hana::sort(hana::make_tuple(
+                a(ct_ord<3>{}), a(ct_ord<1>{}), b(ct_ord<2>{}), a(ct_ord<2>{}),
+                b(ct_ord<1>{}), a(ct_ord<0>{}), b(ct_ord<3>{}), a(ct_ord<1>{}),
+                b(ct_ord<0>{}), b(ct_ord<2>{}), a(ct_ord<3>{}), b(ct_ord<1>{}),
+                a(ct_ord<0>{}), b(ct_ord<3>{}), a(ct_ord<2>{}), b(ct_ord<0>{})
+            ), pred),
+            hana::make_tuple(
+                a(ct_ord<0>{}), b(ct_ord<0>{}), a(ct_ord<0>{}), b(ct_ord<0>{}),
+                a(ct_ord<1>{}), b(ct_ord<1>{}), a(ct_ord<1>{}), b(ct_ord<1>{}),
+                b(ct_ord<2>{}), a(ct_ord<2>{}), b(ct_ord<2>{}), a(ct_ord<2>{}),
+                a(ct_ord<3>{}), b(ct_ord<3>{}), a(ct_ord<3>{}), b(ct_ord<3>{})
+            )
+        ));
+    }
+}